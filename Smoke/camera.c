@@ -0,0 +1,115 @@
+// camera.c: Zoom and pan of the view (see camera.h).
+//--------------------------------------------------------------------------------------------------
+
+#include "camera.h"
+#include <GL/glut.h>
+
+//camera_clamp: keep the zoom at least 1 and the visible part inside the unzoomed view
+static void camera_clamp(camera *c)
+{
+	float hw, hh;
+
+	if (c->zoom < 1) c->zoom = 1;
+	hw = 0.5f * c->width / c->zoom;
+	hh = 0.5f * c->height / c->zoom;
+	if (c->cx < hw) c->cx = hw;
+	if (c->cx > c->width - hw) c->cx = c->width - hw;
+	if (c->cy < hh) c->cy = hh;
+	if (c->cy > c->height - hh) c->cy = c->height - hh;
+}
+
+//camera_reset: show the whole window of width x height pixels
+void camera_reset(camera *c, int width, int height)
+{
+	c->zoom = 1;
+	c->width = width;
+	c->height = height;
+	c->cx = 0.5f * width;
+	c->cy = 0.5f * height;
+}
+
+//camera_equal: whether 'a' and 'b' show the same part of the same window
+int camera_equal(const camera *a, const camera *b)
+{
+	return a->zoom == b->zoom && a->cx == b->cx && a->cy == b->cy && a->width == b->width && a->height == b->height;
+}
+
+//camera_zoom: magnify the view by 'factor' around its centre
+void camera_zoom(camera *c, float factor)
+{
+	c->zoom *= factor;
+	camera_clamp(c);
+}
+
+//camera_pan: move the view by (dx,dy) window pixels
+void camera_pan(camera *c, float dx, float dy)
+{
+	c->cx += dx / c->zoom;
+	c->cy += dy / c->zoom;
+	camera_clamp(c);
+}
+
+//camera_apply: set the projection for a window of width x height pixels. When the window was resized, the centre
+//              keeps its relative position.
+void camera_apply(camera *c, int width, int height)
+{
+	float x0, y0, x1, y1;
+
+	if (width != c->width || height != c->height)
+	{
+		if (c->width > 0 && c->height > 0)
+		{
+			c->cx *= (float)width / c->width;
+			c->cy *= (float)height / c->height;
+		}
+		c->width = width;
+		c->height = height;
+	}
+	camera_clamp(c);
+	camera_visible(c, &x0, &y0, &x1, &y1);
+	glMatrixMode(GL_PROJECTION);
+	glLoadIdentity();
+	gluOrtho2D(x0, x1, y0, y1);
+	glMatrixMode(GL_MODELVIEW);
+}
+
+//camera_overlay: set the projection to plain window pixels, for what is drawn over the view (plots, text)
+void camera_overlay(const camera *c)
+{
+	glMatrixMode(GL_PROJECTION);
+	glLoadIdentity();
+	gluOrtho2D(0.0, (GLdouble)c->width, 0.0, (GLdouble)c->height);
+	glMatrixMode(GL_MODELVIEW);
+}
+
+//camera_visible: the visible rectangle (x0,y0)-(x1,y1), in window coordinates of the unzoomed view
+void camera_visible(const camera *c, float *x0, float *y0, float *x1, float *y1)
+{
+	float hw = 0.5f * c->width / c->zoom, hh = 0.5f * c->height / c->zoom;
+	*x0 = c->cx - hw; *x1 = c->cx + hw;
+	*y0 = c->cy - hh; *y1 = c->cy + hh;
+}
+
+//camera_to_world: the point of the unzoomed view that is shown at window pixel (sx,sy), with y pointing up
+void camera_to_world(const camera *c, float sx, float sy, float *x, float *y)
+{
+	float x0, y0, x1, y1;
+	camera_visible(c, &x0, &y0, &x1, &y1);
+	*x = x0 + sx / c->zoom;
+	*y = y0 + sy / c->zoom;
+}
+
+//camera_raster_pos: set the raster position for glDrawPixels to the point (x,y) of the unzoomed view, also when
+//                   that point is outside the visible part (a plain glRasterPos would then be invalid), and return
+//                   the zoom, by which the pixel zoom must be multiplied
+float camera_raster_pos(const camera *c, float x, float y)
+{
+	float x0, y0, x1, y1;
+
+	camera_visible(c, &x0, &y0, &x1, &y1);
+	x0 += 0.5f / c->zoom;                       //the centre of the lower left pixel: always visible
+	y0 += 0.5f / c->zoom;
+	glRasterPos2f(x0, y0);
+	glBitmap(0, 0, 0, 0, (x - x0) * c->zoom, (y - y0) * c->zoom, 0);
+	return c->zoom;
+}
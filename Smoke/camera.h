@@ -0,0 +1,26 @@
+// camera.h: Zoom and pan of the view. Everything is drawn in window coordinates of the unzoomed view, with grid
+//           point (i,j) at (wn+i*wn, hn+j*hn); the camera shows a part of that through the projection, and tells
+//           the renderer which part is visible so that it only generates geometry there.
+//--------------------------------------------------------------------------------------------------
+
+#ifndef CAMERA_H
+#define CAMERA_H
+
+typedef struct
+{
+	float zoom;                 //magnification, at least 1
+	float cx, cy;               //centre of the view, in window coordinates of the unzoomed view
+	int width, height;          //size of the window the camera was last applied to
+} camera;
+
+void camera_reset(camera *c, int width, int height);
+int camera_equal(const camera *a, const camera *b);
+void camera_zoom(camera *c, float factor);
+void camera_pan(camera *c, float dx, float dy);
+void camera_apply(camera *c, int width, int height);
+void camera_overlay(const camera *c);
+void camera_visible(const camera *c, float *x0, float *y0, float *x1, float *y1);
+void camera_to_world(const camera *c, float sx, float sy, float *x, float *y);
+float camera_raster_pos(const camera *c, float x, float y);
+
+#endif
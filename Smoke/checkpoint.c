@@ -0,0 +1,294 @@
+// checkpoint.c: Checkpoint and restart of the solver (see checkpoint.h).
+//--------------------------------------------------------------------------------------------------
+
+#include "checkpoint.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <io.h>
+#define writer_lock(w)   EnterCriticalSection(&(w)->lock)
+#define writer_unlock(w) LeaveCriticalSection(&(w)->lock)
+#define writer_wait(w)   SleepConditionVariableCS(&(w)->wake, &(w)->lock, INFINITE)
+#define writer_wake(w)   WakeAllConditionVariable(&(w)->wake)
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define writer_lock(w)   pthread_mutex_lock(&(w)->lock)
+#define writer_unlock(w) pthread_mutex_unlock(&(w)->lock)
+#define writer_wait(w)   pthread_cond_wait(&(w)->wake, &(w)->lock)
+#define writer_wake(w)   pthread_cond_broadcast(&(w)->wake)
+#endif
+
+//checksum: FNV-1a over 64-bit words, then over the bytes left
+static unsigned long long checksum(const unsigned char *data, size_t size)
+{
+	unsigned long long h = 14695981039346656037ull, word;
+	size_t i;
+
+	for (i = 0; i + 8 <= size; i += 8)
+	{
+		memcpy(&word, data + i, 8);
+		h = (h ^ word) * 1099511628211ull;
+	}
+	for (; i < size; i++)
+		h = (h ^ data[i]) * 1099511628211ull;
+	return h;
+}
+
+//layout: the offsets of the fields of 's' in the file, and its size
+static void layout(const checkpoint_state *s, checkpoint_header *h)
+{
+	unsigned long long position = CHECKPOINT_HEADER;
+	int f;
+
+	for (f = 0; f < CHECKPOINT_FIELDS; f++)
+	{
+		h->offset[f] = position;
+		h->count[f] = s->count[f];
+		position = (position + s->count[f] * sizeof(fftw_real) + 63) & ~63ull;
+	}
+	h->size = position;
+}
+
+//write_file: write the image to <path>.tmp, flush it to disk and rename it over <path>
+static int write_file(checkpoint_writer *w)
+{
+	char temporary[sizeof(w->path) + 4];
+	FILE *file;
+	int ok;
+
+	sprintf(temporary, "%s.tmp", w->path);
+	file = fopen(temporary, "wb");
+	if (!file) return -1;
+	ok = fwrite(w->image, 1, w->size, file) == w->size && fflush(file) == 0;
+#ifdef _WIN32
+	ok = ok && _commit(_fileno(file)) == 0;
+	ok = (fclose(file) == 0) && ok;
+	ok = ok && MoveFileExA(temporary, w->path, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+#else
+	ok = ok && fsync(fileno(file)) == 0;
+	ok = (fclose(file) == 0) && ok;
+	ok = ok && rename(temporary, w->path) == 0;
+#endif
+	if (!ok) remove(temporary);
+	return ok ? 0 : -1;
+}
+
+//writer_main: the writer thread: writes the image whenever checkpoint_save hands it one, until checkpoint_stop
+#ifdef _WIN32
+static DWORD WINAPI writer_main(LPVOID argument)
+#else
+static void *writer_main(void *argument)
+#endif
+{
+	checkpoint_writer *w = (checkpoint_writer*) argument;
+
+	writer_lock(w);
+	for (;;)
+	{
+		checkpoint_header *h;
+		int result;
+
+		while (!w->busy && !w->quit)
+			writer_wait(w);
+		if (!w->busy)                               //quit, with nothing left to write
+			break;
+		writer_unlock(w);
+		h = (checkpoint_header*) w->image;
+		h->checksum = checksum(w->image + CHECKPOINT_HEADER, w->size - CHECKPOINT_HEADER);
+		result = write_file(w);
+		writer_lock(w);
+		if (result == 0)
+		{
+			w->written++;
+			w->frame = h->frame;
+		}
+		else
+			w->failed++;
+		w->busy = 0;
+		writer_wake(w);
+	}
+	writer_unlock(w);
+	return 0;
+}
+
+//checkpoint_start: start the writer thread of the checkpoints in 'path'. Returns 0 on success, -1 on failure.
+int checkpoint_start(checkpoint_writer *w, const char *path)
+{
+	memset(w, 0, sizeof(*w));
+	strncpy(w->path, path, sizeof(w->path) - 1);
+#ifdef _WIN32
+	InitializeCriticalSection(&w->lock);
+	InitializeConditionVariable(&w->wake);
+	w->thread = CreateThread(NULL, 0, writer_main, w, 0, NULL);
+	if (!w->thread)
+	{
+		DeleteCriticalSection(&w->lock);
+		return -1;
+	}
+#else
+	pthread_mutex_init(&w->lock, NULL);
+	pthread_cond_init(&w->wake, NULL);
+	if (pthread_create(&w->thread, NULL, writer_main, w) != 0)
+	{
+		pthread_mutex_destroy(&w->lock);
+		pthread_cond_destroy(&w->wake);
+		return -1;
+	}
+#endif
+	w->running = 1;
+	return 0;
+}
+
+//checkpoint_stop: write the checkpoint still pending, and stop the writer thread
+void checkpoint_stop(checkpoint_writer *w)
+{
+	if (!w->running) return;
+	writer_lock(w);
+	w->quit = 1;
+	writer_wake(w);
+	writer_unlock(w);
+#ifdef _WIN32
+	WaitForSingleObject(w->thread, INFINITE);
+	CloseHandle(w->thread);
+	DeleteCriticalSection(&w->lock);
+#else
+	pthread_join(w->thread, NULL);
+	pthread_mutex_destroy(&w->lock);
+	pthread_cond_destroy(&w->wake);
+#endif
+	free(w->image);
+	w->image = 0;
+	w->running = 0;
+}
+
+//checkpoint_save: copy the state 's' and hand it to the writer thread. Returns 0 when the checkpoint will be written,
+//                 1 when it is skipped because the writer is still busy, -1 when the writer is not running.
+int checkpoint_save(checkpoint_writer *w, const checkpoint_state *s)
+{
+	checkpoint_header h;
+	int busy, f;
+
+	if (!w->running) return -1;
+	writer_lock(w);
+	busy = w->busy;
+	writer_unlock(w);
+	if (busy)
+	{
+		w->skipped++;
+		return 1;
+	}
+
+	memset(&h, 0, sizeof(h));
+	h.magic = CHECKPOINT_MAGIC;
+	h.version = CHECKPOINT_VERSION;
+	h.n = s->n;
+	h.precision = sizeof(fftw_real);
+	h.frame = s->frame;
+	h.fields = CHECKPOINT_FIELDS;
+	h.dt = s->dt;
+	h.visc = s->visc;
+	layout(s, &h);
+	if (h.size != w->size)                          //the writer does not touch the image while it is not busy
+	{
+		free(w->image);
+		w->size = (size_t)h.size;
+		w->image = (unsigned char*) calloc(w->size, 1);
+	}
+	memcpy(w->image, &h, sizeof(h));
+	for (f = 0; f < CHECKPOINT_FIELDS; f++)
+		memcpy(w->image + h.offset[f], s->fields[f], s->count[f] * sizeof(fftw_real));
+
+	writer_lock(w);
+	w->busy = 1;
+	writer_wake(w);
+	writer_unlock(w);
+	return 0;
+}
+
+//checkpoint_load: restore the state 's' (whose n, fields and counts give the grid to restore into) from the
+//                 checkpoint 'path'. Returns 0 on success; on failure, -1, and 's' is left as it was.
+int checkpoint_load(const char *path, checkpoint_state *s)
+{
+	const unsigned char *data;
+	const checkpoint_header *h;
+	size_t size;
+	const char *problem = 0;
+	int f;
+#ifdef _WIN32
+	HANDLE file, mapping;
+	LARGE_INTEGER length;
+
+	file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &length) || length.QuadPart < CHECKPOINT_HEADER)
+	{
+		fprintf(stderr, "checkpoint: cannot read %s\n", path);
+		if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+		return -1;
+	}
+	size = (size_t)length.QuadPart;
+	mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	data = mapping ? (const unsigned char*) MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : 0;
+	if (!data)
+	{
+		fprintf(stderr, "checkpoint: cannot map %s (error %lu)\n", path, GetLastError());
+		if (mapping) CloseHandle(mapping);
+		CloseHandle(file);
+		return -1;
+	}
+#else
+	struct stat status;
+	int fd = open(path, O_RDONLY);
+
+	if (fd < 0 || fstat(fd, &status) != 0 || status.st_size < CHECKPOINT_HEADER)
+	{
+		fprintf(stderr, "checkpoint: cannot read %s\n", path);
+		if (fd >= 0) close(fd);
+		return -1;
+	}
+	size = (size_t)status.st_size;
+	data = (const unsigned char*) mmap(0, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED)
+	{
+		perror("checkpoint");
+		return -1;
+	}
+	madvise((void*)data, size, MADV_SEQUENTIAL);
+#endif
+
+	h = (const checkpoint_header*) data;
+	if (h->magic != CHECKPOINT_MAGIC)                    problem = "not a checkpoint";
+	else if (h->version != CHECKPOINT_VERSION)           problem = "a checkpoint of another version";
+	else if (h->n != (unsigned int)s->n)                 problem = "a checkpoint of another grid size";
+	else if (h->precision != sizeof(fftw_real))          problem = "a checkpoint of another precision";
+	else if (h->fields != CHECKPOINT_FIELDS || h->size != size) problem = "damaged";
+	for (f = 0; f < CHECKPOINT_FIELDS && !problem; f++)
+		if (h->count[f] != s->count[f] || h->offset[f] < CHECKPOINT_HEADER
+		 || h->offset[f] + h->count[f] * sizeof(fftw_real) > size)
+			problem = "damaged";
+	if (!problem && checksum(data + CHECKPOINT_HEADER, size - CHECKPOINT_HEADER) != h->checksum)
+		problem = "damaged (checksum)";
+	if (problem)
+		fprintf(stderr, "checkpoint: %s is %s\n", path, problem);
+	else
+	{
+		for (f = 0; f < CHECKPOINT_FIELDS; f++)
+			memcpy(s->fields[f], data + h->offset[f], s->count[f] * sizeof(fftw_real));
+		s->frame = h->frame;
+		s->dt = h->dt;
+		s->visc = h->visc;
+	}
+
+#ifdef _WIN32
+	UnmapViewOfFile(data);
+	CloseHandle(mapping);
+	CloseHandle(file);
+#else
+	munmap((void*)data, size);
+#endif
+	return problem ? -1 : 0;
+}
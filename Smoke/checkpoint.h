@@ -0,0 +1,80 @@
+// checkpoint.h: Checkpoints of the complete state of the solver, and restarting from them.
+//
+//                checkpoint_save copies the state into the image of the file (a memcpy per field) and returns; a
+//                writer thread checksums the image, writes it to <path>.tmp, flushes it to disk and renames it over
+//                <path>, so that <path> is always a complete checkpoint, the new one or the one before. When the
+//                writer is still busy with the previous checkpoint, the new one is skipped: a checkpoint never
+//                waits for the disk. checkpoint_load maps the file and copies the fields straight into the
+//                solver, after checking the version, the grid, the sizes and the checksum.
+//
+//                File: checkpoint_header (CHECKPOINT_HEADER bytes), then the fields at the offsets it gives, each
+//                aligned to 64 bytes. Version 1.
+//--------------------------------------------------------------------------------------------------
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <rfftw.h>
+#include <stddef.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#define CHECKPOINT_MAGIC 0x4b434d53         //"SMCK"
+#define CHECKPOINT_VERSION 1
+#define CHECKPOINT_HEADER 256               //bytes reserved for the header
+
+enum { CHECKPOINT_VX, CHECKPOINT_VY, CHECKPOINT_VX0, CHECKPOINT_VY0,
+       CHECKPOINT_FX, CHECKPOINT_FY, CHECKPOINT_RHO, CHECKPOINT_RHO0, CHECKPOINT_FIELDS };
+
+typedef struct
+{
+	unsigned int magic;                     //CHECKPOINT_MAGIC
+	unsigned int version;                   //CHECKPOINT_VERSION
+	unsigned int n;                         //size of the grid
+	unsigned int precision;                 //bytes per value: sizeof(fftw_real) of the writer
+	unsigned int frame;                     //simulation steps done
+	unsigned int fields;                    //CHECKPOINT_FIELDS
+	double dt, visc;
+	unsigned long long offset[CHECKPOINT_FIELDS];  //position of each field in the file
+	unsigned long long count[CHECKPOINT_FIELDS];   //values of each field
+	unsigned long long size;                //bytes of the file
+	unsigned long long checksum;            //of the bytes after the header
+} checkpoint_header;
+
+typedef struct                              //the state of the solver, as the simulation keeps it
+{
+	int n, frame;
+	double dt, visc;
+	fftw_real *fields[CHECKPOINT_FIELDS];
+	size_t count[CHECKPOINT_FIELDS];
+} checkpoint_state;
+
+typedef struct
+{
+	char path[256];
+	unsigned char *image;                   //the file to write: header and fields
+	size_t size;
+	int busy;                               //the writer thread owns the image
+	int running, quit;
+	int written, skipped, failed;
+	unsigned int frame;                     //step of the checkpoint written last
+#ifdef _WIN32
+	HANDLE thread;
+	CRITICAL_SECTION lock;
+	CONDITION_VARIABLE wake;
+#else
+	pthread_t thread;
+	pthread_mutex_t lock;
+	pthread_cond_t wake;
+#endif
+} checkpoint_writer;
+
+int  checkpoint_start(checkpoint_writer *w, const char *path);
+void checkpoint_stop(checkpoint_writer *w);
+int  checkpoint_save(checkpoint_writer *w, const checkpoint_state *s);
+int  checkpoint_load(const char *path, checkpoint_state *s);
+
+#endif
@@ -0,0 +1,193 @@
+// critical.c: Critical point extraction (see critical.h).
+//
+//             Cell (i,j) spans the grid points (i,j) to (i+1,j+1), with the periodic wrap of the solver, and the
+//             velocity inside is the bilinear interpolation of its corners. A cell can only hold a zero when both
+//             components change sign over its corners, which is tested with one sign mask per corner. In such a
+//             cell, u = 0 and v = 0 are two hyperbolas; eliminating s gives a quadratic in t, whose roots inside the
+//             cell are the critical points. The Jacobian of the interpolation at a root classifies it. Roots are
+//             kept for s and t in [0,1), so a root on an edge shared by two cells is found once.
+//--------------------------------------------------------------------------------------------------
+
+#include "critical.h"
+#include <GL/glut.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+//critical_add: append the point (x,y) of type 'type' to the list 'l'
+static void critical_add(critical_list *l, float x, float y, int type)
+{
+	if (l->count == l->capacity)
+	{
+		l->capacity = l->capacity ? 2 * l->capacity : 64;
+		l->points = (critical_point*) realloc(l->points, l->capacity * sizeof(critical_point));
+	}
+	l->points[l->count].x = x;
+	l->points[l->count].y = y;
+	l->points[l->count].type = type;
+	l->count++;
+}
+
+//critical_classify: type of a critical point with Jacobian [[ux,uy],[vx,vy]]
+static int critical_classify(double ux, double uy, double vx, double vy)
+{
+	double tr = ux + vy, det = ux * vy - uy * vx;
+
+	if (det < 0) return CRITICAL_SADDLE;
+	if (tr * tr < 4 * det && fabs(tr) < CRITICAL_CENTER_TOLERANCE * sqrt(det)) return CRITICAL_CENTER;
+	return (tr > 0) ? CRITICAL_SOURCE : CRITICAL_SINK;
+}
+
+//critical_cell: find the critical points of the cell with corner velocities u00..u11, v00..v11 and lower left corner
+//               (i,j), and add them to 'l'
+static void critical_cell(critical_list *l, int i, int j, double u00, double u10, double u01, double u11,
+                          double v00, double v10, double v01, double v11)
+{
+	double a0 = u00, a1 = u10 - u00, a2 = u01 - u00, a3 = u00 - u10 - u01 + u11;
+	double b0 = v00, b1 = v10 - v00, b2 = v01 - v00, b3 = v00 - v10 - v01 + v11;
+	double A = a2 * b3 - b2 * a3, B = a0 * b3 + a2 * b1 - b0 * a3 - b2 * a1, C = a0 * b1 - b0 * a1;
+	double t[2];
+	int k, nroots = 0;
+
+	if (fabs(A) < 1e-12 * (fabs(B) + fabs(C)))          //linear in t
+	{
+		if (B != 0) t[nroots++] = -C / B;
+	}
+	else
+	{
+		double d = B * B - 4 * A * C, q;
+		if (d < 0) return;
+		q = -0.5 * (B + ((B < 0) ? -sqrt(d) : sqrt(d)));  //the two roots without cancellation
+		t[nroots++] = q / A;
+		if (q != 0) t[nroots++] = C / q;
+	}
+
+	for (k = 0; k < nroots; k++)
+	{
+		double tk = t[k], du = a1 + a3 * tk, dv = b1 + b3 * tk, s;
+		if (tk < 0 || tk >= 1) continue;
+		if (fabs(du) >= fabs(dv))
+		{
+			if (du == 0) continue;
+			s = -(a0 + a2 * tk) / du;
+		}
+		else
+			s = -(b0 + b2 * tk) / dv;
+		if (s < 0 || s >= 1) continue;
+		critical_add(l, (float)(i + s), (float)(j + tk), critical_classify(du, a2 + a3 * s, dv, b2 + b3 * s));
+	}
+}
+
+void critical_init(critical_set *c)
+{
+	memset(c, 0, sizeof(*c));
+	c->frame = -1;
+}
+
+void critical_free(critical_set *c)
+{
+	int b;
+	for (b = 0; b < c->nblocks; b++)
+		free(c->blocks[b].points);
+	free(c->blocks);
+	free(c->all.points);
+	memset(c, 0, sizeof(*c));
+}
+
+//critical_find: find the critical points of the n x n field (vx,vy) of simulation step 'frame', unless that step was
+//               already searched. Returns the number of critical points.
+int critical_find(critical_set *c, int n, const fftw_real *vx, const fftw_real *vy, int frame)
+{
+	int nblocks = (n + CRITICAL_ROWS - 1) / CRITICAL_ROWS, b, total;
+
+	if (frame == c->frame) return c->all.count;
+	c->frame = frame;
+
+	if (nblocks > c->nblocks)
+	{
+		c->blocks = (critical_list*) realloc(c->blocks, nblocks * sizeof(critical_list));
+		memset(c->blocks + c->nblocks, 0, (nblocks - c->nblocks) * sizeof(critical_list));
+		c->nblocks = nblocks;
+	}
+
+#pragma omp parallel for schedule(dynamic)
+	for (b = 0; b < nblocks; b++)
+	{
+		critical_list *l = c->blocks + b;
+		int j0 = b * CRITICAL_ROWS, j1 = (j0 + CRITICAL_ROWS < n) ? j0 + CRITICAL_ROWS : n, i, j;
+
+		l->count = 0;
+		for (j = j0; j < j1; j++)
+		{
+			const fftw_real *u0 = vx + n * j, *v0 = vy + n * j;
+			const fftw_real *u1 = vx + n * ((j + 1 < n) ? j + 1 : 0), *v1 = vy + n * ((j + 1 < n) ? j + 1 : 0);
+
+			for (i = 0; i < n; i++)
+			{
+				int i1 = (i + 1 < n) ? i + 1 : 0;
+				//bit 0: u > 0, bit 1: v > 0; a component changes sign when its bit is in 'any' but not in 'all'
+				int m00 = (u0[i] > 0) | (v0[i] > 0) << 1, m10 = (u0[i1] > 0) | (v0[i1] > 0) << 1;
+				int m01 = (u1[i] > 0) | (v1[i] > 0) << 1, m11 = (u1[i1] > 0) | (v1[i1] > 0) << 1;
+				int any = m00 | m10 | m01 | m11, all = m00 & m10 & m01 & m11;
+
+				if ((any & ~all) == 3)
+					critical_cell(l, i, j, u0[i], u0[i1], u1[i], u1[i1], v0[i], v0[i1], v1[i], v1[i1]);
+			}
+		}
+	}
+
+	for (total = 0, b = 0; b < nblocks; b++)             //pack the lists of the blocks, in row order
+		total += c->blocks[b].count;
+	if (total > c->all.capacity)
+	{
+		c->all.capacity = total;
+		c->all.points = (critical_point*) realloc(c->all.points, total * sizeof(critical_point));
+	}
+	for (c->all.count = 0, b = 0; b < nblocks; b++)
+	{
+		memcpy(c->all.points + c->all.count, c->blocks[b].points, c->blocks[b].count * sizeof(critical_point));
+		c->all.count += c->blocks[b].count;
+	}
+	return c->all.count;
+}
+
+//critical_draw: draw a glyph at every critical point, with grid point (i,j) at window position (wn+i*wn, hn+j*hn):
+//               a red circle for a source, a blue disc for a sink, a yellow cross for a saddle and a green diamond
+//               for a centre
+void critical_draw(const critical_set *c, float wn, float hn)
+{
+	const float r = 6;                                  //size of a glyph, in pixels
+	int p, k;
+
+	glLineWidth(2);
+	for (p = 0; p < c->all.count; p++)
+	{
+		const critical_point *q = c->all.points + p;
+		float x = wn + q->x * wn, y = hn + q->y * hn;
+
+		switch (q->type)
+		{
+		  case CRITICAL_SOURCE:
+		  case CRITICAL_SINK:
+			if (q->type == CRITICAL_SOURCE) { glColor3f(1, 0.2f, 0.2f); glBegin(GL_LINE_LOOP); }
+			else                            { glColor3f(0.2f, 0.4f, 1); glBegin(GL_POLYGON); }
+			for (k = 0; k < 12; k++)
+				glVertex2f(x + r * (float)cos(k * 0.5235988f), y + r * (float)sin(k * 0.5235988f));
+			glEnd();
+			break;
+		  case CRITICAL_SADDLE:
+			glColor3f(1, 1, 0);
+			glBegin(GL_LINES);
+			glVertex2f(x - r, y - r); glVertex2f(x + r, y + r);
+			glVertex2f(x - r, y + r); glVertex2f(x + r, y - r);
+			glEnd();
+			break;
+		  default:
+			glColor3f(0.2f, 1, 0.2f);
+			glBegin(GL_LINE_LOOP);
+			glVertex2f(x - r, y); glVertex2f(x, y - r); glVertex2f(x + r, y); glVertex2f(x, y + r);
+			glEnd();
+		}
+	}
+	glLineWidth(1);
+}
@@ -0,0 +1,42 @@
+// critical.h: Critical points of the velocity field (points where the velocity is zero), located in the cells of the
+//             grid and classified as sources, sinks, saddles and centres. The grid is split into blocks of rows that
+//             are searched by different threads, each into its own list; the lists are then packed into one compact
+//             list for drawing.
+//--------------------------------------------------------------------------------------------------
+
+#ifndef CRITICAL_H
+#define CRITICAL_H
+
+#include <rfftw.h>
+
+#define CRITICAL_ROWS 16        //rows of cells per block
+#define CRITICAL_CENTER_TOLERANCE 0.1f  //a point with complex eigenvalues is a centre when |trace| < this * sqrt(det)
+
+enum { CRITICAL_SOURCE, CRITICAL_SINK, CRITICAL_SADDLE, CRITICAL_CENTER };
+
+typedef struct
+{
+	float x, y;                 //position, in grid coordinates
+	int type;                   //one of the enum above
+} critical_point;
+
+typedef struct
+{
+	int count, capacity;
+	critical_point *points;
+} critical_list;
+
+typedef struct
+{
+	critical_list all;          //the critical points of the last search, in row order
+	int nblocks;                //one list per block of rows
+	critical_list *blocks;
+	int frame;                  //simulation step of the last search, or -1
+} critical_set;
+
+void critical_init(critical_set *c);
+void critical_free(critical_set *c);
+int  critical_find(critical_set *c, int n, const fftw_real *vx, const fftw_real *vy, int frame);
+void critical_draw(const critical_set *c, float wn, float hn);
+
+#endif
@@ -35,6 +35,11 @@
 #define TWIDDLEI_CODELET(x) \
 	 &fftwi_twiddle_##x##_desc
 
+#define NOTW_BATCH_CODELET(x) \
+	 &fftw_no_twiddle_batch_##x##_desc
+#define NOTWI_BATCH_CODELET(x) \
+	 &fftwi_no_twiddle_batch_##x##_desc
+
 /* automatically-generated list of codelets */
 
 extern fftw_codelet_desc fftw_no_twiddle_1_desc;
@@ -97,6 +102,12 @@ extern fftw_codelet_desc fftw_twiddle_32_desc;
 extern fftw_codelet_desc fftwi_twiddle_32_desc;
 extern fftw_codelet_desc fftw_twiddle_64_desc;
 extern fftw_codelet_desc fftwi_twiddle_64_desc;
+extern fftw_codelet_desc fftw_no_twiddle_batch_16_desc;
+extern fftw_codelet_desc fftwi_no_twiddle_batch_16_desc;
+extern fftw_codelet_desc fftw_no_twiddle_batch_32_desc;
+extern fftw_codelet_desc fftwi_no_twiddle_batch_32_desc;
+extern fftw_codelet_desc fftw_no_twiddle_batch_64_desc;
+extern fftw_codelet_desc fftwi_no_twiddle_batch_64_desc;
 
 fftw_codelet_desc *fftw_config[] =
 {
@@ -162,3 +173,14 @@ fftw_codelet_desc *fftw_config[] =
      TWIDDLEI_CODELET(64),
      (fftw_codelet_desc *) 0
 };
+
+fftw_codelet_desc *fftw_batch_config[] =
+{
+     NOTW_BATCH_CODELET(16),
+     NOTWI_BATCH_CODELET(16),
+     NOTW_BATCH_CODELET(32),
+     NOTWI_BATCH_CODELET(32),
+     NOTW_BATCH_CODELET(64),
+     NOTWI_BATCH_CODELET(64),
+     (fftw_codelet_desc *) 0
+};
@@ -65,6 +65,32 @@ void fftw_strided_copy(int n, fftw_complex *in, int ostride,
      }
 }
 
+/*
+ * Apply a no-twiddle codelet to howmany transforms.  If they are
+ * interleaved (idist < istride, as for the recursion below a twiddle
+ * node, or for the non-contiguous dimensions of fftwnd), and there is
+ * a batch codelet of this size, FFTW_BATCH_LANES transforms are done
+ * per call, one per SIMD lane.  Batch codelets read all of their
+ * inputs before writing, so in may equal out.
+ */
+static void executor_many_notw(fftw_plan_node *p, const fftw_complex *in,
+			       fftw_complex *out,
+			       int istride, int ostride,
+			       int howmany, int idist, int odist)
+{
+     fftw_notw_codelet *codelet = p->nodeu.notw.codelet;
+     fftw_notw_batch_codelet *batch = p->nodeu.notw.batch;
+     int s = 0;
+
+     HACK_ALIGN_STACK_ODD;
+     if (batch && idist < istride)
+	  for (; s + FFTW_BATCH_LANES <= howmany; s += FFTW_BATCH_LANES)
+	       batch(in + s * idist, out + s * odist,
+		     istride, ostride, idist, odist);
+     for (; s < howmany; ++s)
+	  codelet(in + s * idist, out + s * odist, istride, ostride);
+}
+
 static void executor_many(int n, const fftw_complex *in,
 			  fftw_complex *out,
 			  fftw_plan_node *p,
@@ -77,16 +103,9 @@ static void executor_many(int n, const fftw_complex *in,
 
      switch (p->type) {
 	 case FFTW_NOTW:
-	      {
-		   fftw_notw_codelet *codelet = p->nodeu.notw.codelet;
-
-		   HACK_ALIGN_STACK_ODD;
-		   for (s = 0; s < howmany; ++s)
-			codelet(in + s * idist,
-				out + s * odist,
-				istride, ostride);
-		   break;
-	      }
+	      executor_many_notw(p, in, out, istride, ostride,
+				 howmany, idist, odist);
+	      break;
 
 	 default:
 	      for (s = 0; s < howmany; ++s)
@@ -112,16 +131,9 @@ static void executor_many_vector(int n, const fftw_complex *in,
 
      switch (p->type) {
 	 case FFTW_NOTW:
-	      {
-		   fftw_notw_codelet *codelet = p->nodeu.notw.codelet;
-
-		   HACK_ALIGN_STACK_ODD;
-		   for (s = 0; s < howmany; ++s)
-			codelet(in + s * idist,
-				out + s * odist,
-				istride, ostride);
-		   break;
-	      }
+	      executor_many_notw(p, in, out, istride, ostride,
+				 howmany, idist, odist);
+	      break;
 
 	 case FFTW_TWIDDLE:
 	      {
@@ -362,17 +374,9 @@ static void executor_many_inplace(int n, fftw_complex *in,
 {
      switch (p->type) {
 	 case FFTW_NOTW:
-	      {
-		   fftw_notw_codelet *codelet = p->nodeu.notw.codelet;
-		   int s;
-
-		   HACK_ALIGN_STACK_ODD;
-		   for (s = 0; s < howmany; ++s)
-			codelet(in + s * idist,
-				in + s * idist,
-				istride, istride);
-		   break;
-	      }
+	      executor_many_notw(p, in, in, istride, istride,
+				 howmany, idist, idist);
+	      break;
 
 	 default:
 	      {
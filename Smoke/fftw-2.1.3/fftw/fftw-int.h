@@ -188,6 +188,17 @@ typedef double FFTW_TRIG_REAL;	/* the argument type for sin and cos */
 
 #define FFTW_K2PI FFTW_KONST(6.2831853071795864769252867665590057683943388)
 
+/*
+ * Number of transforms computed at once by the batch no-twiddle
+ * codelets (fnb_*.c and fnib_*.c): enough to fill a 256-bit vector
+ * register with one fftw_real from each transform.
+ */
+#ifdef FFTW_ENABLE_FLOAT
+#define FFTW_BATCH_LANES 8
+#else
+#define FFTW_BATCH_LANES 4
+#endif
+
 /****************************************************************************/
 /*                               gcc/x86 hacks                              */
 /****************************************************************************/
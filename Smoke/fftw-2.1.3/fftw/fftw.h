@@ -86,6 +86,8 @@ typedef enum {
  *********************************************/
 typedef void (fftw_notw_codelet) 
      (const fftw_complex *, fftw_complex *, int, int);
+typedef void (fftw_notw_batch_codelet) 
+     (const fftw_complex *, fftw_complex *, int, int, int, int);
 typedef void (fftw_twiddle_codelet)
      (fftw_complex *, const fftw_complex *, int,
       int, int);
@@ -101,6 +103,12 @@ typedef void (fftw_hc2real_codelet)
 typedef void (fftw_hc2hc_codelet)
      (fftw_real *, const fftw_complex *,
       int, int, int);
+typedef void (fftw_hc2hc_to_c_codelet)
+     (const fftw_real *, const fftw_complex *,
+      int, int, int, fftw_complex *, int);
+typedef void (fftw_hc2hc_from_c_codelet)
+     (fftw_real *, const fftw_complex *,
+      int, int, int, const fftw_complex *, int);
 typedef void (fftw_rgeneric_codelet)
      (fftw_real *, const fftw_complex *, int,
       int, int, int);
@@ -193,6 +201,7 @@ typedef struct fftw_plan_node_struct {
 	       int size;
 	       fftw_notw_codelet *codelet;
 	       const fftw_codelet_desc *codelet_desc;
+	       fftw_notw_batch_codelet *batch;	/* or NULL */
 	  } notw;
 
 	  /* nodes of type FFTW_TWIDDLE */
@@ -415,6 +424,53 @@ extern void fftwnd(fftwnd_plan plan, int howmany,
 		   fftw_complex *out, int ostride, int odist);
 extern void fftwnd_one(fftwnd_plan p, fftw_complex *in, fftw_complex *out);
 
+/*****************************
+ *    Guru interface
+ *****************************/
+
+/*
+ * One dimension of an arbitrarily strided array: n elements, at
+ * stride is (in the input) and os (in the output), in units of
+ * fftw_complex.
+ */
+typedef struct {
+     int n;
+     int is;
+     int os;
+} fftw_iodim;
+
+typedef struct {
+     int is_in_place;
+     fftw_direction dir;
+
+     int rank;			/* transform dimensions */
+     fftw_iodim *dims;
+
+     int howmany_rank;		/* loop ("howmany") dimensions */
+     fftw_iodim *howmany_dims;
+
+     int nloops;		/* howmany_rank + rank - 1 */
+     fftw_iodim *loops;		/*
+				 * loops[i * nloops ...]: the dimensions
+				 * looped over while transforming dims[i],
+				 * innermost last
+				 */
+
+     fftw_plan *plans;		/* 1d fftw plans for each dimension */
+     fftw_complex *work;	/* scratch for the in-place 1d plans */
+} fftw_guru_data;
+
+typedef fftw_guru_data *fftw_guru_plan;
+
+extern fftw_guru_plan fftw_create_guru_plan(int rank, const fftw_iodim *dims,
+					    int howmany_rank,
+					    const fftw_iodim *howmany_dims,
+					    fftw_direction dir, int flags);
+extern void fftw_destroy_guru_plan(fftw_guru_plan plan);
+extern void fftw_fprint_guru_plan(FILE *f, fftw_guru_plan plan);
+extern void fftw_guru(fftw_guru_plan plan,
+		      fftw_complex *in, fftw_complex *out);
+
 #ifdef __cplusplus
 }                               /* extern "C" */
 
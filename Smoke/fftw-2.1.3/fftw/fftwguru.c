@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 1997-1999 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/*
+ * fftwguru.c -- transforms of arbitrarily strided data.
+ *
+ * A guru plan describes the transform dimensions and the "howmany"
+ * loop dimensions of the data each by an fftw_iodim, so that it can
+ * express e.g. a batch of 2d transforms of sub-blocks of a larger
+ * array, or transposed output, without the caller copying anything.
+ *
+ * As in fftwnd, the last transform dimension is done out of place
+ * (from in to out) and the other dimensions are then done in place
+ * on the output.  For each dimension, every other dimension (loop or
+ * transform) is looped over; the innermost of those loops is handed
+ * to fftw() as its howmany, so the 1d executor sees as many
+ * transforms per call as possible.
+ *
+ * For in-place plans (FFTW_IN_PLACE), out is ignored, the result
+ * overwrites in, and only the is strides are used.
+ */
+
+#include <fftw-int.h>
+
+/* |x|, for ordering loops by stride */
+#define ABS_STRIDE(x) ((x) < 0 ? -(x) : (x))
+
+/********************** Initializing the Plan ***********************/
+
+/*
+ * Fill in the loops done while transforming dimension i: the howmany
+ * dimensions and every transform dimension but i, ordered by
+ * decreasing output stride so that the innermost (last) loop has the
+ * smallest stride.
+ */
+static void init_loops(fftw_guru_plan p, int i)
+{
+     fftw_iodim *loops = p->loops + i * p->nloops;
+     int j, k, nl = 0;
+
+     for (j = 0; j < p->howmany_rank; ++j)
+	  loops[nl++] = p->howmany_dims[j];
+     for (j = 0; j < p->rank; ++j)
+	  if (j != i)
+	       loops[nl++] = p->dims[j];
+
+     /* insertion sort; there are never many loops */
+     for (j = 1; j < nl; ++j) {
+	  fftw_iodim t = loops[j];
+	  int s = p->is_in_place ? t.is : t.os;
+
+	  for (k = j; k > 0; --k) {
+	       int s0 = p->is_in_place ? loops[k - 1].is : loops[k - 1].os;
+
+	       if (ABS_STRIDE(s0) >= ABS_STRIDE(s))
+		    break;
+	       loops[k] = loops[k - 1];
+	  }
+	  loops[k] = t;
+     }
+}
+
+fftw_guru_plan fftw_create_guru_plan(int rank, const fftw_iodim *dims,
+				     int howmany_rank,
+				     const fftw_iodim *howmany_dims,
+				     fftw_direction dir, int flags)
+{
+     fftw_guru_plan p;
+     int *n;
+     int i, maxdim;
+
+     if (rank <= 0 || howmany_rank < 0)
+	  return 0;
+     for (i = 0; i < rank; ++i)
+	  if (dims[i].n <= 0)
+	       return 0;
+     for (i = 0; i < howmany_rank; ++i)
+	  if (howmany_dims[i].n <= 0)
+	       return 0;
+
+     p = (fftw_guru_plan) fftw_malloc(sizeof(fftw_guru_data));
+     p->is_in_place = flags & FFTW_IN_PLACE;
+     p->dir = dir;
+     p->rank = rank;
+     p->howmany_rank = howmany_rank;
+     p->nloops = howmany_rank + rank - 1;
+     p->dims = (fftw_iodim *) fftw_malloc(rank * sizeof(fftw_iodim));
+     p->howmany_dims = (fftw_iodim *)
+	 fftw_malloc((howmany_rank + 1) * sizeof(fftw_iodim));
+     p->loops = (fftw_iodim *)
+	 fftw_malloc((rank * p->nloops + 1) * sizeof(fftw_iodim));
+     p->work = 0;
+
+     n = (int *) fftw_malloc(rank * sizeof(int));
+     for (i = 0; i < rank; ++i) {
+	  p->dims[i] = dims[i];
+	  n[i] = dims[i].n;
+     }
+     for (i = 0; i < howmany_rank; ++i)
+	  p->howmany_dims[i] = howmany_dims[i];
+     for (i = 0; i < rank; ++i)
+	  init_loops(p, i);
+
+     p->plans = fftwnd_create_plans_generic(fftwnd_new_plan_array(rank),
+					    rank, n, dir, flags);
+     fftw_free(n);
+     if (!p->plans) {
+	  fftw_destroy_guru_plan(p);
+	  return 0;
+     }
+
+     /* scratch for the in-place plans, shared by all dimensions */
+     maxdim = 0;
+     for (i = 0; i < rank; ++i)
+	  if ((i < rank - 1 || p->is_in_place) && dims[i].n > maxdim)
+	       maxdim = dims[i].n;
+     if (maxdim > 0 && !(flags & FFTW_THREADSAFE))
+	  p->work = (fftw_complex *)
+	      fftw_malloc(maxdim * sizeof(fftw_complex));
+
+     return p;
+}
+
+/************************ Freeing the Plan ************************/
+
+void fftw_destroy_guru_plan(fftw_guru_plan plan)
+{
+     if (plan) {
+	  if (plan->plans) {
+	       int i, j;
+
+	       for (i = 0; i < plan->rank; ++i) {
+		    for (j = i - 1;
+			 j >= 0 && plan->plans[i] != plan->plans[j];
+			 --j);
+		    if (j < 0 && plan->plans[i])
+			 fftw_destroy_plan(plan->plans[i]);
+	       }
+	       fftw_free(plan->plans);
+	  }
+	  if (plan->work)
+	       fftw_free(plan->work);
+	  fftw_free(plan->loops);
+	  fftw_free(plan->howmany_dims);
+	  fftw_free(plan->dims);
+	  fftw_free(plan);
+     }
+}
+
+/************************ Printing the Plan ************************/
+
+void fftw_fprint_guru_plan(FILE *f, fftw_guru_plan plan)
+{
+     if (plan) {
+	  int i, j;
+
+	  fprintf(f, "guru plan for ");
+	  for (i = 0; i < plan->rank; ++i)
+	       fprintf(f, "%s%d", i ? "x" : "", plan->dims[i].n);
+	  fprintf(f, " transform");
+	  if (plan->howmany_rank > 0) {
+	       fprintf(f, " of ");
+	       for (i = 0; i < plan->howmany_rank; ++i)
+		    fprintf(f, "%s%d", i ? "x" : "",
+			    plan->howmany_dims[i].n);
+	       fprintf(f, " arrays");
+	  }
+	  fprintf(f, ":\n");
+
+	  for (i = 0; i < plan->rank; ++i) {
+	       fprintf(f, "* dimension %d (size %d, strides %d/%d) ", i,
+		       plan->dims[i].n, plan->dims[i].is, plan->dims[i].os);
+
+	       for (j = i - 1; j >= 0; --j)
+		    if (plan->plans[j] == plan->plans[i])
+			 break;
+
+	       if (j < 0)
+		    fftw_fprint_plan(f, plan->plans[i]);
+	       else
+		    fprintf(f, "plan is same as dimension %d plan.\n", j);
+	  }
+     }
+}
+
+/********************* Computing the Transform *********************/
+
+/*
+ * Transform dimension i of the data at in (to out), looping over
+ * loops[cur..nloops-1].  If in_place, the data is at in only, and
+ * every stride is taken from the array the data lives in.
+ */
+static void guru_aux(fftw_guru_plan p, int i, int cur,
+		     fftw_complex *in, fftw_complex *out, int in_place)
+{
+     fftw_iodim *d = p->dims + i;
+     fftw_iodim *loops = p->loops + i * p->nloops;
+     int use_is = p->is_in_place;
+
+     if (cur < p->nloops - 1) {
+	  fftw_iodim *l = loops + cur;
+	  int k, is, os;
+
+	  is = (in_place && !use_is) ? l->os : l->is;
+	  os = l->os;
+	  for (k = 0; k < l->n; ++k)
+	       guru_aux(p, i, cur + 1, in + k * is, out + k * os, in_place);
+     } else if (in_place) {
+	  int howmany = 1, dist = 0;
+
+	  if (p->nloops > 0) {
+	       howmany = loops[p->nloops - 1].n;
+	       dist = use_is ? loops[p->nloops - 1].is
+		   : loops[p->nloops - 1].os;
+	  }
+	  fftw(p->plans[i], howmany, in, use_is ? d->is : d->os, dist,
+	       p->work, 1, 0);
+     } else {
+	  int howmany = 1, idist = 0, odist = 0;
+
+	  if (p->nloops > 0) {
+	       howmany = loops[p->nloops - 1].n;
+	       idist = loops[p->nloops - 1].is;
+	       odist = loops[p->nloops - 1].os;
+	  }
+	  fftw(p->plans[i], howmany, in, d->is, idist, out, d->os, odist);
+     }
+}
+
+void fftw_guru(fftw_guru_plan plan, fftw_complex *in, fftw_complex *out)
+{
+     int i, last = plan->rank - 1;
+
+     if (plan->is_in_place)
+	  out = in;
+     else
+	  guru_aux(plan, last, 0, in, out, 0);
+
+     for (i = plan->is_in_place ? last : last - 1; i >= 0; --i)
+	  guru_aux(plan, i, 0, out, out, 1);
+}
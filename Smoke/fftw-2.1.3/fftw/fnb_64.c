@@ -0,0 +1,3491 @@
+/*
+ * Copyright (c) 1997-1999 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sun Nov  7 20:43:52 EST 1999 */
+
+#include <fftw-int.h>
+#include <fftw.h>
+
+/* Generated by: ./genfft -magic-alignment-check -magic-twiddle-load-all -magic-variables 4 -magic-loopi -notwiddle 64 */
+/* Batch version generated by: sh makebatch.sh fn_64.c */
+
+/*
+ * This function contains 912 FP additions, 248 FP multiplications,
+ * (or, 808 additions, 144 multiplications, 104 fused multiply/add),
+ * 156 stack variables, and 256 memory accesses
+ */
+static const fftw_real K555570233 = FFTW_KONST(+0.555570233019602224742830813948532874374937191);
+static const fftw_real K831469612 = FFTW_KONST(+0.831469612302545237078788377617905756738560812);
+static const fftw_real K881921264 = FFTW_KONST(+0.881921264348355029712756863660388349508442621);
+static const fftw_real K471396736 = FFTW_KONST(+0.471396736825997648556387625905254377657460319);
+static const fftw_real K290284677 = FFTW_KONST(+0.290284677254462367636192375817395274691476278);
+static const fftw_real K956940335 = FFTW_KONST(+0.956940335732208864935797886980269969482849206);
+static const fftw_real K980785280 = FFTW_KONST(+0.980785280403230449126182236134239036973933731);
+static const fftw_real K195090322 = FFTW_KONST(+0.195090322016128267848284868477022240927691618);
+static const fftw_real K995184726 = FFTW_KONST(+0.995184726672196886244836953109479921575474869);
+static const fftw_real K098017140 = FFTW_KONST(+0.098017140329560601994195563888641845861136673);
+static const fftw_real K773010453 = FFTW_KONST(+0.773010453362736960810906609758469800971041293);
+static const fftw_real K634393284 = FFTW_KONST(+0.634393284163645498215171613225493370675687095);
+static const fftw_real K923879532 = FFTW_KONST(+0.923879532511286756128183189396788286822416626);
+static const fftw_real K382683432 = FFTW_KONST(+0.382683432365089771728459984030398866761344562);
+static const fftw_real K707106781 = FFTW_KONST(+0.707106781186547524400844362104849039284835938);
+
+/*
+ * Generator Id's : 
+ * $Id: exprdag.ml,v 1.41 1999/05/26 15:44:14 fftw Exp $
+ * $Id: fft.ml,v 1.43 1999/05/17 19:44:18 fftw Exp $
+ * $Id: to_c.ml,v 1.25 1999/10/26 21:41:32 stevenj Exp $
+ */
+
+void fftw_no_twiddle_batch_64(const fftw_complex *input, fftw_complex *output, int istride, int ostride, int idist, int odist)
+{
+     int l;
+     fftw_real tmp193[FFTW_BATCH_LANES];
+     fftw_real tmp471[FFTW_BATCH_LANES];
+     fftw_real tmp15[FFTW_BATCH_LANES];
+     fftw_real tmp815[FFTW_BATCH_LANES];
+     fftw_real tmp719[FFTW_BATCH_LANES];
+     fftw_real tmp781[FFTW_BATCH_LANES];
+     fftw_real tmp142[FFTW_BATCH_LANES];
+     fftw_real tmp849[FFTW_BATCH_LANES];
+     fftw_real tmp371[FFTW_BATCH_LANES];
+     fftw_real tmp537[FFTW_BATCH_LANES];
+     fftw_real tmp637[FFTW_BATCH_LANES];
+     fftw_real tmp755[FFTW_BATCH_LANES];
+     fftw_real tmp200[FFTW_BATCH_LANES];
+     fftw_real tmp538[FFTW_BATCH_LANES];
+     fftw_real tmp374[FFTW_BATCH_LANES];
+     fftw_real tmp472[FFTW_BATCH_LANES];
+     fftw_real tmp109[FFTW_BATCH_LANES];
+     fftw_real tmp837[FFTW_BATCH_LANES];
+     fftw_real tmp693[FFTW_BATCH_LANES];
+     fftw_real tmp773[FFTW_BATCH_LANES];
+     fftw_real tmp844[FFTW_BATCH_LANES];
+     fftw_real tmp892[FFTW_BATCH_LANES];
+     fftw_real tmp710[FFTW_BATCH_LANES];
+     fftw_real tmp776[FFTW_BATCH_LANES];
+     fftw_real tmp329[FFTW_BATCH_LANES];
+     fftw_real tmp429[FFTW_BATCH_LANES];
+     fftw_real tmp519[FFTW_BATCH_LANES];
+     fftw_real tmp593[FFTW_BATCH_LANES];
+     fftw_real tmp362[FFTW_BATCH_LANES];
+     fftw_real tmp432[FFTW_BATCH_LANES];
+     fftw_real tmp530[FFTW_BATCH_LANES];
+     fftw_real tmp596[FFTW_BATCH_LANES];
+     fftw_real tmp30[FFTW_BATCH_LANES];
+     fftw_real tmp850[FFTW_BATCH_LANES];
+     fftw_real tmp640[FFTW_BATCH_LANES];
+     fftw_real tmp721[FFTW_BATCH_LANES];
+     fftw_real tmp157[FFTW_BATCH_LANES];
+     fftw_real tmp816[FFTW_BATCH_LANES];
+     fftw_real tmp643[FFTW_BATCH_LANES];
+     fftw_real tmp720[FFTW_BATCH_LANES];
+     fftw_real tmp208[FFTW_BATCH_LANES];
+     fftw_real tmp377[FFTW_BATCH_LANES];
+     fftw_real tmp476[FFTW_BATCH_LANES];
+     fftw_real tmp541[FFTW_BATCH_LANES];
+     fftw_real tmp215[FFTW_BATCH_LANES];
+     fftw_real tmp376[FFTW_BATCH_LANES];
+     fftw_real tmp479[FFTW_BATCH_LANES];
+     fftw_real tmp540[FFTW_BATCH_LANES];
+     fftw_real tmp124[FFTW_BATCH_LANES];
+     fftw_real tmp845[FFTW_BATCH_LANES];
+     fftw_real tmp365[FFTW_BATCH_LANES];
+     fftw_real tmp430[FFTW_BATCH_LANES];
+     fftw_real tmp352[FFTW_BATCH_LANES];
+     fftw_real tmp433[FFTW_BATCH_LANES];
+     fftw_real tmp840[FFTW_BATCH_LANES];
+     fftw_real tmp893[FFTW_BATCH_LANES];
+     fftw_real tmp526[FFTW_BATCH_LANES];
+     fftw_real tmp597[FFTW_BATCH_LANES];
+     fftw_real tmp533[FFTW_BATCH_LANES];
+     fftw_real tmp594[FFTW_BATCH_LANES];
+     fftw_real tmp704[FFTW_BATCH_LANES];
+     fftw_real tmp777[FFTW_BATCH_LANES];
+     fftw_real tmp713[FFTW_BATCH_LANES];
+     fftw_real tmp774[FFTW_BATCH_LANES];
+     fftw_real tmp46[FFTW_BATCH_LANES];
+     fftw_real tmp819[FFTW_BATCH_LANES];
+     fftw_real tmp648[FFTW_BATCH_LANES];
+     fftw_real tmp758[FFTW_BATCH_LANES];
+     fftw_real tmp173[FFTW_BATCH_LANES];
+     fftw_real tmp818[FFTW_BATCH_LANES];
+     fftw_real tmp651[FFTW_BATCH_LANES];
+     fftw_real tmp759[FFTW_BATCH_LANES];
+     fftw_real tmp228[FFTW_BATCH_LANES];
+     fftw_real tmp414[FFTW_BATCH_LANES];
+     fftw_real tmp484[FFTW_BATCH_LANES];
+     fftw_real tmp578[FFTW_BATCH_LANES];
+     fftw_real tmp235[FFTW_BATCH_LANES];
+     fftw_real tmp415[FFTW_BATCH_LANES];
+     fftw_real tmp487[FFTW_BATCH_LANES];
+     fftw_real tmp579[FFTW_BATCH_LANES];
+     fftw_real tmp78[FFTW_BATCH_LANES];
+     fftw_real tmp831[FFTW_BATCH_LANES];
+     fftw_real tmp666[FFTW_BATCH_LANES];
+     fftw_real tmp769[FFTW_BATCH_LANES];
+     fftw_real tmp828[FFTW_BATCH_LANES];
+     fftw_real tmp887[FFTW_BATCH_LANES];
+     fftw_real tmp683[FFTW_BATCH_LANES];
+     fftw_real tmp766[FFTW_BATCH_LANES];
+     fftw_real tmp274[FFTW_BATCH_LANES];
+     fftw_real tmp425[FFTW_BATCH_LANES];
+     fftw_real tmp500[FFTW_BATCH_LANES];
+     fftw_real tmp589[FFTW_BATCH_LANES];
+     fftw_real tmp307[FFTW_BATCH_LANES];
+     fftw_real tmp422[FFTW_BATCH_LANES];
+     fftw_real tmp511[FFTW_BATCH_LANES];
+     fftw_real tmp586[FFTW_BATCH_LANES];
+     fftw_real tmp61[FFTW_BATCH_LANES];
+     fftw_real tmp821[FFTW_BATCH_LANES];
+     fftw_real tmp655[FFTW_BATCH_LANES];
+     fftw_real tmp761[FFTW_BATCH_LANES];
+     fftw_real tmp188[FFTW_BATCH_LANES];
+     fftw_real tmp822[FFTW_BATCH_LANES];
+     fftw_real tmp658[FFTW_BATCH_LANES];
+     fftw_real tmp762[FFTW_BATCH_LANES];
+     fftw_real tmp247[FFTW_BATCH_LANES];
+     fftw_real tmp417[FFTW_BATCH_LANES];
+     fftw_real tmp491[FFTW_BATCH_LANES];
+     fftw_real tmp581[FFTW_BATCH_LANES];
+     fftw_real tmp254[FFTW_BATCH_LANES];
+     fftw_real tmp418[FFTW_BATCH_LANES];
+     fftw_real tmp494[FFTW_BATCH_LANES];
+     fftw_real tmp582[FFTW_BATCH_LANES];
+     fftw_real tmp93[FFTW_BATCH_LANES];
+     fftw_real tmp829[FFTW_BATCH_LANES];
+     fftw_real tmp310[FFTW_BATCH_LANES];
+     fftw_real tmp426[FFTW_BATCH_LANES];
+     fftw_real tmp297[FFTW_BATCH_LANES];
+     fftw_real tmp423[FFTW_BATCH_LANES];
+     fftw_real tmp834[FFTW_BATCH_LANES];
+     fftw_real tmp888[FFTW_BATCH_LANES];
+     fftw_real tmp507[FFTW_BATCH_LANES];
+     fftw_real tmp587[FFTW_BATCH_LANES];
+     fftw_real tmp514[FFTW_BATCH_LANES];
+     fftw_real tmp590[FFTW_BATCH_LANES];
+     fftw_real tmp677[FFTW_BATCH_LANES];
+     fftw_real tmp767[FFTW_BATCH_LANES];
+     fftw_real tmp686[FFTW_BATCH_LANES];
+     fftw_real tmp770[FFTW_BATCH_LANES];
+     ASSERT_ALIGNED_DOUBLE;
+     {
+	  fftw_real tmp3[FFTW_BATCH_LANES];
+	  fftw_real tmp191[FFTW_BATCH_LANES];
+	  fftw_real tmp130[FFTW_BATCH_LANES];
+	  fftw_real tmp370[FFTW_BATCH_LANES];
+	  fftw_real tmp6[FFTW_BATCH_LANES];
+	  fftw_real tmp369[FFTW_BATCH_LANES];
+	  fftw_real tmp133[FFTW_BATCH_LANES];
+	  fftw_real tmp192[FFTW_BATCH_LANES];
+	  fftw_real tmp10[FFTW_BATCH_LANES];
+	  fftw_real tmp195[FFTW_BATCH_LANES];
+	  fftw_real tmp137[FFTW_BATCH_LANES];
+	  fftw_real tmp194[FFTW_BATCH_LANES];
+	  fftw_real tmp13[FFTW_BATCH_LANES];
+	  fftw_real tmp197[FFTW_BATCH_LANES];
+	  fftw_real tmp140[FFTW_BATCH_LANES];
+	  fftw_real tmp198[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp1[FFTW_BATCH_LANES];
+	       fftw_real tmp2[FFTW_BATCH_LANES];
+	       fftw_real tmp128[FFTW_BATCH_LANES];
+	       fftw_real tmp129[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp1[l] = c_re(input[l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp2[l] = c_re(input[32 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp3[l] = tmp1[l] + tmp2[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp191[l] = tmp1[l] - tmp2[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp128[l] = c_im(input[l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp129[l] = c_im(input[32 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp130[l] = tmp128[l] + tmp129[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp370[l] = tmp128[l] - tmp129[l];
+	  }
+	  {
+	       fftw_real tmp4[FFTW_BATCH_LANES];
+	       fftw_real tmp5[FFTW_BATCH_LANES];
+	       fftw_real tmp131[FFTW_BATCH_LANES];
+	       fftw_real tmp132[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp4[l] = c_re(input[16 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp5[l] = c_re(input[48 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp6[l] = tmp4[l] + tmp5[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp369[l] = tmp4[l] - tmp5[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp131[l] = c_im(input[16 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp132[l] = c_im(input[48 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp133[l] = tmp131[l] + tmp132[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp192[l] = tmp131[l] - tmp132[l];
+	  }
+	  {
+	       fftw_real tmp8[FFTW_BATCH_LANES];
+	       fftw_real tmp9[FFTW_BATCH_LANES];
+	       fftw_real tmp135[FFTW_BATCH_LANES];
+	       fftw_real tmp136[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp8[l] = c_re(input[8 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp9[l] = c_re(input[40 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp10[l] = tmp8[l] + tmp9[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp195[l] = tmp8[l] - tmp9[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp135[l] = c_im(input[8 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp136[l] = c_im(input[40 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp137[l] = tmp135[l] + tmp136[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp194[l] = tmp135[l] - tmp136[l];
+	  }
+	  {
+	       fftw_real tmp11[FFTW_BATCH_LANES];
+	       fftw_real tmp12[FFTW_BATCH_LANES];
+	       fftw_real tmp138[FFTW_BATCH_LANES];
+	       fftw_real tmp139[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp11[l] = c_re(input[56 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp12[l] = c_re(input[24 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp13[l] = tmp11[l] + tmp12[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp197[l] = tmp11[l] - tmp12[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp138[l] = c_im(input[56 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp139[l] = c_im(input[24 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp140[l] = tmp138[l] + tmp139[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp198[l] = tmp138[l] - tmp139[l];
+	  }
+	  {
+	       fftw_real tmp7[FFTW_BATCH_LANES];
+	       fftw_real tmp14[FFTW_BATCH_LANES];
+	       fftw_real tmp635[FFTW_BATCH_LANES];
+	       fftw_real tmp636[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp193[l] = tmp191[l] - tmp192[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp471[l] = tmp191[l] + tmp192[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp7[l] = tmp3[l] + tmp6[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp14[l] = tmp10[l] + tmp13[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp15[l] = tmp7[l] + tmp14[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp815[l] = tmp7[l] - tmp14[l];
+	       {
+		    fftw_real tmp717[FFTW_BATCH_LANES];
+		    fftw_real tmp718[FFTW_BATCH_LANES];
+		    fftw_real tmp134[FFTW_BATCH_LANES];
+		    fftw_real tmp141[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp717[l] = tmp130[l] - tmp133[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp718[l] = tmp13[l] - tmp10[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp719[l] = tmp717[l] - tmp718[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp781[l] = tmp718[l] + tmp717[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp134[l] = tmp130[l] + tmp133[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp141[l] = tmp137[l] + tmp140[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp142[l] = tmp134[l] + tmp141[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp849[l] = tmp134[l] - tmp141[l];
+	       }
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp371[l] = tmp369[l] + tmp370[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp537[l] = tmp370[l] - tmp369[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp635[l] = tmp3[l] - tmp6[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp636[l] = tmp137[l] - tmp140[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp637[l] = tmp635[l] - tmp636[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp755[l] = tmp635[l] + tmp636[l];
+	       {
+		    fftw_real tmp196[FFTW_BATCH_LANES];
+		    fftw_real tmp199[FFTW_BATCH_LANES];
+		    fftw_real tmp372[FFTW_BATCH_LANES];
+		    fftw_real tmp373[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp196[l] = tmp194[l] - tmp195[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp199[l] = tmp197[l] + tmp198[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp200[l] = K707106781 * (tmp196[l] - tmp199[l]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp538[l] = K707106781 * (tmp196[l] + tmp199[l]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp372[l] = tmp197[l] - tmp198[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp373[l] = tmp195[l] + tmp194[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp374[l] = K707106781 * (tmp372[l] - tmp373[l]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp472[l] = K707106781 * (tmp373[l] + tmp372[l]);
+	       }
+	  }
+     }
+     {
+	  fftw_real tmp97[FFTW_BATCH_LANES];
+	  fftw_real tmp313[FFTW_BATCH_LANES];
+	  fftw_real tmp357[FFTW_BATCH_LANES];
+	  fftw_real tmp706[FFTW_BATCH_LANES];
+	  fftw_real tmp100[FFTW_BATCH_LANES];
+	  fftw_real tmp354[FFTW_BATCH_LANES];
+	  fftw_real tmp316[FFTW_BATCH_LANES];
+	  fftw_real tmp707[FFTW_BATCH_LANES];
+	  fftw_real tmp107[FFTW_BATCH_LANES];
+	  fftw_real tmp691[FFTW_BATCH_LANES];
+	  fftw_real tmp327[FFTW_BATCH_LANES];
+	  fftw_real tmp359[FFTW_BATCH_LANES];
+	  fftw_real tmp104[FFTW_BATCH_LANES];
+	  fftw_real tmp690[FFTW_BATCH_LANES];
+	  fftw_real tmp322[FFTW_BATCH_LANES];
+	  fftw_real tmp360[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp95[FFTW_BATCH_LANES];
+	       fftw_real tmp96[FFTW_BATCH_LANES];
+	       fftw_real tmp314[FFTW_BATCH_LANES];
+	       fftw_real tmp315[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp95[l] = c_re(input[63 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp96[l] = c_re(input[31 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp97[l] = tmp95[l] + tmp96[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp313[l] = tmp95[l] - tmp96[l];
+	       {
+		    fftw_real tmp355[FFTW_BATCH_LANES];
+		    fftw_real tmp356[FFTW_BATCH_LANES];
+		    fftw_real tmp98[FFTW_BATCH_LANES];
+		    fftw_real tmp99[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp355[l] = c_im(input[63 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp356[l] = c_im(input[31 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp357[l] = tmp355[l] - tmp356[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp706[l] = tmp355[l] + tmp356[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp98[l] = c_re(input[15 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp99[l] = c_re(input[47 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp100[l] = tmp98[l] + tmp99[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp354[l] = tmp98[l] - tmp99[l];
+	       }
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp314[l] = c_im(input[15 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp315[l] = c_im(input[47 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp316[l] = tmp314[l] - tmp315[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp707[l] = tmp314[l] + tmp315[l];
+	       {
+		    fftw_real tmp105[FFTW_BATCH_LANES];
+		    fftw_real tmp106[FFTW_BATCH_LANES];
+		    fftw_real tmp323[FFTW_BATCH_LANES];
+		    fftw_real tmp324[FFTW_BATCH_LANES];
+		    fftw_real tmp325[FFTW_BATCH_LANES];
+		    fftw_real tmp326[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp105[l] = c_re(input[55 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp106[l] = c_re(input[23 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp323[l] = tmp105[l] - tmp106[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp324[l] = c_im(input[55 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp325[l] = c_im(input[23 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp326[l] = tmp324[l] - tmp325[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp107[l] = tmp105[l] + tmp106[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp691[l] = tmp324[l] + tmp325[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp327[l] = tmp323[l] + tmp326[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp359[l] = tmp323[l] - tmp326[l];
+	       }
+	       {
+		    fftw_real tmp102[FFTW_BATCH_LANES];
+		    fftw_real tmp103[FFTW_BATCH_LANES];
+		    fftw_real tmp321[FFTW_BATCH_LANES];
+		    fftw_real tmp318[FFTW_BATCH_LANES];
+		    fftw_real tmp319[FFTW_BATCH_LANES];
+		    fftw_real tmp320[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp102[l] = c_re(input[7 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp103[l] = c_re(input[39 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp321[l] = tmp102[l] - tmp103[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp318[l] = c_im(input[7 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp319[l] = c_im(input[39 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp320[l] = tmp318[l] - tmp319[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp104[l] = tmp102[l] + tmp103[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp690[l] = tmp318[l] + tmp319[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp322[l] = tmp320[l] - tmp321[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp360[l] = tmp321[l] + tmp320[l];
+	       }
+	  }
+	  {
+	       fftw_real tmp101[FFTW_BATCH_LANES];
+	       fftw_real tmp108[FFTW_BATCH_LANES];
+	       fftw_real tmp689[FFTW_BATCH_LANES];
+	       fftw_real tmp692[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp101[l] = tmp97[l] + tmp100[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp108[l] = tmp104[l] + tmp107[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp109[l] = tmp101[l] + tmp108[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp837[l] = tmp101[l] - tmp108[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp689[l] = tmp97[l] - tmp100[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp692[l] = tmp690[l] - tmp691[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp693[l] = tmp689[l] - tmp692[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp773[l] = tmp689[l] + tmp692[l];
+	  }
+	  {
+	       fftw_real tmp842[FFTW_BATCH_LANES];
+	       fftw_real tmp843[FFTW_BATCH_LANES];
+	       fftw_real tmp708[FFTW_BATCH_LANES];
+	       fftw_real tmp709[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp842[l] = tmp706[l] + tmp707[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp843[l] = tmp690[l] + tmp691[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp844[l] = tmp842[l] - tmp843[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp892[l] = tmp842[l] + tmp843[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp708[l] = tmp706[l] - tmp707[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp709[l] = tmp107[l] - tmp104[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp710[l] = tmp708[l] - tmp709[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp776[l] = tmp709[l] + tmp708[l];
+	  }
+	  {
+	       fftw_real tmp317[FFTW_BATCH_LANES];
+	       fftw_real tmp328[FFTW_BATCH_LANES];
+	       fftw_real tmp517[FFTW_BATCH_LANES];
+	       fftw_real tmp518[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp317[l] = tmp313[l] - tmp316[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp328[l] = K707106781 * (tmp322[l] - tmp327[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp329[l] = tmp317[l] - tmp328[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp429[l] = tmp317[l] + tmp328[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp517[l] = tmp313[l] + tmp316[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp518[l] = K707106781 * (tmp360[l] + tmp359[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp519[l] = tmp517[l] - tmp518[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp593[l] = tmp517[l] + tmp518[l];
+	  }
+	  {
+	       fftw_real tmp358[FFTW_BATCH_LANES];
+	       fftw_real tmp361[FFTW_BATCH_LANES];
+	       fftw_real tmp528[FFTW_BATCH_LANES];
+	       fftw_real tmp529[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp358[l] = tmp354[l] + tmp357[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp361[l] = K707106781 * (tmp359[l] - tmp360[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp362[l] = tmp358[l] - tmp361[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp432[l] = tmp358[l] + tmp361[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp528[l] = tmp357[l] - tmp354[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp529[l] = K707106781 * (tmp322[l] + tmp327[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp530[l] = tmp528[l] - tmp529[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp596[l] = tmp528[l] + tmp529[l];
+	  }
+     }
+     {
+	  fftw_real tmp18[FFTW_BATCH_LANES];
+	  fftw_real tmp205[FFTW_BATCH_LANES];
+	  fftw_real tmp145[FFTW_BATCH_LANES];
+	  fftw_real tmp203[FFTW_BATCH_LANES];
+	  fftw_real tmp21[FFTW_BATCH_LANES];
+	  fftw_real tmp202[FFTW_BATCH_LANES];
+	  fftw_real tmp148[FFTW_BATCH_LANES];
+	  fftw_real tmp206[FFTW_BATCH_LANES];
+	  fftw_real tmp25[FFTW_BATCH_LANES];
+	  fftw_real tmp212[FFTW_BATCH_LANES];
+	  fftw_real tmp152[FFTW_BATCH_LANES];
+	  fftw_real tmp210[FFTW_BATCH_LANES];
+	  fftw_real tmp28[FFTW_BATCH_LANES];
+	  fftw_real tmp209[FFTW_BATCH_LANES];
+	  fftw_real tmp155[FFTW_BATCH_LANES];
+	  fftw_real tmp213[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp16[FFTW_BATCH_LANES];
+	       fftw_real tmp17[FFTW_BATCH_LANES];
+	       fftw_real tmp143[FFTW_BATCH_LANES];
+	       fftw_real tmp144[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp16[l] = c_re(input[4 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp17[l] = c_re(input[36 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp18[l] = tmp16[l] + tmp17[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp205[l] = tmp16[l] - tmp17[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp143[l] = c_im(input[4 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp144[l] = c_im(input[36 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp145[l] = tmp143[l] + tmp144[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp203[l] = tmp143[l] - tmp144[l];
+	  }
+	  {
+	       fftw_real tmp19[FFTW_BATCH_LANES];
+	       fftw_real tmp20[FFTW_BATCH_LANES];
+	       fftw_real tmp146[FFTW_BATCH_LANES];
+	       fftw_real tmp147[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp19[l] = c_re(input[20 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp20[l] = c_re(input[52 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp21[l] = tmp19[l] + tmp20[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp202[l] = tmp19[l] - tmp20[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp146[l] = c_im(input[20 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp147[l] = c_im(input[52 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp148[l] = tmp146[l] + tmp147[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp206[l] = tmp146[l] - tmp147[l];
+	  }
+	  {
+	       fftw_real tmp23[FFTW_BATCH_LANES];
+	       fftw_real tmp24[FFTW_BATCH_LANES];
+	       fftw_real tmp150[FFTW_BATCH_LANES];
+	       fftw_real tmp151[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp23[l] = c_re(input[60 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp24[l] = c_re(input[28 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp25[l] = tmp23[l] + tmp24[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp212[l] = tmp23[l] - tmp24[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp150[l] = c_im(input[60 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp151[l] = c_im(input[28 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp152[l] = tmp150[l] + tmp151[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp210[l] = tmp150[l] - tmp151[l];
+	  }
+	  {
+	       fftw_real tmp26[FFTW_BATCH_LANES];
+	       fftw_real tmp27[FFTW_BATCH_LANES];
+	       fftw_real tmp153[FFTW_BATCH_LANES];
+	       fftw_real tmp154[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp26[l] = c_re(input[12 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp27[l] = c_re(input[44 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp28[l] = tmp26[l] + tmp27[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp209[l] = tmp26[l] - tmp27[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp153[l] = c_im(input[12 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp154[l] = c_im(input[44 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp155[l] = tmp153[l] + tmp154[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp213[l] = tmp153[l] - tmp154[l];
+	  }
+	  {
+	       fftw_real tmp22[FFTW_BATCH_LANES];
+	       fftw_real tmp29[FFTW_BATCH_LANES];
+	       fftw_real tmp638[FFTW_BATCH_LANES];
+	       fftw_real tmp639[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp22[l] = tmp18[l] + tmp21[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp29[l] = tmp25[l] + tmp28[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp30[l] = tmp22[l] + tmp29[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp850[l] = tmp29[l] - tmp22[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp638[l] = tmp145[l] - tmp148[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp639[l] = tmp18[l] - tmp21[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp640[l] = tmp638[l] - tmp639[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp721[l] = tmp639[l] + tmp638[l];
+	  }
+	  {
+	       fftw_real tmp149[FFTW_BATCH_LANES];
+	       fftw_real tmp156[FFTW_BATCH_LANES];
+	       fftw_real tmp641[FFTW_BATCH_LANES];
+	       fftw_real tmp642[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp149[l] = tmp145[l] + tmp148[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp156[l] = tmp152[l] + tmp155[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp157[l] = tmp149[l] + tmp156[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp816[l] = tmp149[l] - tmp156[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp641[l] = tmp25[l] - tmp28[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp642[l] = tmp152[l] - tmp155[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp643[l] = tmp641[l] + tmp642[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp720[l] = tmp641[l] - tmp642[l];
+	  }
+	  {
+	       fftw_real tmp204[FFTW_BATCH_LANES];
+	       fftw_real tmp207[FFTW_BATCH_LANES];
+	       fftw_real tmp474[FFTW_BATCH_LANES];
+	       fftw_real tmp475[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp204[l] = tmp202[l] + tmp203[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp207[l] = tmp205[l] - tmp206[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp208[l] = (K382683432 * tmp204[l]) - (K923879532 * tmp207[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp377[l] = (K923879532 * tmp204[l]) + (K382683432 * tmp207[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp474[l] = tmp203[l] - tmp202[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp475[l] = tmp205[l] + tmp206[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp476[l] = (K923879532 * tmp474[l]) - (K382683432 * tmp475[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp541[l] = (K382683432 * tmp474[l]) + (K923879532 * tmp475[l]);
+	  }
+	  {
+	       fftw_real tmp211[FFTW_BATCH_LANES];
+	       fftw_real tmp214[FFTW_BATCH_LANES];
+	       fftw_real tmp477[FFTW_BATCH_LANES];
+	       fftw_real tmp478[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp211[l] = tmp209[l] + tmp210[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp214[l] = tmp212[l] - tmp213[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp215[l] = (K382683432 * tmp211[l]) + (K923879532 * tmp214[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp376[l] = (K382683432 * tmp214[l]) - (K923879532 * tmp211[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp477[l] = tmp210[l] - tmp209[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp478[l] = tmp212[l] + tmp213[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp479[l] = (K923879532 * tmp477[l]) + (K382683432 * tmp478[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp540[l] = (K923879532 * tmp478[l]) - (K382683432 * tmp477[l]);
+	  }
+     }
+     {
+	  fftw_real tmp112[FFTW_BATCH_LANES];
+	  fftw_real tmp694[FFTW_BATCH_LANES];
+	  fftw_real tmp115[FFTW_BATCH_LANES];
+	  fftw_real tmp695[FFTW_BATCH_LANES];
+	  fftw_real tmp334[FFTW_BATCH_LANES];
+	  fftw_real tmp520[FFTW_BATCH_LANES];
+	  fftw_real tmp339[FFTW_BATCH_LANES];
+	  fftw_real tmp521[FFTW_BATCH_LANES];
+	  fftw_real tmp697[FFTW_BATCH_LANES];
+	  fftw_real tmp696[FFTW_BATCH_LANES];
+	  fftw_real tmp119[FFTW_BATCH_LANES];
+	  fftw_real tmp700[FFTW_BATCH_LANES];
+	  fftw_real tmp122[FFTW_BATCH_LANES];
+	  fftw_real tmp701[FFTW_BATCH_LANES];
+	  fftw_real tmp345[FFTW_BATCH_LANES];
+	  fftw_real tmp523[FFTW_BATCH_LANES];
+	  fftw_real tmp350[FFTW_BATCH_LANES];
+	  fftw_real tmp524[FFTW_BATCH_LANES];
+	  fftw_real tmp702[FFTW_BATCH_LANES];
+	  fftw_real tmp699[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp335[FFTW_BATCH_LANES];
+	       fftw_real tmp333[FFTW_BATCH_LANES];
+	       fftw_real tmp330[FFTW_BATCH_LANES];
+	       fftw_real tmp338[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       {
+		    fftw_real tmp110[FFTW_BATCH_LANES];
+		    fftw_real tmp111[FFTW_BATCH_LANES];
+		    fftw_real tmp331[FFTW_BATCH_LANES];
+		    fftw_real tmp332[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp110[l] = c_re(input[3 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp111[l] = c_re(input[35 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp112[l] = tmp110[l] + tmp111[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp335[l] = tmp110[l] - tmp111[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp331[l] = c_im(input[3 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp332[l] = c_im(input[35 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp333[l] = tmp331[l] - tmp332[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp694[l] = tmp331[l] + tmp332[l];
+	       }
+	       {
+		    fftw_real tmp113[FFTW_BATCH_LANES];
+		    fftw_real tmp114[FFTW_BATCH_LANES];
+		    fftw_real tmp336[FFTW_BATCH_LANES];
+		    fftw_real tmp337[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp113[l] = c_re(input[19 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp114[l] = c_re(input[51 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp115[l] = tmp113[l] + tmp114[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp330[l] = tmp113[l] - tmp114[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp336[l] = c_im(input[19 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp337[l] = c_im(input[51 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp338[l] = tmp336[l] - tmp337[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp695[l] = tmp336[l] + tmp337[l];
+	       }
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp334[l] = tmp330[l] + tmp333[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp520[l] = tmp333[l] - tmp330[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp339[l] = tmp335[l] - tmp338[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp521[l] = tmp335[l] + tmp338[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp697[l] = tmp112[l] - tmp115[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp696[l] = tmp694[l] - tmp695[l];
+	  }
+	  {
+	       fftw_real tmp346[FFTW_BATCH_LANES];
+	       fftw_real tmp344[FFTW_BATCH_LANES];
+	       fftw_real tmp341[FFTW_BATCH_LANES];
+	       fftw_real tmp349[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       {
+		    fftw_real tmp117[FFTW_BATCH_LANES];
+		    fftw_real tmp118[FFTW_BATCH_LANES];
+		    fftw_real tmp342[FFTW_BATCH_LANES];
+		    fftw_real tmp343[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp117[l] = c_re(input[59 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp118[l] = c_re(input[27 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp119[l] = tmp117[l] + tmp118[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp346[l] = tmp117[l] - tmp118[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp342[l] = c_im(input[59 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp343[l] = c_im(input[27 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp344[l] = tmp342[l] - tmp343[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp700[l] = tmp342[l] + tmp343[l];
+	       }
+	       {
+		    fftw_real tmp120[FFTW_BATCH_LANES];
+		    fftw_real tmp121[FFTW_BATCH_LANES];
+		    fftw_real tmp347[FFTW_BATCH_LANES];
+		    fftw_real tmp348[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp120[l] = c_re(input[11 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp121[l] = c_re(input[43 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp122[l] = tmp120[l] + tmp121[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp341[l] = tmp120[l] - tmp121[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp347[l] = c_im(input[11 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp348[l] = c_im(input[43 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp349[l] = tmp347[l] - tmp348[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp701[l] = tmp347[l] + tmp348[l];
+	       }
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp345[l] = tmp341[l] + tmp344[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp523[l] = tmp344[l] - tmp341[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp350[l] = tmp346[l] - tmp349[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp524[l] = tmp346[l] + tmp349[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp702[l] = tmp700[l] - tmp701[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp699[l] = tmp119[l] - tmp122[l];
+	  }
+	  {
+	       fftw_real tmp116[FFTW_BATCH_LANES];
+	       fftw_real tmp123[FFTW_BATCH_LANES];
+	       fftw_real tmp363[FFTW_BATCH_LANES];
+	       fftw_real tmp364[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp116[l] = tmp112[l] + tmp115[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp123[l] = tmp119[l] + tmp122[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp124[l] = tmp116[l] + tmp123[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp845[l] = tmp123[l] - tmp116[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp363[l] = (K382683432 * tmp350[l]) - (K923879532 * tmp345[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp364[l] = (K923879532 * tmp334[l]) + (K382683432 * tmp339[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp365[l] = tmp363[l] - tmp364[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp430[l] = tmp364[l] + tmp363[l];
+	  }
+	  {
+	       fftw_real tmp340[FFTW_BATCH_LANES];
+	       fftw_real tmp351[FFTW_BATCH_LANES];
+	       fftw_real tmp838[FFTW_BATCH_LANES];
+	       fftw_real tmp839[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp340[l] = (K382683432 * tmp334[l]) - (K923879532 * tmp339[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp351[l] = (K382683432 * tmp345[l]) + (K923879532 * tmp350[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp352[l] = tmp340[l] - tmp351[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp433[l] = tmp340[l] + tmp351[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp838[l] = tmp694[l] + tmp695[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp839[l] = tmp700[l] + tmp701[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp840[l] = tmp838[l] - tmp839[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp893[l] = tmp838[l] + tmp839[l];
+	  }
+	  {
+	       fftw_real tmp522[FFTW_BATCH_LANES];
+	       fftw_real tmp525[FFTW_BATCH_LANES];
+	       fftw_real tmp531[FFTW_BATCH_LANES];
+	       fftw_real tmp532[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp522[l] = (K923879532 * tmp520[l]) - (K382683432 * tmp521[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp525[l] = (K923879532 * tmp523[l]) + (K382683432 * tmp524[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp526[l] = tmp522[l] - tmp525[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp597[l] = tmp522[l] + tmp525[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp531[l] = (K923879532 * tmp524[l]) - (K382683432 * tmp523[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp532[l] = (K382683432 * tmp520[l]) + (K923879532 * tmp521[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp533[l] = tmp531[l] - tmp532[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp594[l] = tmp532[l] + tmp531[l];
+	  }
+	  {
+	       fftw_real tmp698[FFTW_BATCH_LANES];
+	       fftw_real tmp703[FFTW_BATCH_LANES];
+	       fftw_real tmp711[FFTW_BATCH_LANES];
+	       fftw_real tmp712[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp698[l] = tmp696[l] - tmp697[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp703[l] = tmp699[l] + tmp702[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp704[l] = K707106781 * (tmp698[l] - tmp703[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp777[l] = K707106781 * (tmp698[l] + tmp703[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp711[l] = tmp699[l] - tmp702[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp712[l] = tmp697[l] + tmp696[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp713[l] = K707106781 * (tmp711[l] - tmp712[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp774[l] = K707106781 * (tmp712[l] + tmp711[l]);
+	  }
+     }
+     {
+	  fftw_real tmp34[FFTW_BATCH_LANES];
+	  fftw_real tmp229[FFTW_BATCH_LANES];
+	  fftw_real tmp161[FFTW_BATCH_LANES];
+	  fftw_real tmp219[FFTW_BATCH_LANES];
+	  fftw_real tmp37[FFTW_BATCH_LANES];
+	  fftw_real tmp218[FFTW_BATCH_LANES];
+	  fftw_real tmp164[FFTW_BATCH_LANES];
+	  fftw_real tmp230[FFTW_BATCH_LANES];
+	  fftw_real tmp44[FFTW_BATCH_LANES];
+	  fftw_real tmp233[FFTW_BATCH_LANES];
+	  fftw_real tmp223[FFTW_BATCH_LANES];
+	  fftw_real tmp171[FFTW_BATCH_LANES];
+	  fftw_real tmp41[FFTW_BATCH_LANES];
+	  fftw_real tmp232[FFTW_BATCH_LANES];
+	  fftw_real tmp226[FFTW_BATCH_LANES];
+	  fftw_real tmp168[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp32[FFTW_BATCH_LANES];
+	       fftw_real tmp33[FFTW_BATCH_LANES];
+	       fftw_real tmp162[FFTW_BATCH_LANES];
+	       fftw_real tmp163[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp32[l] = c_re(input[2 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp33[l] = c_re(input[34 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp34[l] = tmp32[l] + tmp33[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp229[l] = tmp32[l] - tmp33[l];
+	       {
+		    fftw_real tmp159[FFTW_BATCH_LANES];
+		    fftw_real tmp160[FFTW_BATCH_LANES];
+		    fftw_real tmp35[FFTW_BATCH_LANES];
+		    fftw_real tmp36[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp159[l] = c_im(input[2 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp160[l] = c_im(input[34 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp161[l] = tmp159[l] + tmp160[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp219[l] = tmp159[l] - tmp160[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp35[l] = c_re(input[18 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp36[l] = c_re(input[50 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp37[l] = tmp35[l] + tmp36[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp218[l] = tmp35[l] - tmp36[l];
+	       }
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp162[l] = c_im(input[18 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp163[l] = c_im(input[50 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp164[l] = tmp162[l] + tmp163[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp230[l] = tmp162[l] - tmp163[l];
+	       {
+		    fftw_real tmp42[FFTW_BATCH_LANES];
+		    fftw_real tmp43[FFTW_BATCH_LANES];
+		    fftw_real tmp221[FFTW_BATCH_LANES];
+		    fftw_real tmp169[FFTW_BATCH_LANES];
+		    fftw_real tmp170[FFTW_BATCH_LANES];
+		    fftw_real tmp222[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp42[l] = c_re(input[58 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp43[l] = c_re(input[26 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp221[l] = tmp42[l] - tmp43[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp169[l] = c_im(input[58 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp170[l] = c_im(input[26 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp222[l] = tmp169[l] - tmp170[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp44[l] = tmp42[l] + tmp43[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp233[l] = tmp221[l] + tmp222[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp223[l] = tmp221[l] - tmp222[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp171[l] = tmp169[l] + tmp170[l];
+	       }
+	       {
+		    fftw_real tmp39[FFTW_BATCH_LANES];
+		    fftw_real tmp40[FFTW_BATCH_LANES];
+		    fftw_real tmp224[FFTW_BATCH_LANES];
+		    fftw_real tmp166[FFTW_BATCH_LANES];
+		    fftw_real tmp167[FFTW_BATCH_LANES];
+		    fftw_real tmp225[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp39[l] = c_re(input[10 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp40[l] = c_re(input[42 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp224[l] = tmp39[l] - tmp40[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp166[l] = c_im(input[10 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp167[l] = c_im(input[42 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp225[l] = tmp166[l] - tmp167[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp41[l] = tmp39[l] + tmp40[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp232[l] = tmp225[l] - tmp224[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp226[l] = tmp224[l] + tmp225[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp168[l] = tmp166[l] + tmp167[l];
+	       }
+	  }
+	  {
+	       fftw_real tmp38[FFTW_BATCH_LANES];
+	       fftw_real tmp45[FFTW_BATCH_LANES];
+	       fftw_real tmp646[FFTW_BATCH_LANES];
+	       fftw_real tmp647[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp38[l] = tmp34[l] + tmp37[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp45[l] = tmp41[l] + tmp44[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp46[l] = tmp38[l] + tmp45[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp819[l] = tmp38[l] - tmp45[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp646[l] = tmp161[l] - tmp164[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp647[l] = tmp44[l] - tmp41[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp648[l] = tmp646[l] - tmp647[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp758[l] = tmp647[l] + tmp646[l];
+	  }
+	  {
+	       fftw_real tmp165[FFTW_BATCH_LANES];
+	       fftw_real tmp172[FFTW_BATCH_LANES];
+	       fftw_real tmp649[FFTW_BATCH_LANES];
+	       fftw_real tmp650[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp165[l] = tmp161[l] + tmp164[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp172[l] = tmp168[l] + tmp171[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp173[l] = tmp165[l] + tmp172[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp818[l] = tmp165[l] - tmp172[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp649[l] = tmp34[l] - tmp37[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp650[l] = tmp168[l] - tmp171[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp651[l] = tmp649[l] - tmp650[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp759[l] = tmp649[l] + tmp650[l];
+	  }
+	  {
+	       fftw_real tmp220[FFTW_BATCH_LANES];
+	       fftw_real tmp227[FFTW_BATCH_LANES];
+	       fftw_real tmp482[FFTW_BATCH_LANES];
+	       fftw_real tmp483[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp220[l] = tmp218[l] + tmp219[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp227[l] = K707106781 * (tmp223[l] - tmp226[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp228[l] = tmp220[l] - tmp227[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp414[l] = tmp220[l] + tmp227[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp482[l] = tmp219[l] - tmp218[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp483[l] = K707106781 * (tmp232[l] + tmp233[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp484[l] = tmp482[l] - tmp483[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp578[l] = tmp482[l] + tmp483[l];
+	  }
+	  {
+	       fftw_real tmp231[FFTW_BATCH_LANES];
+	       fftw_real tmp234[FFTW_BATCH_LANES];
+	       fftw_real tmp485[FFTW_BATCH_LANES];
+	       fftw_real tmp486[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp231[l] = tmp229[l] - tmp230[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp234[l] = K707106781 * (tmp232[l] - tmp233[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp235[l] = tmp231[l] - tmp234[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp415[l] = tmp231[l] + tmp234[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp485[l] = tmp229[l] + tmp230[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp486[l] = K707106781 * (tmp226[l] + tmp223[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp487[l] = tmp485[l] - tmp486[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp579[l] = tmp485[l] + tmp486[l];
+	  }
+     }
+     {
+	  fftw_real tmp66[FFTW_BATCH_LANES];
+	  fftw_real tmp299[FFTW_BATCH_LANES];
+	  fftw_real tmp261[FFTW_BATCH_LANES];
+	  fftw_real tmp662[FFTW_BATCH_LANES];
+	  fftw_real tmp69[FFTW_BATCH_LANES];
+	  fftw_real tmp258[FFTW_BATCH_LANES];
+	  fftw_real tmp302[FFTW_BATCH_LANES];
+	  fftw_real tmp663[FFTW_BATCH_LANES];
+	  fftw_real tmp76[FFTW_BATCH_LANES];
+	  fftw_real tmp681[FFTW_BATCH_LANES];
+	  fftw_real tmp267[FFTW_BATCH_LANES];
+	  fftw_real tmp305[FFTW_BATCH_LANES];
+	  fftw_real tmp73[FFTW_BATCH_LANES];
+	  fftw_real tmp680[FFTW_BATCH_LANES];
+	  fftw_real tmp272[FFTW_BATCH_LANES];
+	  fftw_real tmp304[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp64[FFTW_BATCH_LANES];
+	       fftw_real tmp65[FFTW_BATCH_LANES];
+	       fftw_real tmp300[FFTW_BATCH_LANES];
+	       fftw_real tmp301[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp64[l] = c_re(input[istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp65[l] = c_re(input[33 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp66[l] = tmp64[l] + tmp65[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp299[l] = tmp64[l] - tmp65[l];
+	       {
+		    fftw_real tmp259[FFTW_BATCH_LANES];
+		    fftw_real tmp260[FFTW_BATCH_LANES];
+		    fftw_real tmp67[FFTW_BATCH_LANES];
+		    fftw_real tmp68[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp259[l] = c_im(input[istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp260[l] = c_im(input[33 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp261[l] = tmp259[l] - tmp260[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp662[l] = tmp259[l] + tmp260[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp67[l] = c_re(input[17 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp68[l] = c_re(input[49 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp69[l] = tmp67[l] + tmp68[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp258[l] = tmp67[l] - tmp68[l];
+	       }
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp300[l] = c_im(input[17 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp301[l] = c_im(input[49 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp302[l] = tmp300[l] - tmp301[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp663[l] = tmp300[l] + tmp301[l];
+	       {
+		    fftw_real tmp74[FFTW_BATCH_LANES];
+		    fftw_real tmp75[FFTW_BATCH_LANES];
+		    fftw_real tmp263[FFTW_BATCH_LANES];
+		    fftw_real tmp264[FFTW_BATCH_LANES];
+		    fftw_real tmp265[FFTW_BATCH_LANES];
+		    fftw_real tmp266[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp74[l] = c_re(input[57 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp75[l] = c_re(input[25 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp263[l] = tmp74[l] - tmp75[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp264[l] = c_im(input[57 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp265[l] = c_im(input[25 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp266[l] = tmp264[l] - tmp265[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp76[l] = tmp74[l] + tmp75[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp681[l] = tmp264[l] + tmp265[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp267[l] = tmp263[l] - tmp266[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp305[l] = tmp263[l] + tmp266[l];
+	       }
+	       {
+		    fftw_real tmp71[FFTW_BATCH_LANES];
+		    fftw_real tmp72[FFTW_BATCH_LANES];
+		    fftw_real tmp268[FFTW_BATCH_LANES];
+		    fftw_real tmp269[FFTW_BATCH_LANES];
+		    fftw_real tmp270[FFTW_BATCH_LANES];
+		    fftw_real tmp271[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp71[l] = c_re(input[9 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp72[l] = c_re(input[41 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp268[l] = tmp71[l] - tmp72[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp269[l] = c_im(input[9 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp270[l] = c_im(input[41 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp271[l] = tmp269[l] - tmp270[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp73[l] = tmp71[l] + tmp72[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp680[l] = tmp269[l] + tmp270[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp272[l] = tmp268[l] + tmp271[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp304[l] = tmp271[l] - tmp268[l];
+	       }
+	  }
+	  {
+	       fftw_real tmp70[FFTW_BATCH_LANES];
+	       fftw_real tmp77[FFTW_BATCH_LANES];
+	       fftw_real tmp664[FFTW_BATCH_LANES];
+	       fftw_real tmp665[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp70[l] = tmp66[l] + tmp69[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp77[l] = tmp73[l] + tmp76[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp78[l] = tmp70[l] + tmp77[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp831[l] = tmp70[l] - tmp77[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp664[l] = tmp662[l] - tmp663[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp665[l] = tmp76[l] - tmp73[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp666[l] = tmp664[l] - tmp665[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp769[l] = tmp665[l] + tmp664[l];
+	  }
+	  {
+	       fftw_real tmp826[FFTW_BATCH_LANES];
+	       fftw_real tmp827[FFTW_BATCH_LANES];
+	       fftw_real tmp679[FFTW_BATCH_LANES];
+	       fftw_real tmp682[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp826[l] = tmp662[l] + tmp663[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp827[l] = tmp680[l] + tmp681[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp828[l] = tmp826[l] - tmp827[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp887[l] = tmp826[l] + tmp827[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp679[l] = tmp66[l] - tmp69[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp682[l] = tmp680[l] - tmp681[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp683[l] = tmp679[l] - tmp682[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp766[l] = tmp679[l] + tmp682[l];
+	  }
+	  {
+	       fftw_real tmp262[FFTW_BATCH_LANES];
+	       fftw_real tmp273[FFTW_BATCH_LANES];
+	       fftw_real tmp498[FFTW_BATCH_LANES];
+	       fftw_real tmp499[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp262[l] = tmp258[l] + tmp261[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp273[l] = K707106781 * (tmp267[l] - tmp272[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp274[l] = tmp262[l] - tmp273[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp425[l] = tmp262[l] + tmp273[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp498[l] = tmp261[l] - tmp258[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp499[l] = K707106781 * (tmp304[l] + tmp305[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp500[l] = tmp498[l] - tmp499[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp589[l] = tmp498[l] + tmp499[l];
+	  }
+	  {
+	       fftw_real tmp303[FFTW_BATCH_LANES];
+	       fftw_real tmp306[FFTW_BATCH_LANES];
+	       fftw_real tmp509[FFTW_BATCH_LANES];
+	       fftw_real tmp510[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp303[l] = tmp299[l] - tmp302[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp306[l] = K707106781 * (tmp304[l] - tmp305[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp307[l] = tmp303[l] - tmp306[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp422[l] = tmp303[l] + tmp306[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp509[l] = tmp299[l] + tmp302[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp510[l] = K707106781 * (tmp272[l] + tmp267[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp511[l] = tmp509[l] - tmp510[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp586[l] = tmp509[l] + tmp510[l];
+	  }
+     }
+     {
+	  fftw_real tmp49[FFTW_BATCH_LANES];
+	  fftw_real tmp248[FFTW_BATCH_LANES];
+	  fftw_real tmp176[FFTW_BATCH_LANES];
+	  fftw_real tmp238[FFTW_BATCH_LANES];
+	  fftw_real tmp52[FFTW_BATCH_LANES];
+	  fftw_real tmp237[FFTW_BATCH_LANES];
+	  fftw_real tmp179[FFTW_BATCH_LANES];
+	  fftw_real tmp249[FFTW_BATCH_LANES];
+	  fftw_real tmp59[FFTW_BATCH_LANES];
+	  fftw_real tmp252[FFTW_BATCH_LANES];
+	  fftw_real tmp242[FFTW_BATCH_LANES];
+	  fftw_real tmp186[FFTW_BATCH_LANES];
+	  fftw_real tmp56[FFTW_BATCH_LANES];
+	  fftw_real tmp251[FFTW_BATCH_LANES];
+	  fftw_real tmp245[FFTW_BATCH_LANES];
+	  fftw_real tmp183[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp47[FFTW_BATCH_LANES];
+	       fftw_real tmp48[FFTW_BATCH_LANES];
+	       fftw_real tmp177[FFTW_BATCH_LANES];
+	       fftw_real tmp178[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp47[l] = c_re(input[62 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp48[l] = c_re(input[30 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp49[l] = tmp47[l] + tmp48[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp248[l] = tmp47[l] - tmp48[l];
+	       {
+		    fftw_real tmp174[FFTW_BATCH_LANES];
+		    fftw_real tmp175[FFTW_BATCH_LANES];
+		    fftw_real tmp50[FFTW_BATCH_LANES];
+		    fftw_real tmp51[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp174[l] = c_im(input[62 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp175[l] = c_im(input[30 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp176[l] = tmp174[l] + tmp175[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp238[l] = tmp174[l] - tmp175[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp50[l] = c_re(input[14 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp51[l] = c_re(input[46 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp52[l] = tmp50[l] + tmp51[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp237[l] = tmp50[l] - tmp51[l];
+	       }
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp177[l] = c_im(input[14 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp178[l] = c_im(input[46 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp179[l] = tmp177[l] + tmp178[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp249[l] = tmp177[l] - tmp178[l];
+	       {
+		    fftw_real tmp57[FFTW_BATCH_LANES];
+		    fftw_real tmp58[FFTW_BATCH_LANES];
+		    fftw_real tmp240[FFTW_BATCH_LANES];
+		    fftw_real tmp184[FFTW_BATCH_LANES];
+		    fftw_real tmp185[FFTW_BATCH_LANES];
+		    fftw_real tmp241[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp57[l] = c_re(input[54 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp58[l] = c_re(input[22 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp240[l] = tmp57[l] - tmp58[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp184[l] = c_im(input[54 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp185[l] = c_im(input[22 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp241[l] = tmp184[l] - tmp185[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp59[l] = tmp57[l] + tmp58[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp252[l] = tmp240[l] + tmp241[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp242[l] = tmp240[l] - tmp241[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp186[l] = tmp184[l] + tmp185[l];
+	       }
+	       {
+		    fftw_real tmp54[FFTW_BATCH_LANES];
+		    fftw_real tmp55[FFTW_BATCH_LANES];
+		    fftw_real tmp243[FFTW_BATCH_LANES];
+		    fftw_real tmp181[FFTW_BATCH_LANES];
+		    fftw_real tmp182[FFTW_BATCH_LANES];
+		    fftw_real tmp244[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp54[l] = c_re(input[6 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp55[l] = c_re(input[38 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp243[l] = tmp54[l] - tmp55[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp181[l] = c_im(input[6 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp182[l] = c_im(input[38 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp244[l] = tmp181[l] - tmp182[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp56[l] = tmp54[l] + tmp55[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp251[l] = tmp244[l] - tmp243[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp245[l] = tmp243[l] + tmp244[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp183[l] = tmp181[l] + tmp182[l];
+	       }
+	  }
+	  {
+	       fftw_real tmp53[FFTW_BATCH_LANES];
+	       fftw_real tmp60[FFTW_BATCH_LANES];
+	       fftw_real tmp653[FFTW_BATCH_LANES];
+	       fftw_real tmp654[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp53[l] = tmp49[l] + tmp52[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp60[l] = tmp56[l] + tmp59[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp61[l] = tmp53[l] + tmp60[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp821[l] = tmp53[l] - tmp60[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp653[l] = tmp176[l] - tmp179[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp654[l] = tmp59[l] - tmp56[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp655[l] = tmp653[l] - tmp654[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp761[l] = tmp654[l] + tmp653[l];
+	  }
+	  {
+	       fftw_real tmp180[FFTW_BATCH_LANES];
+	       fftw_real tmp187[FFTW_BATCH_LANES];
+	       fftw_real tmp656[FFTW_BATCH_LANES];
+	       fftw_real tmp657[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp180[l] = tmp176[l] + tmp179[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp187[l] = tmp183[l] + tmp186[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp188[l] = tmp180[l] + tmp187[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp822[l] = tmp180[l] - tmp187[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp656[l] = tmp49[l] - tmp52[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp657[l] = tmp183[l] - tmp186[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp658[l] = tmp656[l] - tmp657[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp762[l] = tmp656[l] + tmp657[l];
+	  }
+	  {
+	       fftw_real tmp239[FFTW_BATCH_LANES];
+	       fftw_real tmp246[FFTW_BATCH_LANES];
+	       fftw_real tmp489[FFTW_BATCH_LANES];
+	       fftw_real tmp490[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp239[l] = tmp237[l] + tmp238[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp246[l] = K707106781 * (tmp242[l] - tmp245[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp247[l] = tmp239[l] - tmp246[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp417[l] = tmp239[l] + tmp246[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp489[l] = tmp248[l] + tmp249[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp490[l] = K707106781 * (tmp245[l] + tmp242[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp491[l] = tmp489[l] - tmp490[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp581[l] = tmp489[l] + tmp490[l];
+	  }
+	  {
+	       fftw_real tmp250[FFTW_BATCH_LANES];
+	       fftw_real tmp253[FFTW_BATCH_LANES];
+	       fftw_real tmp492[FFTW_BATCH_LANES];
+	       fftw_real tmp493[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp250[l] = tmp248[l] - tmp249[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp253[l] = K707106781 * (tmp251[l] - tmp252[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp254[l] = tmp250[l] - tmp253[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp418[l] = tmp250[l] + tmp253[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp492[l] = tmp238[l] - tmp237[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp493[l] = K707106781 * (tmp251[l] + tmp252[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp494[l] = tmp492[l] - tmp493[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp582[l] = tmp492[l] + tmp493[l];
+	  }
+     }
+     {
+	  fftw_real tmp81[FFTW_BATCH_LANES];
+	  fftw_real tmp673[FFTW_BATCH_LANES];
+	  fftw_real tmp84[FFTW_BATCH_LANES];
+	  fftw_real tmp674[FFTW_BATCH_LANES];
+	  fftw_real tmp290[FFTW_BATCH_LANES];
+	  fftw_real tmp504[FFTW_BATCH_LANES];
+	  fftw_real tmp295[FFTW_BATCH_LANES];
+	  fftw_real tmp505[FFTW_BATCH_LANES];
+	  fftw_real tmp675[FFTW_BATCH_LANES];
+	  fftw_real tmp672[FFTW_BATCH_LANES];
+	  fftw_real tmp88[FFTW_BATCH_LANES];
+	  fftw_real tmp668[FFTW_BATCH_LANES];
+	  fftw_real tmp91[FFTW_BATCH_LANES];
+	  fftw_real tmp669[FFTW_BATCH_LANES];
+	  fftw_real tmp279[FFTW_BATCH_LANES];
+	  fftw_real tmp501[FFTW_BATCH_LANES];
+	  fftw_real tmp284[FFTW_BATCH_LANES];
+	  fftw_real tmp502[FFTW_BATCH_LANES];
+	  fftw_real tmp670[FFTW_BATCH_LANES];
+	  fftw_real tmp667[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp291[FFTW_BATCH_LANES];
+	       fftw_real tmp289[FFTW_BATCH_LANES];
+	       fftw_real tmp286[FFTW_BATCH_LANES];
+	       fftw_real tmp294[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       {
+		    fftw_real tmp79[FFTW_BATCH_LANES];
+		    fftw_real tmp80[FFTW_BATCH_LANES];
+		    fftw_real tmp287[FFTW_BATCH_LANES];
+		    fftw_real tmp288[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp79[l] = c_re(input[5 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp80[l] = c_re(input[37 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp81[l] = tmp79[l] + tmp80[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp291[l] = tmp79[l] - tmp80[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp287[l] = c_im(input[5 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp288[l] = c_im(input[37 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp289[l] = tmp287[l] - tmp288[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp673[l] = tmp287[l] + tmp288[l];
+	       }
+	       {
+		    fftw_real tmp82[FFTW_BATCH_LANES];
+		    fftw_real tmp83[FFTW_BATCH_LANES];
+		    fftw_real tmp292[FFTW_BATCH_LANES];
+		    fftw_real tmp293[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp82[l] = c_re(input[21 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp83[l] = c_re(input[53 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp84[l] = tmp82[l] + tmp83[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp286[l] = tmp82[l] - tmp83[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp292[l] = c_im(input[21 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp293[l] = c_im(input[53 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp294[l] = tmp292[l] - tmp293[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp674[l] = tmp292[l] + tmp293[l];
+	       }
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp290[l] = tmp286[l] + tmp289[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp504[l] = tmp289[l] - tmp286[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp295[l] = tmp291[l] - tmp294[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp505[l] = tmp291[l] + tmp294[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp675[l] = tmp673[l] - tmp674[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp672[l] = tmp81[l] - tmp84[l];
+	  }
+	  {
+	       fftw_real tmp275[FFTW_BATCH_LANES];
+	       fftw_real tmp283[FFTW_BATCH_LANES];
+	       fftw_real tmp280[FFTW_BATCH_LANES];
+	       fftw_real tmp278[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       {
+		    fftw_real tmp86[FFTW_BATCH_LANES];
+		    fftw_real tmp87[FFTW_BATCH_LANES];
+		    fftw_real tmp281[FFTW_BATCH_LANES];
+		    fftw_real tmp282[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp86[l] = c_re(input[61 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp87[l] = c_re(input[29 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp88[l] = tmp86[l] + tmp87[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp275[l] = tmp86[l] - tmp87[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp281[l] = c_im(input[61 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp282[l] = c_im(input[29 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp283[l] = tmp281[l] - tmp282[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp668[l] = tmp281[l] + tmp282[l];
+	       }
+	       {
+		    fftw_real tmp89[FFTW_BATCH_LANES];
+		    fftw_real tmp90[FFTW_BATCH_LANES];
+		    fftw_real tmp276[FFTW_BATCH_LANES];
+		    fftw_real tmp277[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp89[l] = c_re(input[13 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp90[l] = c_re(input[45 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp91[l] = tmp89[l] + tmp90[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp280[l] = tmp89[l] - tmp90[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp276[l] = c_im(input[13 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp277[l] = c_im(input[45 * istride + l * idist]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp278[l] = tmp276[l] - tmp277[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp669[l] = tmp276[l] + tmp277[l];
+	       }
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp279[l] = tmp275[l] - tmp278[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp501[l] = tmp275[l] + tmp278[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp284[l] = tmp280[l] + tmp283[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp502[l] = tmp283[l] - tmp280[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp670[l] = tmp668[l] - tmp669[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp667[l] = tmp88[l] - tmp91[l];
+	  }
+	  {
+	       fftw_real tmp85[FFTW_BATCH_LANES];
+	       fftw_real tmp92[FFTW_BATCH_LANES];
+	       fftw_real tmp308[FFTW_BATCH_LANES];
+	       fftw_real tmp309[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp85[l] = tmp81[l] + tmp84[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp92[l] = tmp88[l] + tmp91[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp93[l] = tmp85[l] + tmp92[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp829[l] = tmp92[l] - tmp85[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp308[l] = (K382683432 * tmp290[l]) - (K923879532 * tmp295[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp309[l] = (K382683432 * tmp284[l]) + (K923879532 * tmp279[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp310[l] = tmp308[l] - tmp309[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp426[l] = tmp308[l] + tmp309[l];
+	  }
+	  {
+	       fftw_real tmp285[FFTW_BATCH_LANES];
+	       fftw_real tmp296[FFTW_BATCH_LANES];
+	       fftw_real tmp832[FFTW_BATCH_LANES];
+	       fftw_real tmp833[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp285[l] = (K382683432 * tmp279[l]) - (K923879532 * tmp284[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp296[l] = (K923879532 * tmp290[l]) + (K382683432 * tmp295[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp297[l] = tmp285[l] - tmp296[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp423[l] = tmp296[l] + tmp285[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp832[l] = tmp673[l] + tmp674[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp833[l] = tmp668[l] + tmp669[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp834[l] = tmp832[l] - tmp833[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp888[l] = tmp832[l] + tmp833[l];
+	  }
+	  {
+	       fftw_real tmp503[FFTW_BATCH_LANES];
+	       fftw_real tmp506[FFTW_BATCH_LANES];
+	       fftw_real tmp512[FFTW_BATCH_LANES];
+	       fftw_real tmp513[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp503[l] = (K923879532 * tmp501[l]) - (K382683432 * tmp502[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp506[l] = (K382683432 * tmp504[l]) + (K923879532 * tmp505[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp507[l] = tmp503[l] - tmp506[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp587[l] = tmp506[l] + tmp503[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp512[l] = (K923879532 * tmp504[l]) - (K382683432 * tmp505[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp513[l] = (K923879532 * tmp502[l]) + (K382683432 * tmp501[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp514[l] = tmp512[l] - tmp513[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp590[l] = tmp512[l] + tmp513[l];
+	  }
+	  {
+	       fftw_real tmp671[FFTW_BATCH_LANES];
+	       fftw_real tmp676[FFTW_BATCH_LANES];
+	       fftw_real tmp684[FFTW_BATCH_LANES];
+	       fftw_real tmp685[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp671[l] = tmp667[l] - tmp670[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp676[l] = tmp672[l] + tmp675[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp677[l] = K707106781 * (tmp671[l] - tmp676[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp767[l] = K707106781 * (tmp676[l] + tmp671[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp684[l] = tmp675[l] - tmp672[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp685[l] = tmp667[l] + tmp670[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp686[l] = K707106781 * (tmp684[l] - tmp685[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp770[l] = K707106781 * (tmp684[l] + tmp685[l]);
+	  }
+     }
+     {
+	  fftw_real tmp63[FFTW_BATCH_LANES];
+	  fftw_real tmp907[FFTW_BATCH_LANES];
+	  fftw_real tmp910[FFTW_BATCH_LANES];
+	  fftw_real tmp912[FFTW_BATCH_LANES];
+	  fftw_real tmp126[FFTW_BATCH_LANES];
+	  fftw_real tmp127[FFTW_BATCH_LANES];
+	  fftw_real tmp190[FFTW_BATCH_LANES];
+	  fftw_real tmp911[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp31[FFTW_BATCH_LANES];
+	       fftw_real tmp62[FFTW_BATCH_LANES];
+	       fftw_real tmp908[FFTW_BATCH_LANES];
+	       fftw_real tmp909[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp31[l] = tmp15[l] + tmp30[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp62[l] = tmp46[l] + tmp61[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp63[l] = tmp31[l] + tmp62[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp907[l] = tmp31[l] - tmp62[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp908[l] = tmp887[l] + tmp888[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp909[l] = tmp892[l] + tmp893[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp910[l] = tmp908[l] - tmp909[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp912[l] = tmp908[l] + tmp909[l];
+	  }
+	  {
+	       fftw_real tmp94[FFTW_BATCH_LANES];
+	       fftw_real tmp125[FFTW_BATCH_LANES];
+	       fftw_real tmp158[FFTW_BATCH_LANES];
+	       fftw_real tmp189[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp94[l] = tmp78[l] + tmp93[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp125[l] = tmp109[l] + tmp124[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp126[l] = tmp94[l] + tmp125[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp127[l] = tmp125[l] - tmp94[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp158[l] = tmp142[l] + tmp157[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp189[l] = tmp173[l] + tmp188[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp190[l] = tmp158[l] - tmp189[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp911[l] = tmp158[l] + tmp189[l];
+	  }
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[32 * ostride + l * odist]) = tmp63[l] - tmp126[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[l * odist]) = tmp63[l] + tmp126[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[16 * ostride + l * odist]) = tmp127[l] + tmp190[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[48 * ostride + l * odist]) = tmp190[l] - tmp127[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[48 * ostride + l * odist]) = tmp907[l] - tmp910[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[16 * ostride + l * odist]) = tmp907[l] + tmp910[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[32 * ostride + l * odist]) = tmp911[l] - tmp912[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[l * odist]) = tmp911[l] + tmp912[l];
+     }
+     {
+	  fftw_real tmp885[FFTW_BATCH_LANES];
+	  fftw_real tmp901[FFTW_BATCH_LANES];
+	  fftw_real tmp899[FFTW_BATCH_LANES];
+	  fftw_real tmp905[FFTW_BATCH_LANES];
+	  fftw_real tmp890[FFTW_BATCH_LANES];
+	  fftw_real tmp902[FFTW_BATCH_LANES];
+	  fftw_real tmp895[FFTW_BATCH_LANES];
+	  fftw_real tmp903[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp883[FFTW_BATCH_LANES];
+	       fftw_real tmp884[FFTW_BATCH_LANES];
+	       fftw_real tmp897[FFTW_BATCH_LANES];
+	       fftw_real tmp898[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp883[l] = tmp15[l] - tmp30[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp884[l] = tmp173[l] - tmp188[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp885[l] = tmp883[l] + tmp884[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp901[l] = tmp883[l] - tmp884[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp897[l] = tmp142[l] - tmp157[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp898[l] = tmp61[l] - tmp46[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp899[l] = tmp897[l] - tmp898[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp905[l] = tmp898[l] + tmp897[l];
+	  }
+	  {
+	       fftw_real tmp886[FFTW_BATCH_LANES];
+	       fftw_real tmp889[FFTW_BATCH_LANES];
+	       fftw_real tmp891[FFTW_BATCH_LANES];
+	       fftw_real tmp894[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp886[l] = tmp78[l] - tmp93[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp889[l] = tmp887[l] - tmp888[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp890[l] = tmp886[l] + tmp889[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp902[l] = tmp889[l] - tmp886[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp891[l] = tmp109[l] - tmp124[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp894[l] = tmp892[l] - tmp893[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp895[l] = tmp891[l] - tmp894[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp903[l] = tmp891[l] + tmp894[l];
+	  }
+	  {
+	       fftw_real tmp896[FFTW_BATCH_LANES];
+	       fftw_real tmp900[FFTW_BATCH_LANES];
+	       fftw_real tmp904[FFTW_BATCH_LANES];
+	       fftw_real tmp906[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp896[l] = K707106781 * (tmp890[l] + tmp895[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[40 * ostride + l * odist]) = tmp885[l] - tmp896[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[8 * ostride + l * odist]) = tmp885[l] + tmp896[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp900[l] = K707106781 * (tmp895[l] - tmp890[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[56 * ostride + l * odist]) = tmp899[l] - tmp900[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[24 * ostride + l * odist]) = tmp899[l] + tmp900[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp904[l] = K707106781 * (tmp902[l] - tmp903[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[56 * ostride + l * odist]) = tmp901[l] - tmp904[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[24 * ostride + l * odist]) = tmp901[l] + tmp904[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp906[l] = K707106781 * (tmp902[l] + tmp903[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[40 * ostride + l * odist]) = tmp905[l] - tmp906[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[8 * ostride + l * odist]) = tmp905[l] + tmp906[l];
+	  }
+     }
+     {
+	  fftw_real tmp217[FFTW_BATCH_LANES];
+	  fftw_real tmp391[FFTW_BATCH_LANES];
+	  fftw_real tmp396[FFTW_BATCH_LANES];
+	  fftw_real tmp406[FFTW_BATCH_LANES];
+	  fftw_real tmp399[FFTW_BATCH_LANES];
+	  fftw_real tmp407[FFTW_BATCH_LANES];
+	  fftw_real tmp367[FFTW_BATCH_LANES];
+	  fftw_real tmp387[FFTW_BATCH_LANES];
+	  fftw_real tmp312[FFTW_BATCH_LANES];
+	  fftw_real tmp386[FFTW_BATCH_LANES];
+	  fftw_real tmp379[FFTW_BATCH_LANES];
+	  fftw_real tmp401[FFTW_BATCH_LANES];
+	  fftw_real tmp382[FFTW_BATCH_LANES];
+	  fftw_real tmp392[FFTW_BATCH_LANES];
+	  fftw_real tmp256[FFTW_BATCH_LANES];
+	  fftw_real tmp402[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp201[FFTW_BATCH_LANES];
+	       fftw_real tmp216[FFTW_BATCH_LANES];
+	       fftw_real tmp394[FFTW_BATCH_LANES];
+	       fftw_real tmp395[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp201[l] = tmp193[l] - tmp200[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp216[l] = tmp208[l] - tmp215[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp217[l] = tmp201[l] - tmp216[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp391[l] = tmp201[l] + tmp216[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp394[l] = tmp274[l] + tmp297[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp395[l] = tmp307[l] + tmp310[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp396[l] = (K634393284 * tmp394[l]) + (K773010453 * tmp395[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp406[l] = (K773010453 * tmp394[l]) - (K634393284 * tmp395[l]);
+	  }
+	  {
+	       fftw_real tmp397[FFTW_BATCH_LANES];
+	       fftw_real tmp398[FFTW_BATCH_LANES];
+	       fftw_real tmp353[FFTW_BATCH_LANES];
+	       fftw_real tmp366[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp397[l] = tmp329[l] + tmp352[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp398[l] = tmp362[l] + tmp365[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp399[l] = (K773010453 * tmp397[l]) - (K634393284 * tmp398[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp407[l] = (K773010453 * tmp398[l]) + (K634393284 * tmp397[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp353[l] = tmp329[l] - tmp352[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp366[l] = tmp362[l] - tmp365[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp367[l] = (K098017140 * tmp353[l]) - (K995184726 * tmp366[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp387[l] = (K098017140 * tmp366[l]) + (K995184726 * tmp353[l]);
+	  }
+	  {
+	       fftw_real tmp298[FFTW_BATCH_LANES];
+	       fftw_real tmp311[FFTW_BATCH_LANES];
+	       fftw_real tmp375[FFTW_BATCH_LANES];
+	       fftw_real tmp378[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp298[l] = tmp274[l] - tmp297[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp311[l] = tmp307[l] - tmp310[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp312[l] = (K995184726 * tmp298[l]) + (K098017140 * tmp311[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp386[l] = (K098017140 * tmp298[l]) - (K995184726 * tmp311[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp375[l] = tmp371[l] - tmp374[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp378[l] = tmp376[l] - tmp377[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp379[l] = tmp375[l] - tmp378[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp401[l] = tmp375[l] + tmp378[l];
+	  }
+	  {
+	       fftw_real tmp380[FFTW_BATCH_LANES];
+	       fftw_real tmp381[FFTW_BATCH_LANES];
+	       fftw_real tmp236[FFTW_BATCH_LANES];
+	       fftw_real tmp255[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp380[l] = (K195090322 * tmp254[l]) - (K980785280 * tmp247[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp381[l] = (K980785280 * tmp228[l]) + (K195090322 * tmp235[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp382[l] = tmp380[l] - tmp381[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp392[l] = tmp381[l] + tmp380[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp236[l] = (K195090322 * tmp228[l]) - (K980785280 * tmp235[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp255[l] = (K195090322 * tmp247[l]) + (K980785280 * tmp254[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp256[l] = tmp236[l] - tmp255[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp402[l] = tmp236[l] + tmp255[l];
+	  }
+	  {
+	       fftw_real tmp257[FFTW_BATCH_LANES];
+	       fftw_real tmp368[FFTW_BATCH_LANES];
+	       fftw_real tmp383[FFTW_BATCH_LANES];
+	       fftw_real tmp384[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp257[l] = tmp217[l] + tmp256[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp368[l] = tmp312[l] + tmp367[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[47 * ostride + l * odist]) = tmp257[l] - tmp368[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[15 * ostride + l * odist]) = tmp257[l] + tmp368[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp383[l] = tmp379[l] - tmp382[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp384[l] = tmp367[l] - tmp312[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[63 * ostride + l * odist]) = tmp383[l] - tmp384[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[31 * ostride + l * odist]) = tmp383[l] + tmp384[l];
+	  }
+	  {
+	       fftw_real tmp389[FFTW_BATCH_LANES];
+	       fftw_real tmp390[FFTW_BATCH_LANES];
+	       fftw_real tmp385[FFTW_BATCH_LANES];
+	       fftw_real tmp388[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp389[l] = tmp379[l] + tmp382[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp390[l] = tmp386[l] + tmp387[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[47 * ostride + l * odist]) = tmp389[l] - tmp390[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[15 * ostride + l * odist]) = tmp389[l] + tmp390[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp385[l] = tmp217[l] - tmp256[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp388[l] = tmp386[l] - tmp387[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[63 * ostride + l * odist]) = tmp385[l] - tmp388[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[31 * ostride + l * odist]) = tmp385[l] + tmp388[l];
+	  }
+	  {
+	       fftw_real tmp393[FFTW_BATCH_LANES];
+	       fftw_real tmp400[FFTW_BATCH_LANES];
+	       fftw_real tmp403[FFTW_BATCH_LANES];
+	       fftw_real tmp404[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp393[l] = tmp391[l] + tmp392[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp400[l] = tmp396[l] + tmp399[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[39 * ostride + l * odist]) = tmp393[l] - tmp400[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[7 * ostride + l * odist]) = tmp393[l] + tmp400[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp403[l] = tmp401[l] - tmp402[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp404[l] = tmp399[l] - tmp396[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[55 * ostride + l * odist]) = tmp403[l] - tmp404[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[23 * ostride + l * odist]) = tmp403[l] + tmp404[l];
+	  }
+	  {
+	       fftw_real tmp409[FFTW_BATCH_LANES];
+	       fftw_real tmp410[FFTW_BATCH_LANES];
+	       fftw_real tmp405[FFTW_BATCH_LANES];
+	       fftw_real tmp408[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp409[l] = tmp401[l] + tmp402[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp410[l] = tmp406[l] + tmp407[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[39 * ostride + l * odist]) = tmp409[l] - tmp410[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[7 * ostride + l * odist]) = tmp409[l] + tmp410[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp405[l] = tmp391[l] - tmp392[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp408[l] = tmp406[l] - tmp407[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[55 * ostride + l * odist]) = tmp405[l] - tmp408[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[23 * ostride + l * odist]) = tmp405[l] + tmp408[l];
+	  }
+     }
+     {
+	  fftw_real tmp413[FFTW_BATCH_LANES];
+	  fftw_real tmp451[FFTW_BATCH_LANES];
+	  fftw_real tmp456[FFTW_BATCH_LANES];
+	  fftw_real tmp466[FFTW_BATCH_LANES];
+	  fftw_real tmp459[FFTW_BATCH_LANES];
+	  fftw_real tmp467[FFTW_BATCH_LANES];
+	  fftw_real tmp435[FFTW_BATCH_LANES];
+	  fftw_real tmp447[FFTW_BATCH_LANES];
+	  fftw_real tmp428[FFTW_BATCH_LANES];
+	  fftw_real tmp446[FFTW_BATCH_LANES];
+	  fftw_real tmp439[FFTW_BATCH_LANES];
+	  fftw_real tmp461[FFTW_BATCH_LANES];
+	  fftw_real tmp442[FFTW_BATCH_LANES];
+	  fftw_real tmp452[FFTW_BATCH_LANES];
+	  fftw_real tmp420[FFTW_BATCH_LANES];
+	  fftw_real tmp462[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp411[FFTW_BATCH_LANES];
+	       fftw_real tmp412[FFTW_BATCH_LANES];
+	       fftw_real tmp454[FFTW_BATCH_LANES];
+	       fftw_real tmp455[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp411[l] = tmp193[l] + tmp200[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp412[l] = tmp377[l] + tmp376[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp413[l] = tmp411[l] - tmp412[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp451[l] = tmp411[l] + tmp412[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp454[l] = tmp422[l] + tmp423[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp455[l] = tmp425[l] + tmp426[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp456[l] = (K956940335 * tmp454[l]) + (K290284677 * tmp455[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp466[l] = (K956940335 * tmp455[l]) - (K290284677 * tmp454[l]);
+	  }
+	  {
+	       fftw_real tmp457[FFTW_BATCH_LANES];
+	       fftw_real tmp458[FFTW_BATCH_LANES];
+	       fftw_real tmp431[FFTW_BATCH_LANES];
+	       fftw_real tmp434[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp457[l] = tmp429[l] + tmp430[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp458[l] = tmp432[l] + tmp433[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp459[l] = (K956940335 * tmp457[l]) - (K290284677 * tmp458[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp467[l] = (K290284677 * tmp457[l]) + (K956940335 * tmp458[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp431[l] = tmp429[l] - tmp430[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp434[l] = tmp432[l] - tmp433[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp435[l] = (K471396736 * tmp431[l]) - (K881921264 * tmp434[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp447[l] = (K881921264 * tmp431[l]) + (K471396736 * tmp434[l]);
+	  }
+	  {
+	       fftw_real tmp424[FFTW_BATCH_LANES];
+	       fftw_real tmp427[FFTW_BATCH_LANES];
+	       fftw_real tmp437[FFTW_BATCH_LANES];
+	       fftw_real tmp438[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp424[l] = tmp422[l] - tmp423[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp427[l] = tmp425[l] - tmp426[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp428[l] = (K471396736 * tmp424[l]) + (K881921264 * tmp427[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp446[l] = (K471396736 * tmp427[l]) - (K881921264 * tmp424[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp437[l] = tmp371[l] + tmp374[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp438[l] = tmp208[l] + tmp215[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp439[l] = tmp437[l] - tmp438[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp461[l] = tmp437[l] + tmp438[l];
+	  }
+	  {
+	       fftw_real tmp440[FFTW_BATCH_LANES];
+	       fftw_real tmp441[FFTW_BATCH_LANES];
+	       fftw_real tmp416[FFTW_BATCH_LANES];
+	       fftw_real tmp419[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp440[l] = (K831469612 * tmp418[l]) - (K555570233 * tmp417[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp441[l] = (K555570233 * tmp414[l]) + (K831469612 * tmp415[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp442[l] = tmp440[l] - tmp441[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp452[l] = tmp441[l] + tmp440[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp416[l] = (K831469612 * tmp414[l]) - (K555570233 * tmp415[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp419[l] = (K831469612 * tmp417[l]) + (K555570233 * tmp418[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp420[l] = tmp416[l] - tmp419[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp462[l] = tmp416[l] + tmp419[l];
+	  }
+	  {
+	       fftw_real tmp421[FFTW_BATCH_LANES];
+	       fftw_real tmp436[FFTW_BATCH_LANES];
+	       fftw_real tmp443[FFTW_BATCH_LANES];
+	       fftw_real tmp444[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp421[l] = tmp413[l] + tmp420[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp436[l] = tmp428[l] + tmp435[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[43 * ostride + l * odist]) = tmp421[l] - tmp436[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[11 * ostride + l * odist]) = tmp421[l] + tmp436[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp443[l] = tmp439[l] - tmp442[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp444[l] = tmp435[l] - tmp428[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[59 * ostride + l * odist]) = tmp443[l] - tmp444[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[27 * ostride + l * odist]) = tmp443[l] + tmp444[l];
+	  }
+	  {
+	       fftw_real tmp449[FFTW_BATCH_LANES];
+	       fftw_real tmp450[FFTW_BATCH_LANES];
+	       fftw_real tmp445[FFTW_BATCH_LANES];
+	       fftw_real tmp448[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp449[l] = tmp439[l] + tmp442[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp450[l] = tmp446[l] + tmp447[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[43 * ostride + l * odist]) = tmp449[l] - tmp450[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[11 * ostride + l * odist]) = tmp449[l] + tmp450[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp445[l] = tmp413[l] - tmp420[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp448[l] = tmp446[l] - tmp447[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[59 * ostride + l * odist]) = tmp445[l] - tmp448[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[27 * ostride + l * odist]) = tmp445[l] + tmp448[l];
+	  }
+	  {
+	       fftw_real tmp453[FFTW_BATCH_LANES];
+	       fftw_real tmp460[FFTW_BATCH_LANES];
+	       fftw_real tmp463[FFTW_BATCH_LANES];
+	       fftw_real tmp464[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp453[l] = tmp451[l] + tmp452[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp460[l] = tmp456[l] + tmp459[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[35 * ostride + l * odist]) = tmp453[l] - tmp460[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[3 * ostride + l * odist]) = tmp453[l] + tmp460[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp463[l] = tmp461[l] - tmp462[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp464[l] = tmp459[l] - tmp456[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[51 * ostride + l * odist]) = tmp463[l] - tmp464[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[19 * ostride + l * odist]) = tmp463[l] + tmp464[l];
+	  }
+	  {
+	       fftw_real tmp469[FFTW_BATCH_LANES];
+	       fftw_real tmp470[FFTW_BATCH_LANES];
+	       fftw_real tmp465[FFTW_BATCH_LANES];
+	       fftw_real tmp468[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp469[l] = tmp461[l] + tmp462[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp470[l] = tmp466[l] + tmp467[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[35 * ostride + l * odist]) = tmp469[l] - tmp470[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[3 * ostride + l * odist]) = tmp469[l] + tmp470[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp465[l] = tmp451[l] - tmp452[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp468[l] = tmp466[l] - tmp467[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[51 * ostride + l * odist]) = tmp465[l] - tmp468[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[19 * ostride + l * odist]) = tmp465[l] + tmp468[l];
+	  }
+     }
+     {
+	  fftw_real tmp817[FFTW_BATCH_LANES];
+	  fftw_real tmp863[FFTW_BATCH_LANES];
+	  fftw_real tmp824[FFTW_BATCH_LANES];
+	  fftw_real tmp874[FFTW_BATCH_LANES];
+	  fftw_real tmp854[FFTW_BATCH_LANES];
+	  fftw_real tmp864[FFTW_BATCH_LANES];
+	  fftw_real tmp836[FFTW_BATCH_LANES];
+	  fftw_real tmp858[FFTW_BATCH_LANES];
+	  fftw_real tmp851[FFTW_BATCH_LANES];
+	  fftw_real tmp873[FFTW_BATCH_LANES];
+	  fftw_real tmp868[FFTW_BATCH_LANES];
+	  fftw_real tmp878[FFTW_BATCH_LANES];
+	  fftw_real tmp847[FFTW_BATCH_LANES];
+	  fftw_real tmp859[FFTW_BATCH_LANES];
+	  fftw_real tmp871[FFTW_BATCH_LANES];
+	  fftw_real tmp879[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp820[FFTW_BATCH_LANES];
+	       fftw_real tmp823[FFTW_BATCH_LANES];
+	       fftw_real tmp866[FFTW_BATCH_LANES];
+	       fftw_real tmp867[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp817[l] = tmp815[l] - tmp816[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp863[l] = tmp815[l] + tmp816[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp820[l] = tmp818[l] - tmp819[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp823[l] = tmp821[l] + tmp822[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp824[l] = K707106781 * (tmp820[l] - tmp823[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp874[l] = K707106781 * (tmp820[l] + tmp823[l]);
+	       {
+		    fftw_real tmp852[FFTW_BATCH_LANES];
+		    fftw_real tmp853[FFTW_BATCH_LANES];
+		    fftw_real tmp830[FFTW_BATCH_LANES];
+		    fftw_real tmp835[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp852[l] = tmp821[l] - tmp822[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp853[l] = tmp819[l] + tmp818[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp854[l] = K707106781 * (tmp852[l] - tmp853[l]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp864[l] = K707106781 * (tmp853[l] + tmp852[l]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp830[l] = tmp828[l] - tmp829[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp835[l] = tmp831[l] - tmp834[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp836[l] = (K923879532 * tmp830[l]) + (K382683432 * tmp835[l]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp858[l] = (K382683432 * tmp830[l]) - (K923879532 * tmp835[l]);
+	       }
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp851[l] = tmp849[l] - tmp850[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp873[l] = tmp850[l] + tmp849[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp866[l] = tmp829[l] + tmp828[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp867[l] = tmp831[l] + tmp834[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp868[l] = (K382683432 * tmp866[l]) + (K923879532 * tmp867[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp878[l] = (K923879532 * tmp866[l]) - (K382683432 * tmp867[l]);
+	       {
+		    fftw_real tmp841[FFTW_BATCH_LANES];
+		    fftw_real tmp846[FFTW_BATCH_LANES];
+		    fftw_real tmp869[FFTW_BATCH_LANES];
+		    fftw_real tmp870[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp841[l] = tmp837[l] - tmp840[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp846[l] = tmp844[l] - tmp845[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp847[l] = (K382683432 * tmp841[l]) - (K923879532 * tmp846[l]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp859[l] = (K382683432 * tmp846[l]) + (K923879532 * tmp841[l]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp869[l] = tmp837[l] + tmp840[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp870[l] = tmp845[l] + tmp844[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp871[l] = (K923879532 * tmp869[l]) - (K382683432 * tmp870[l]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp879[l] = (K923879532 * tmp870[l]) + (K382683432 * tmp869[l]);
+	       }
+	  }
+	  {
+	       fftw_real tmp825[FFTW_BATCH_LANES];
+	       fftw_real tmp848[FFTW_BATCH_LANES];
+	       fftw_real tmp855[FFTW_BATCH_LANES];
+	       fftw_real tmp856[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp825[l] = tmp817[l] + tmp824[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp848[l] = tmp836[l] + tmp847[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[44 * ostride + l * odist]) = tmp825[l] - tmp848[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[12 * ostride + l * odist]) = tmp825[l] + tmp848[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp855[l] = tmp851[l] - tmp854[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp856[l] = tmp847[l] - tmp836[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[60 * ostride + l * odist]) = tmp855[l] - tmp856[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[28 * ostride + l * odist]) = tmp855[l] + tmp856[l];
+	  }
+	  {
+	       fftw_real tmp861[FFTW_BATCH_LANES];
+	       fftw_real tmp862[FFTW_BATCH_LANES];
+	       fftw_real tmp857[FFTW_BATCH_LANES];
+	       fftw_real tmp860[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp861[l] = tmp851[l] + tmp854[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp862[l] = tmp858[l] + tmp859[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[44 * ostride + l * odist]) = tmp861[l] - tmp862[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[12 * ostride + l * odist]) = tmp861[l] + tmp862[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp857[l] = tmp817[l] - tmp824[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp860[l] = tmp858[l] - tmp859[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[60 * ostride + l * odist]) = tmp857[l] - tmp860[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[28 * ostride + l * odist]) = tmp857[l] + tmp860[l];
+	  }
+	  {
+	       fftw_real tmp865[FFTW_BATCH_LANES];
+	       fftw_real tmp872[FFTW_BATCH_LANES];
+	       fftw_real tmp875[FFTW_BATCH_LANES];
+	       fftw_real tmp876[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp865[l] = tmp863[l] + tmp864[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp872[l] = tmp868[l] + tmp871[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[36 * ostride + l * odist]) = tmp865[l] - tmp872[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[4 * ostride + l * odist]) = tmp865[l] + tmp872[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp875[l] = tmp873[l] - tmp874[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp876[l] = tmp871[l] - tmp868[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[52 * ostride + l * odist]) = tmp875[l] - tmp876[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[20 * ostride + l * odist]) = tmp875[l] + tmp876[l];
+	  }
+	  {
+	       fftw_real tmp881[FFTW_BATCH_LANES];
+	       fftw_real tmp882[FFTW_BATCH_LANES];
+	       fftw_real tmp877[FFTW_BATCH_LANES];
+	       fftw_real tmp880[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp881[l] = tmp873[l] + tmp874[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp882[l] = tmp878[l] + tmp879[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[36 * ostride + l * odist]) = tmp881[l] - tmp882[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[4 * ostride + l * odist]) = tmp881[l] + tmp882[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp877[l] = tmp863[l] - tmp864[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp880[l] = tmp878[l] - tmp879[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[52 * ostride + l * odist]) = tmp877[l] - tmp880[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[20 * ostride + l * odist]) = tmp877[l] + tmp880[l];
+	  }
+     }
+     {
+	  fftw_real tmp757[FFTW_BATCH_LANES];
+	  fftw_real tmp795[FFTW_BATCH_LANES];
+	  fftw_real tmp800[FFTW_BATCH_LANES];
+	  fftw_real tmp810[FFTW_BATCH_LANES];
+	  fftw_real tmp803[FFTW_BATCH_LANES];
+	  fftw_real tmp811[FFTW_BATCH_LANES];
+	  fftw_real tmp779[FFTW_BATCH_LANES];
+	  fftw_real tmp791[FFTW_BATCH_LANES];
+	  fftw_real tmp783[FFTW_BATCH_LANES];
+	  fftw_real tmp805[FFTW_BATCH_LANES];
+	  fftw_real tmp764[FFTW_BATCH_LANES];
+	  fftw_real tmp806[FFTW_BATCH_LANES];
+	  fftw_real tmp786[FFTW_BATCH_LANES];
+	  fftw_real tmp796[FFTW_BATCH_LANES];
+	  fftw_real tmp772[FFTW_BATCH_LANES];
+	  fftw_real tmp790[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp756[FFTW_BATCH_LANES];
+	       fftw_real tmp798[FFTW_BATCH_LANES];
+	       fftw_real tmp799[FFTW_BATCH_LANES];
+	       fftw_real tmp782[FFTW_BATCH_LANES];
+	       fftw_real tmp760[FFTW_BATCH_LANES];
+	       fftw_real tmp763[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp756[l] = K707106781 * (tmp721[l] + tmp720[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp757[l] = tmp755[l] - tmp756[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp795[l] = tmp755[l] + tmp756[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp798[l] = tmp766[l] + tmp767[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp799[l] = tmp769[l] + tmp770[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp800[l] = (K980785280 * tmp798[l]) + (K195090322 * tmp799[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp810[l] = (K980785280 * tmp799[l]) - (K195090322 * tmp798[l]);
+	       {
+		    fftw_real tmp801[FFTW_BATCH_LANES];
+		    fftw_real tmp802[FFTW_BATCH_LANES];
+		    fftw_real tmp775[FFTW_BATCH_LANES];
+		    fftw_real tmp778[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp801[l] = tmp773[l] + tmp774[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp802[l] = tmp776[l] + tmp777[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp803[l] = (K980785280 * tmp801[l]) - (K195090322 * tmp802[l]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp811[l] = (K195090322 * tmp801[l]) + (K980785280 * tmp802[l]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp775[l] = tmp773[l] - tmp774[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp778[l] = tmp776[l] - tmp777[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp779[l] = (K555570233 * tmp775[l]) - (K831469612 * tmp778[l]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp791[l] = (K831469612 * tmp775[l]) + (K555570233 * tmp778[l]);
+	       }
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp782[l] = K707106781 * (tmp640[l] + tmp643[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp783[l] = tmp781[l] - tmp782[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp805[l] = tmp781[l] + tmp782[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp760[l] = (K923879532 * tmp758[l]) - (K382683432 * tmp759[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp763[l] = (K923879532 * tmp761[l]) + (K382683432 * tmp762[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp764[l] = tmp760[l] - tmp763[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp806[l] = tmp760[l] + tmp763[l];
+	       {
+		    fftw_real tmp784[FFTW_BATCH_LANES];
+		    fftw_real tmp785[FFTW_BATCH_LANES];
+		    fftw_real tmp768[FFTW_BATCH_LANES];
+		    fftw_real tmp771[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp784[l] = (K923879532 * tmp762[l]) - (K382683432 * tmp761[l]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp785[l] = (K382683432 * tmp758[l]) + (K923879532 * tmp759[l]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp786[l] = tmp784[l] - tmp785[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp796[l] = tmp785[l] + tmp784[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp768[l] = tmp766[l] - tmp767[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp771[l] = tmp769[l] - tmp770[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp772[l] = (K555570233 * tmp768[l]) + (K831469612 * tmp771[l]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp790[l] = (K555570233 * tmp771[l]) - (K831469612 * tmp768[l]);
+	       }
+	  }
+	  {
+	       fftw_real tmp765[FFTW_BATCH_LANES];
+	       fftw_real tmp780[FFTW_BATCH_LANES];
+	       fftw_real tmp787[FFTW_BATCH_LANES];
+	       fftw_real tmp788[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp765[l] = tmp757[l] + tmp764[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp780[l] = tmp772[l] + tmp779[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[42 * ostride + l * odist]) = tmp765[l] - tmp780[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[10 * ostride + l * odist]) = tmp765[l] + tmp780[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp787[l] = tmp783[l] - tmp786[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp788[l] = tmp779[l] - tmp772[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[58 * ostride + l * odist]) = tmp787[l] - tmp788[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[26 * ostride + l * odist]) = tmp787[l] + tmp788[l];
+	  }
+	  {
+	       fftw_real tmp793[FFTW_BATCH_LANES];
+	       fftw_real tmp794[FFTW_BATCH_LANES];
+	       fftw_real tmp789[FFTW_BATCH_LANES];
+	       fftw_real tmp792[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp793[l] = tmp783[l] + tmp786[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp794[l] = tmp790[l] + tmp791[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[42 * ostride + l * odist]) = tmp793[l] - tmp794[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[10 * ostride + l * odist]) = tmp793[l] + tmp794[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp789[l] = tmp757[l] - tmp764[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp792[l] = tmp790[l] - tmp791[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[58 * ostride + l * odist]) = tmp789[l] - tmp792[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[26 * ostride + l * odist]) = tmp789[l] + tmp792[l];
+	  }
+	  {
+	       fftw_real tmp797[FFTW_BATCH_LANES];
+	       fftw_real tmp804[FFTW_BATCH_LANES];
+	       fftw_real tmp807[FFTW_BATCH_LANES];
+	       fftw_real tmp808[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp797[l] = tmp795[l] + tmp796[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp804[l] = tmp800[l] + tmp803[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[34 * ostride + l * odist]) = tmp797[l] - tmp804[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[2 * ostride + l * odist]) = tmp797[l] + tmp804[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp807[l] = tmp805[l] - tmp806[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp808[l] = tmp803[l] - tmp800[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[50 * ostride + l * odist]) = tmp807[l] - tmp808[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[18 * ostride + l * odist]) = tmp807[l] + tmp808[l];
+	  }
+	  {
+	       fftw_real tmp813[FFTW_BATCH_LANES];
+	       fftw_real tmp814[FFTW_BATCH_LANES];
+	       fftw_real tmp809[FFTW_BATCH_LANES];
+	       fftw_real tmp812[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp813[l] = tmp805[l] + tmp806[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp814[l] = tmp810[l] + tmp811[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[34 * ostride + l * odist]) = tmp813[l] - tmp814[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[2 * ostride + l * odist]) = tmp813[l] + tmp814[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp809[l] = tmp795[l] - tmp796[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp812[l] = tmp810[l] - tmp811[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[50 * ostride + l * odist]) = tmp809[l] - tmp812[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[18 * ostride + l * odist]) = tmp809[l] + tmp812[l];
+	  }
+     }
+     {
+	  fftw_real tmp645[FFTW_BATCH_LANES];
+	  fftw_real tmp735[FFTW_BATCH_LANES];
+	  fftw_real tmp740[FFTW_BATCH_LANES];
+	  fftw_real tmp750[FFTW_BATCH_LANES];
+	  fftw_real tmp743[FFTW_BATCH_LANES];
+	  fftw_real tmp751[FFTW_BATCH_LANES];
+	  fftw_real tmp715[FFTW_BATCH_LANES];
+	  fftw_real tmp731[FFTW_BATCH_LANES];
+	  fftw_real tmp723[FFTW_BATCH_LANES];
+	  fftw_real tmp745[FFTW_BATCH_LANES];
+	  fftw_real tmp660[FFTW_BATCH_LANES];
+	  fftw_real tmp746[FFTW_BATCH_LANES];
+	  fftw_real tmp726[FFTW_BATCH_LANES];
+	  fftw_real tmp736[FFTW_BATCH_LANES];
+	  fftw_real tmp688[FFTW_BATCH_LANES];
+	  fftw_real tmp730[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp644[FFTW_BATCH_LANES];
+	       fftw_real tmp738[FFTW_BATCH_LANES];
+	       fftw_real tmp739[FFTW_BATCH_LANES];
+	       fftw_real tmp722[FFTW_BATCH_LANES];
+	       fftw_real tmp652[FFTW_BATCH_LANES];
+	       fftw_real tmp659[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp644[l] = K707106781 * (tmp640[l] - tmp643[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp645[l] = tmp637[l] - tmp644[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp735[l] = tmp637[l] + tmp644[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp738[l] = tmp666[l] + tmp677[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp739[l] = tmp683[l] + tmp686[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp740[l] = (K555570233 * tmp738[l]) + (K831469612 * tmp739[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp750[l] = (K831469612 * tmp738[l]) - (K555570233 * tmp739[l]);
+	       {
+		    fftw_real tmp741[FFTW_BATCH_LANES];
+		    fftw_real tmp742[FFTW_BATCH_LANES];
+		    fftw_real tmp705[FFTW_BATCH_LANES];
+		    fftw_real tmp714[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp741[l] = tmp693[l] + tmp704[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp742[l] = tmp710[l] + tmp713[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp743[l] = (K831469612 * tmp741[l]) - (K555570233 * tmp742[l]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp751[l] = (K831469612 * tmp742[l]) + (K555570233 * tmp741[l]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp705[l] = tmp693[l] - tmp704[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp714[l] = tmp710[l] - tmp713[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp715[l] = (K195090322 * tmp705[l]) - (K980785280 * tmp714[l]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp731[l] = (K195090322 * tmp714[l]) + (K980785280 * tmp705[l]);
+	       }
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp722[l] = K707106781 * (tmp720[l] - tmp721[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp723[l] = tmp719[l] - tmp722[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp745[l] = tmp719[l] + tmp722[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp652[l] = (K382683432 * tmp648[l]) - (K923879532 * tmp651[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp659[l] = (K382683432 * tmp655[l]) + (K923879532 * tmp658[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp660[l] = tmp652[l] - tmp659[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp746[l] = tmp652[l] + tmp659[l];
+	       {
+		    fftw_real tmp724[FFTW_BATCH_LANES];
+		    fftw_real tmp725[FFTW_BATCH_LANES];
+		    fftw_real tmp678[FFTW_BATCH_LANES];
+		    fftw_real tmp687[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp724[l] = (K382683432 * tmp658[l]) - (K923879532 * tmp655[l]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp725[l] = (K923879532 * tmp648[l]) + (K382683432 * tmp651[l]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp726[l] = tmp724[l] - tmp725[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp736[l] = tmp725[l] + tmp724[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp678[l] = tmp666[l] - tmp677[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp687[l] = tmp683[l] - tmp686[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp688[l] = (K980785280 * tmp678[l]) + (K195090322 * tmp687[l]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp730[l] = (K195090322 * tmp678[l]) - (K980785280 * tmp687[l]);
+	       }
+	  }
+	  {
+	       fftw_real tmp661[FFTW_BATCH_LANES];
+	       fftw_real tmp716[FFTW_BATCH_LANES];
+	       fftw_real tmp727[FFTW_BATCH_LANES];
+	       fftw_real tmp728[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp661[l] = tmp645[l] + tmp660[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp716[l] = tmp688[l] + tmp715[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[46 * ostride + l * odist]) = tmp661[l] - tmp716[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[14 * ostride + l * odist]) = tmp661[l] + tmp716[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp727[l] = tmp723[l] - tmp726[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp728[l] = tmp715[l] - tmp688[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[62 * ostride + l * odist]) = tmp727[l] - tmp728[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[30 * ostride + l * odist]) = tmp727[l] + tmp728[l];
+	  }
+	  {
+	       fftw_real tmp733[FFTW_BATCH_LANES];
+	       fftw_real tmp734[FFTW_BATCH_LANES];
+	       fftw_real tmp729[FFTW_BATCH_LANES];
+	       fftw_real tmp732[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp733[l] = tmp723[l] + tmp726[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp734[l] = tmp730[l] + tmp731[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[46 * ostride + l * odist]) = tmp733[l] - tmp734[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[14 * ostride + l * odist]) = tmp733[l] + tmp734[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp729[l] = tmp645[l] - tmp660[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp732[l] = tmp730[l] - tmp731[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[62 * ostride + l * odist]) = tmp729[l] - tmp732[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[30 * ostride + l * odist]) = tmp729[l] + tmp732[l];
+	  }
+	  {
+	       fftw_real tmp737[FFTW_BATCH_LANES];
+	       fftw_real tmp744[FFTW_BATCH_LANES];
+	       fftw_real tmp747[FFTW_BATCH_LANES];
+	       fftw_real tmp748[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp737[l] = tmp735[l] + tmp736[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp744[l] = tmp740[l] + tmp743[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[38 * ostride + l * odist]) = tmp737[l] - tmp744[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[6 * ostride + l * odist]) = tmp737[l] + tmp744[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp747[l] = tmp745[l] - tmp746[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp748[l] = tmp743[l] - tmp740[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[54 * ostride + l * odist]) = tmp747[l] - tmp748[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[22 * ostride + l * odist]) = tmp747[l] + tmp748[l];
+	  }
+	  {
+	       fftw_real tmp753[FFTW_BATCH_LANES];
+	       fftw_real tmp754[FFTW_BATCH_LANES];
+	       fftw_real tmp749[FFTW_BATCH_LANES];
+	       fftw_real tmp752[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp753[l] = tmp745[l] + tmp746[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp754[l] = tmp750[l] + tmp751[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[38 * ostride + l * odist]) = tmp753[l] - tmp754[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[6 * ostride + l * odist]) = tmp753[l] + tmp754[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp749[l] = tmp735[l] - tmp736[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp752[l] = tmp750[l] - tmp751[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[54 * ostride + l * odist]) = tmp749[l] - tmp752[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[22 * ostride + l * odist]) = tmp749[l] + tmp752[l];
+	  }
+     }
+     {
+	  fftw_real tmp481[FFTW_BATCH_LANES];
+	  fftw_real tmp555[FFTW_BATCH_LANES];
+	  fftw_real tmp560[FFTW_BATCH_LANES];
+	  fftw_real tmp570[FFTW_BATCH_LANES];
+	  fftw_real tmp563[FFTW_BATCH_LANES];
+	  fftw_real tmp571[FFTW_BATCH_LANES];
+	  fftw_real tmp535[FFTW_BATCH_LANES];
+	  fftw_real tmp551[FFTW_BATCH_LANES];
+	  fftw_real tmp516[FFTW_BATCH_LANES];
+	  fftw_real tmp550[FFTW_BATCH_LANES];
+	  fftw_real tmp543[FFTW_BATCH_LANES];
+	  fftw_real tmp565[FFTW_BATCH_LANES];
+	  fftw_real tmp546[FFTW_BATCH_LANES];
+	  fftw_real tmp556[FFTW_BATCH_LANES];
+	  fftw_real tmp496[FFTW_BATCH_LANES];
+	  fftw_real tmp566[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp473[FFTW_BATCH_LANES];
+	       fftw_real tmp480[FFTW_BATCH_LANES];
+	       fftw_real tmp558[FFTW_BATCH_LANES];
+	       fftw_real tmp559[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp473[l] = tmp471[l] - tmp472[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp480[l] = tmp476[l] - tmp479[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp481[l] = tmp473[l] - tmp480[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp555[l] = tmp473[l] + tmp480[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp558[l] = tmp500[l] + tmp507[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp559[l] = tmp511[l] + tmp514[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp560[l] = (K471396736 * tmp558[l]) + (K881921264 * tmp559[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp570[l] = (K881921264 * tmp558[l]) - (K471396736 * tmp559[l]);
+	  }
+	  {
+	       fftw_real tmp561[FFTW_BATCH_LANES];
+	       fftw_real tmp562[FFTW_BATCH_LANES];
+	       fftw_real tmp527[FFTW_BATCH_LANES];
+	       fftw_real tmp534[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp561[l] = tmp519[l] + tmp526[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp562[l] = tmp530[l] + tmp533[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp563[l] = (K881921264 * tmp561[l]) - (K471396736 * tmp562[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp571[l] = (K881921264 * tmp562[l]) + (K471396736 * tmp561[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp527[l] = tmp519[l] - tmp526[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp534[l] = tmp530[l] - tmp533[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp535[l] = (K290284677 * tmp527[l]) - (K956940335 * tmp534[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp551[l] = (K290284677 * tmp534[l]) + (K956940335 * tmp527[l]);
+	  }
+	  {
+	       fftw_real tmp508[FFTW_BATCH_LANES];
+	       fftw_real tmp515[FFTW_BATCH_LANES];
+	       fftw_real tmp539[FFTW_BATCH_LANES];
+	       fftw_real tmp542[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp508[l] = tmp500[l] - tmp507[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp515[l] = tmp511[l] - tmp514[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp516[l] = (K956940335 * tmp508[l]) + (K290284677 * tmp515[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp550[l] = (K290284677 * tmp508[l]) - (K956940335 * tmp515[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp539[l] = tmp537[l] - tmp538[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp542[l] = tmp540[l] - tmp541[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp543[l] = tmp539[l] - tmp542[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp565[l] = tmp539[l] + tmp542[l];
+	  }
+	  {
+	       fftw_real tmp544[FFTW_BATCH_LANES];
+	       fftw_real tmp545[FFTW_BATCH_LANES];
+	       fftw_real tmp488[FFTW_BATCH_LANES];
+	       fftw_real tmp495[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp544[l] = (K555570233 * tmp491[l]) - (K831469612 * tmp494[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp545[l] = (K555570233 * tmp487[l]) + (K831469612 * tmp484[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp546[l] = tmp544[l] - tmp545[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp556[l] = tmp545[l] + tmp544[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp488[l] = (K555570233 * tmp484[l]) - (K831469612 * tmp487[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp495[l] = (K831469612 * tmp491[l]) + (K555570233 * tmp494[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp496[l] = tmp488[l] - tmp495[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp566[l] = tmp488[l] + tmp495[l];
+	  }
+	  {
+	       fftw_real tmp497[FFTW_BATCH_LANES];
+	       fftw_real tmp536[FFTW_BATCH_LANES];
+	       fftw_real tmp547[FFTW_BATCH_LANES];
+	       fftw_real tmp548[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp497[l] = tmp481[l] + tmp496[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp536[l] = tmp516[l] + tmp535[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[45 * ostride + l * odist]) = tmp497[l] - tmp536[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[13 * ostride + l * odist]) = tmp497[l] + tmp536[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp547[l] = tmp543[l] - tmp546[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp548[l] = tmp535[l] - tmp516[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[61 * ostride + l * odist]) = tmp547[l] - tmp548[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[29 * ostride + l * odist]) = tmp547[l] + tmp548[l];
+	  }
+	  {
+	       fftw_real tmp553[FFTW_BATCH_LANES];
+	       fftw_real tmp554[FFTW_BATCH_LANES];
+	       fftw_real tmp549[FFTW_BATCH_LANES];
+	       fftw_real tmp552[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp553[l] = tmp543[l] + tmp546[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp554[l] = tmp550[l] + tmp551[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[45 * ostride + l * odist]) = tmp553[l] - tmp554[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[13 * ostride + l * odist]) = tmp553[l] + tmp554[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp549[l] = tmp481[l] - tmp496[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp552[l] = tmp550[l] - tmp551[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[61 * ostride + l * odist]) = tmp549[l] - tmp552[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[29 * ostride + l * odist]) = tmp549[l] + tmp552[l];
+	  }
+	  {
+	       fftw_real tmp557[FFTW_BATCH_LANES];
+	       fftw_real tmp564[FFTW_BATCH_LANES];
+	       fftw_real tmp567[FFTW_BATCH_LANES];
+	       fftw_real tmp568[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp557[l] = tmp555[l] + tmp556[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp564[l] = tmp560[l] + tmp563[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[37 * ostride + l * odist]) = tmp557[l] - tmp564[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[5 * ostride + l * odist]) = tmp557[l] + tmp564[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp567[l] = tmp565[l] - tmp566[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp568[l] = tmp563[l] - tmp560[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[53 * ostride + l * odist]) = tmp567[l] - tmp568[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[21 * ostride + l * odist]) = tmp567[l] + tmp568[l];
+	  }
+	  {
+	       fftw_real tmp573[FFTW_BATCH_LANES];
+	       fftw_real tmp574[FFTW_BATCH_LANES];
+	       fftw_real tmp569[FFTW_BATCH_LANES];
+	       fftw_real tmp572[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp573[l] = tmp565[l] + tmp566[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp574[l] = tmp570[l] + tmp571[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[37 * ostride + l * odist]) = tmp573[l] - tmp574[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[5 * ostride + l * odist]) = tmp573[l] + tmp574[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp569[l] = tmp555[l] - tmp556[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp572[l] = tmp570[l] - tmp571[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[53 * ostride + l * odist]) = tmp569[l] - tmp572[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[21 * ostride + l * odist]) = tmp569[l] + tmp572[l];
+	  }
+     }
+     {
+	  fftw_real tmp577[FFTW_BATCH_LANES];
+	  fftw_real tmp615[FFTW_BATCH_LANES];
+	  fftw_real tmp620[FFTW_BATCH_LANES];
+	  fftw_real tmp630[FFTW_BATCH_LANES];
+	  fftw_real tmp623[FFTW_BATCH_LANES];
+	  fftw_real tmp631[FFTW_BATCH_LANES];
+	  fftw_real tmp599[FFTW_BATCH_LANES];
+	  fftw_real tmp611[FFTW_BATCH_LANES];
+	  fftw_real tmp592[FFTW_BATCH_LANES];
+	  fftw_real tmp610[FFTW_BATCH_LANES];
+	  fftw_real tmp603[FFTW_BATCH_LANES];
+	  fftw_real tmp625[FFTW_BATCH_LANES];
+	  fftw_real tmp606[FFTW_BATCH_LANES];
+	  fftw_real tmp616[FFTW_BATCH_LANES];
+	  fftw_real tmp584[FFTW_BATCH_LANES];
+	  fftw_real tmp626[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp575[FFTW_BATCH_LANES];
+	       fftw_real tmp576[FFTW_BATCH_LANES];
+	       fftw_real tmp618[FFTW_BATCH_LANES];
+	       fftw_real tmp619[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp575[l] = tmp471[l] + tmp472[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp576[l] = tmp541[l] + tmp540[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp577[l] = tmp575[l] - tmp576[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp615[l] = tmp575[l] + tmp576[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp618[l] = tmp586[l] + tmp587[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp619[l] = tmp589[l] + tmp590[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp620[l] = (K995184726 * tmp618[l]) + (K098017140 * tmp619[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp630[l] = (K995184726 * tmp619[l]) - (K098017140 * tmp618[l]);
+	  }
+	  {
+	       fftw_real tmp621[FFTW_BATCH_LANES];
+	       fftw_real tmp622[FFTW_BATCH_LANES];
+	       fftw_real tmp595[FFTW_BATCH_LANES];
+	       fftw_real tmp598[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp621[l] = tmp593[l] + tmp594[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp622[l] = tmp596[l] + tmp597[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp623[l] = (K995184726 * tmp621[l]) - (K098017140 * tmp622[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp631[l] = (K098017140 * tmp621[l]) + (K995184726 * tmp622[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp595[l] = tmp593[l] - tmp594[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp598[l] = tmp596[l] - tmp597[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp599[l] = (K634393284 * tmp595[l]) - (K773010453 * tmp598[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp611[l] = (K773010453 * tmp595[l]) + (K634393284 * tmp598[l]);
+	  }
+	  {
+	       fftw_real tmp588[FFTW_BATCH_LANES];
+	       fftw_real tmp591[FFTW_BATCH_LANES];
+	       fftw_real tmp601[FFTW_BATCH_LANES];
+	       fftw_real tmp602[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp588[l] = tmp586[l] - tmp587[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp591[l] = tmp589[l] - tmp590[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp592[l] = (K634393284 * tmp588[l]) + (K773010453 * tmp591[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp610[l] = (K634393284 * tmp591[l]) - (K773010453 * tmp588[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp601[l] = tmp537[l] + tmp538[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp602[l] = tmp476[l] + tmp479[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp603[l] = tmp601[l] - tmp602[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp625[l] = tmp601[l] + tmp602[l];
+	  }
+	  {
+	       fftw_real tmp604[FFTW_BATCH_LANES];
+	       fftw_real tmp605[FFTW_BATCH_LANES];
+	       fftw_real tmp580[FFTW_BATCH_LANES];
+	       fftw_real tmp583[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp604[l] = (K980785280 * tmp581[l]) - (K195090322 * tmp582[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp605[l] = (K980785280 * tmp579[l]) + (K195090322 * tmp578[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp606[l] = tmp604[l] - tmp605[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp616[l] = tmp605[l] + tmp604[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp580[l] = (K980785280 * tmp578[l]) - (K195090322 * tmp579[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp583[l] = (K195090322 * tmp581[l]) + (K980785280 * tmp582[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp584[l] = tmp580[l] - tmp583[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp626[l] = tmp580[l] + tmp583[l];
+	  }
+	  {
+	       fftw_real tmp585[FFTW_BATCH_LANES];
+	       fftw_real tmp600[FFTW_BATCH_LANES];
+	       fftw_real tmp607[FFTW_BATCH_LANES];
+	       fftw_real tmp608[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp585[l] = tmp577[l] + tmp584[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp600[l] = tmp592[l] + tmp599[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[41 * ostride + l * odist]) = tmp585[l] - tmp600[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[9 * ostride + l * odist]) = tmp585[l] + tmp600[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp607[l] = tmp603[l] - tmp606[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp608[l] = tmp599[l] - tmp592[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[57 * ostride + l * odist]) = tmp607[l] - tmp608[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[25 * ostride + l * odist]) = tmp607[l] + tmp608[l];
+	  }
+	  {
+	       fftw_real tmp613[FFTW_BATCH_LANES];
+	       fftw_real tmp614[FFTW_BATCH_LANES];
+	       fftw_real tmp609[FFTW_BATCH_LANES];
+	       fftw_real tmp612[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp613[l] = tmp603[l] + tmp606[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp614[l] = tmp610[l] + tmp611[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[41 * ostride + l * odist]) = tmp613[l] - tmp614[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[9 * ostride + l * odist]) = tmp613[l] + tmp614[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp609[l] = tmp577[l] - tmp584[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp612[l] = tmp610[l] - tmp611[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[57 * ostride + l * odist]) = tmp609[l] - tmp612[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[25 * ostride + l * odist]) = tmp609[l] + tmp612[l];
+	  }
+	  {
+	       fftw_real tmp617[FFTW_BATCH_LANES];
+	       fftw_real tmp624[FFTW_BATCH_LANES];
+	       fftw_real tmp627[FFTW_BATCH_LANES];
+	       fftw_real tmp628[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp617[l] = tmp615[l] + tmp616[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp624[l] = tmp620[l] + tmp623[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[33 * ostride + l * odist]) = tmp617[l] - tmp624[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[ostride + l * odist]) = tmp617[l] + tmp624[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp627[l] = tmp625[l] - tmp626[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp628[l] = tmp623[l] - tmp620[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[49 * ostride + l * odist]) = tmp627[l] - tmp628[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[17 * ostride + l * odist]) = tmp627[l] + tmp628[l];
+	  }
+	  {
+	       fftw_real tmp633[FFTW_BATCH_LANES];
+	       fftw_real tmp634[FFTW_BATCH_LANES];
+	       fftw_real tmp629[FFTW_BATCH_LANES];
+	       fftw_real tmp632[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp633[l] = tmp625[l] + tmp626[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp634[l] = tmp630[l] + tmp631[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[33 * ostride + l * odist]) = tmp633[l] - tmp634[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[ostride + l * odist]) = tmp633[l] + tmp634[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp629[l] = tmp615[l] - tmp616[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp632[l] = tmp630[l] - tmp631[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[49 * ostride + l * odist]) = tmp629[l] - tmp632[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[17 * ostride + l * odist]) = tmp629[l] + tmp632[l];
+	  }
+     }
+}
+
+fftw_codelet_desc fftw_no_twiddle_batch_64_desc =
+{
+     "fftw_no_twiddle_batch_64",
+     (void (*)()) fftw_no_twiddle_batch_64,
+     64,
+     FFTW_FORWARD,
+     FFTW_NOTW,
+     1409,
+     0,
+     (const int *) 0,
+};
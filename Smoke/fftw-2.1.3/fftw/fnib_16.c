@@ -0,0 +1,617 @@
+/*
+ * Copyright (c) 1997-1999 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sun Nov  7 20:44:15 EST 1999 */
+
+#include <fftw-int.h>
+#include <fftw.h>
+
+/* Generated by: ./genfft -magic-alignment-check -magic-twiddle-load-all -magic-variables 4 -magic-loopi -notwiddleinv 16 */
+/* Batch version generated by: sh makebatch.sh fni_16.c */
+
+/*
+ * This function contains 144 FP additions, 24 FP multiplications,
+ * (or, 136 additions, 16 multiplications, 8 fused multiply/add),
+ * 46 stack variables, and 64 memory accesses
+ */
+static const fftw_real K382683432 = FFTW_KONST(+0.382683432365089771728459984030398866761344562);
+static const fftw_real K923879532 = FFTW_KONST(+0.923879532511286756128183189396788286822416626);
+static const fftw_real K707106781 = FFTW_KONST(+0.707106781186547524400844362104849039284835938);
+
+/*
+ * Generator Id's : 
+ * $Id: exprdag.ml,v 1.41 1999/05/26 15:44:14 fftw Exp $
+ * $Id: fft.ml,v 1.43 1999/05/17 19:44:18 fftw Exp $
+ * $Id: to_c.ml,v 1.25 1999/10/26 21:41:32 stevenj Exp $
+ */
+
+void fftwi_no_twiddle_batch_16(const fftw_complex *input, fftw_complex *output, int istride, int ostride, int idist, int odist)
+{
+     int l;
+     fftw_real tmp7[FFTW_BATCH_LANES];
+     fftw_real tmp129[FFTW_BATCH_LANES];
+     fftw_real tmp38[FFTW_BATCH_LANES];
+     fftw_real tmp115[FFTW_BATCH_LANES];
+     fftw_real tmp49[FFTW_BATCH_LANES];
+     fftw_real tmp95[FFTW_BATCH_LANES];
+     fftw_real tmp83[FFTW_BATCH_LANES];
+     fftw_real tmp105[FFTW_BATCH_LANES];
+     fftw_real tmp29[FFTW_BATCH_LANES];
+     fftw_real tmp123[FFTW_BATCH_LANES];
+     fftw_real tmp73[FFTW_BATCH_LANES];
+     fftw_real tmp101[FFTW_BATCH_LANES];
+     fftw_real tmp78[FFTW_BATCH_LANES];
+     fftw_real tmp102[FFTW_BATCH_LANES];
+     fftw_real tmp126[FFTW_BATCH_LANES];
+     fftw_real tmp141[FFTW_BATCH_LANES];
+     fftw_real tmp14[FFTW_BATCH_LANES];
+     fftw_real tmp116[FFTW_BATCH_LANES];
+     fftw_real tmp45[FFTW_BATCH_LANES];
+     fftw_real tmp130[FFTW_BATCH_LANES];
+     fftw_real tmp52[FFTW_BATCH_LANES];
+     fftw_real tmp84[FFTW_BATCH_LANES];
+     fftw_real tmp55[FFTW_BATCH_LANES];
+     fftw_real tmp85[FFTW_BATCH_LANES];
+     fftw_real tmp22[FFTW_BATCH_LANES];
+     fftw_real tmp118[FFTW_BATCH_LANES];
+     fftw_real tmp62[FFTW_BATCH_LANES];
+     fftw_real tmp98[FFTW_BATCH_LANES];
+     fftw_real tmp67[FFTW_BATCH_LANES];
+     fftw_real tmp99[FFTW_BATCH_LANES];
+     fftw_real tmp121[FFTW_BATCH_LANES];
+     fftw_real tmp140[FFTW_BATCH_LANES];
+     ASSERT_ALIGNED_DOUBLE;
+     {
+	  fftw_real tmp3[FFTW_BATCH_LANES];
+	  fftw_real tmp81[FFTW_BATCH_LANES];
+	  fftw_real tmp34[FFTW_BATCH_LANES];
+	  fftw_real tmp48[FFTW_BATCH_LANES];
+	  fftw_real tmp6[FFTW_BATCH_LANES];
+	  fftw_real tmp47[FFTW_BATCH_LANES];
+	  fftw_real tmp37[FFTW_BATCH_LANES];
+	  fftw_real tmp82[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp1[FFTW_BATCH_LANES];
+	       fftw_real tmp2[FFTW_BATCH_LANES];
+	       fftw_real tmp32[FFTW_BATCH_LANES];
+	       fftw_real tmp33[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp1[l] = c_re(input[l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp2[l] = c_re(input[8 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp3[l] = tmp1[l] + tmp2[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp81[l] = tmp1[l] - tmp2[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp32[l] = c_im(input[l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp33[l] = c_im(input[8 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp34[l] = tmp32[l] + tmp33[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp48[l] = tmp32[l] - tmp33[l];
+	  }
+	  {
+	       fftw_real tmp4[FFTW_BATCH_LANES];
+	       fftw_real tmp5[FFTW_BATCH_LANES];
+	       fftw_real tmp35[FFTW_BATCH_LANES];
+	       fftw_real tmp36[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp4[l] = c_re(input[4 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp5[l] = c_re(input[12 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp6[l] = tmp4[l] + tmp5[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp47[l] = tmp4[l] - tmp5[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp35[l] = c_im(input[4 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp36[l] = c_im(input[12 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp37[l] = tmp35[l] + tmp36[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp82[l] = tmp35[l] - tmp36[l];
+	  }
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp7[l] = tmp3[l] + tmp6[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp129[l] = tmp3[l] - tmp6[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp38[l] = tmp34[l] + tmp37[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp115[l] = tmp34[l] - tmp37[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp49[l] = tmp47[l] + tmp48[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp95[l] = tmp48[l] - tmp47[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp83[l] = tmp81[l] - tmp82[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp105[l] = tmp81[l] + tmp82[l];
+     }
+     {
+	  fftw_real tmp25[FFTW_BATCH_LANES];
+	  fftw_real tmp74[FFTW_BATCH_LANES];
+	  fftw_real tmp72[FFTW_BATCH_LANES];
+	  fftw_real tmp124[FFTW_BATCH_LANES];
+	  fftw_real tmp28[FFTW_BATCH_LANES];
+	  fftw_real tmp69[FFTW_BATCH_LANES];
+	  fftw_real tmp77[FFTW_BATCH_LANES];
+	  fftw_real tmp125[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp23[FFTW_BATCH_LANES];
+	       fftw_real tmp24[FFTW_BATCH_LANES];
+	       fftw_real tmp70[FFTW_BATCH_LANES];
+	       fftw_real tmp71[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp23[l] = c_re(input[15 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp24[l] = c_re(input[7 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp25[l] = tmp23[l] + tmp24[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp74[l] = tmp23[l] - tmp24[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp70[l] = c_im(input[15 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp71[l] = c_im(input[7 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp72[l] = tmp70[l] - tmp71[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp124[l] = tmp70[l] + tmp71[l];
+	  }
+	  {
+	       fftw_real tmp26[FFTW_BATCH_LANES];
+	       fftw_real tmp27[FFTW_BATCH_LANES];
+	       fftw_real tmp75[FFTW_BATCH_LANES];
+	       fftw_real tmp76[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp26[l] = c_re(input[3 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp27[l] = c_re(input[11 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp28[l] = tmp26[l] + tmp27[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp69[l] = tmp26[l] - tmp27[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp75[l] = c_im(input[3 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp76[l] = c_im(input[11 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp77[l] = tmp75[l] - tmp76[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp125[l] = tmp75[l] + tmp76[l];
+	  }
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp29[l] = tmp25[l] + tmp28[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp123[l] = tmp25[l] - tmp28[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp73[l] = tmp69[l] + tmp72[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp101[l] = tmp72[l] - tmp69[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp78[l] = tmp74[l] - tmp77[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp102[l] = tmp74[l] + tmp77[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp126[l] = tmp124[l] - tmp125[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp141[l] = tmp124[l] + tmp125[l];
+     }
+     {
+	  fftw_real tmp10[FFTW_BATCH_LANES];
+	  fftw_real tmp50[FFTW_BATCH_LANES];
+	  fftw_real tmp41[FFTW_BATCH_LANES];
+	  fftw_real tmp51[FFTW_BATCH_LANES];
+	  fftw_real tmp13[FFTW_BATCH_LANES];
+	  fftw_real tmp54[FFTW_BATCH_LANES];
+	  fftw_real tmp44[FFTW_BATCH_LANES];
+	  fftw_real tmp53[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp8[FFTW_BATCH_LANES];
+	       fftw_real tmp9[FFTW_BATCH_LANES];
+	       fftw_real tmp39[FFTW_BATCH_LANES];
+	       fftw_real tmp40[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp8[l] = c_re(input[2 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp9[l] = c_re(input[10 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp10[l] = tmp8[l] + tmp9[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp50[l] = tmp8[l] - tmp9[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp39[l] = c_im(input[2 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp40[l] = c_im(input[10 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp41[l] = tmp39[l] + tmp40[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp51[l] = tmp39[l] - tmp40[l];
+	  }
+	  {
+	       fftw_real tmp11[FFTW_BATCH_LANES];
+	       fftw_real tmp12[FFTW_BATCH_LANES];
+	       fftw_real tmp42[FFTW_BATCH_LANES];
+	       fftw_real tmp43[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp11[l] = c_re(input[14 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp12[l] = c_re(input[6 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp13[l] = tmp11[l] + tmp12[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp54[l] = tmp11[l] - tmp12[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp42[l] = c_im(input[14 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp43[l] = c_im(input[6 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp44[l] = tmp42[l] + tmp43[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp53[l] = tmp42[l] - tmp43[l];
+	  }
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp14[l] = tmp10[l] + tmp13[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp116[l] = tmp10[l] - tmp13[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp45[l] = tmp41[l] + tmp44[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp130[l] = tmp44[l] - tmp41[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp52[l] = tmp50[l] + tmp51[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp84[l] = tmp50[l] - tmp51[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp55[l] = tmp53[l] - tmp54[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp85[l] = tmp54[l] + tmp53[l];
+     }
+     {
+	  fftw_real tmp18[FFTW_BATCH_LANES];
+	  fftw_real tmp63[FFTW_BATCH_LANES];
+	  fftw_real tmp61[FFTW_BATCH_LANES];
+	  fftw_real tmp119[FFTW_BATCH_LANES];
+	  fftw_real tmp21[FFTW_BATCH_LANES];
+	  fftw_real tmp58[FFTW_BATCH_LANES];
+	  fftw_real tmp66[FFTW_BATCH_LANES];
+	  fftw_real tmp120[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp16[FFTW_BATCH_LANES];
+	       fftw_real tmp17[FFTW_BATCH_LANES];
+	       fftw_real tmp59[FFTW_BATCH_LANES];
+	       fftw_real tmp60[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp16[l] = c_re(input[istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp17[l] = c_re(input[9 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp18[l] = tmp16[l] + tmp17[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp63[l] = tmp16[l] - tmp17[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp59[l] = c_im(input[istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp60[l] = c_im(input[9 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp61[l] = tmp59[l] - tmp60[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp119[l] = tmp59[l] + tmp60[l];
+	  }
+	  {
+	       fftw_real tmp19[FFTW_BATCH_LANES];
+	       fftw_real tmp20[FFTW_BATCH_LANES];
+	       fftw_real tmp64[FFTW_BATCH_LANES];
+	       fftw_real tmp65[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp19[l] = c_re(input[5 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp20[l] = c_re(input[13 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp21[l] = tmp19[l] + tmp20[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp58[l] = tmp19[l] - tmp20[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp64[l] = c_im(input[5 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp65[l] = c_im(input[13 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp66[l] = tmp64[l] - tmp65[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp120[l] = tmp64[l] + tmp65[l];
+	  }
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp22[l] = tmp18[l] + tmp21[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp118[l] = tmp18[l] - tmp21[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp62[l] = tmp58[l] + tmp61[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp98[l] = tmp61[l] - tmp58[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp67[l] = tmp63[l] - tmp66[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp99[l] = tmp63[l] + tmp66[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp121[l] = tmp119[l] - tmp120[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp140[l] = tmp119[l] + tmp120[l];
+     }
+     {
+	  fftw_real tmp15[FFTW_BATCH_LANES];
+	  fftw_real tmp30[FFTW_BATCH_LANES];
+	  fftw_real tmp31[FFTW_BATCH_LANES];
+	  fftw_real tmp46[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp15[l] = tmp7[l] + tmp14[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp30[l] = tmp22[l] + tmp29[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[8 * ostride + l * odist]) = tmp15[l] - tmp30[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[l * odist]) = tmp15[l] + tmp30[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp31[l] = tmp22[l] - tmp29[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp46[l] = tmp38[l] - tmp45[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[4 * ostride + l * odist]) = tmp31[l] + tmp46[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[12 * ostride + l * odist]) = tmp46[l] - tmp31[l];
+     }
+     {
+	  fftw_real tmp139[FFTW_BATCH_LANES];
+	  fftw_real tmp142[FFTW_BATCH_LANES];
+	  fftw_real tmp143[FFTW_BATCH_LANES];
+	  fftw_real tmp144[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp139[l] = tmp38[l] + tmp45[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp142[l] = tmp140[l] + tmp141[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[8 * ostride + l * odist]) = tmp139[l] - tmp142[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[l * odist]) = tmp139[l] + tmp142[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp143[l] = tmp7[l] - tmp14[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp144[l] = tmp141[l] - tmp140[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[12 * ostride + l * odist]) = tmp143[l] - tmp144[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[4 * ostride + l * odist]) = tmp143[l] + tmp144[l];
+     }
+     {
+	  fftw_real tmp117[FFTW_BATCH_LANES];
+	  fftw_real tmp131[FFTW_BATCH_LANES];
+	  fftw_real tmp128[FFTW_BATCH_LANES];
+	  fftw_real tmp132[FFTW_BATCH_LANES];
+	  fftw_real tmp122[FFTW_BATCH_LANES];
+	  fftw_real tmp127[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp117[l] = tmp115[l] - tmp116[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp131[l] = tmp129[l] + tmp130[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp122[l] = tmp118[l] - tmp121[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp127[l] = tmp123[l] + tmp126[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp128[l] = K707106781 * (tmp122[l] - tmp127[l]);
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp132[l] = K707106781 * (tmp122[l] + tmp127[l]);
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[14 * ostride + l * odist]) = tmp117[l] - tmp128[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[6 * ostride + l * odist]) = tmp117[l] + tmp128[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[10 * ostride + l * odist]) = tmp131[l] - tmp132[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[2 * ostride + l * odist]) = tmp131[l] + tmp132[l];
+     }
+     {
+	  fftw_real tmp133[FFTW_BATCH_LANES];
+	  fftw_real tmp137[FFTW_BATCH_LANES];
+	  fftw_real tmp136[FFTW_BATCH_LANES];
+	  fftw_real tmp138[FFTW_BATCH_LANES];
+	  fftw_real tmp134[FFTW_BATCH_LANES];
+	  fftw_real tmp135[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp133[l] = tmp116[l] + tmp115[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp137[l] = tmp129[l] - tmp130[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp134[l] = tmp118[l] + tmp121[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp135[l] = tmp126[l] - tmp123[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp136[l] = K707106781 * (tmp134[l] + tmp135[l]);
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp138[l] = K707106781 * (tmp135[l] - tmp134[l]);
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[10 * ostride + l * odist]) = tmp133[l] - tmp136[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[2 * ostride + l * odist]) = tmp133[l] + tmp136[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[14 * ostride + l * odist]) = tmp137[l] - tmp138[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[6 * ostride + l * odist]) = tmp137[l] + tmp138[l];
+     }
+     {
+	  fftw_real tmp57[FFTW_BATCH_LANES];
+	  fftw_real tmp89[FFTW_BATCH_LANES];
+	  fftw_real tmp92[FFTW_BATCH_LANES];
+	  fftw_real tmp94[FFTW_BATCH_LANES];
+	  fftw_real tmp87[FFTW_BATCH_LANES];
+	  fftw_real tmp93[FFTW_BATCH_LANES];
+	  fftw_real tmp80[FFTW_BATCH_LANES];
+	  fftw_real tmp88[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp56[FFTW_BATCH_LANES];
+	       fftw_real tmp90[FFTW_BATCH_LANES];
+	       fftw_real tmp91[FFTW_BATCH_LANES];
+	       fftw_real tmp86[FFTW_BATCH_LANES];
+	       fftw_real tmp68[FFTW_BATCH_LANES];
+	       fftw_real tmp79[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp56[l] = K707106781 * (tmp52[l] + tmp55[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp57[l] = tmp49[l] + tmp56[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp89[l] = tmp49[l] - tmp56[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp90[l] = (K923879532 * tmp67[l]) - (K382683432 * tmp62[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp91[l] = (K382683432 * tmp73[l]) + (K923879532 * tmp78[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp92[l] = tmp90[l] - tmp91[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp94[l] = tmp90[l] + tmp91[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp86[l] = K707106781 * (tmp84[l] + tmp85[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp87[l] = tmp83[l] - tmp86[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp93[l] = tmp83[l] + tmp86[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp68[l] = (K923879532 * tmp62[l]) + (K382683432 * tmp67[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp79[l] = (K923879532 * tmp73[l]) - (K382683432 * tmp78[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp80[l] = tmp68[l] + tmp79[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp88[l] = tmp79[l] - tmp68[l];
+	  }
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[9 * ostride + l * odist]) = tmp57[l] - tmp80[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[ostride + l * odist]) = tmp57[l] + tmp80[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[13 * ostride + l * odist]) = tmp87[l] - tmp88[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[5 * ostride + l * odist]) = tmp87[l] + tmp88[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[13 * ostride + l * odist]) = tmp89[l] - tmp92[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[5 * ostride + l * odist]) = tmp89[l] + tmp92[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[9 * ostride + l * odist]) = tmp93[l] - tmp94[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[ostride + l * odist]) = tmp93[l] + tmp94[l];
+     }
+     {
+	  fftw_real tmp97[FFTW_BATCH_LANES];
+	  fftw_real tmp109[FFTW_BATCH_LANES];
+	  fftw_real tmp112[FFTW_BATCH_LANES];
+	  fftw_real tmp114[FFTW_BATCH_LANES];
+	  fftw_real tmp107[FFTW_BATCH_LANES];
+	  fftw_real tmp113[FFTW_BATCH_LANES];
+	  fftw_real tmp104[FFTW_BATCH_LANES];
+	  fftw_real tmp108[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp96[FFTW_BATCH_LANES];
+	       fftw_real tmp110[FFTW_BATCH_LANES];
+	       fftw_real tmp111[FFTW_BATCH_LANES];
+	       fftw_real tmp106[FFTW_BATCH_LANES];
+	       fftw_real tmp100[FFTW_BATCH_LANES];
+	       fftw_real tmp103[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp96[l] = K707106781 * (tmp84[l] - tmp85[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp97[l] = tmp95[l] + tmp96[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp109[l] = tmp95[l] - tmp96[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp110[l] = (K382683432 * tmp99[l]) - (K923879532 * tmp98[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp111[l] = (K923879532 * tmp101[l]) + (K382683432 * tmp102[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp112[l] = tmp110[l] - tmp111[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp114[l] = tmp110[l] + tmp111[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp106[l] = K707106781 * (tmp55[l] - tmp52[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp107[l] = tmp105[l] - tmp106[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp113[l] = tmp105[l] + tmp106[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp100[l] = (K382683432 * tmp98[l]) + (K923879532 * tmp99[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp103[l] = (K382683432 * tmp101[l]) - (K923879532 * tmp102[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp104[l] = tmp100[l] + tmp103[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp108[l] = tmp103[l] - tmp100[l];
+	  }
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[11 * ostride + l * odist]) = tmp97[l] - tmp104[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[3 * ostride + l * odist]) = tmp97[l] + tmp104[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[15 * ostride + l * odist]) = tmp107[l] - tmp108[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[7 * ostride + l * odist]) = tmp107[l] + tmp108[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[15 * ostride + l * odist]) = tmp109[l] - tmp112[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[7 * ostride + l * odist]) = tmp109[l] + tmp112[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[11 * ostride + l * odist]) = tmp113[l] - tmp114[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[3 * ostride + l * odist]) = tmp113[l] + tmp114[l];
+     }
+}
+
+fftw_codelet_desc fftwi_no_twiddle_batch_16_desc =
+{
+     "fftwi_no_twiddle_batch_16",
+     (void (*)()) fftwi_no_twiddle_batch_16,
+     16,
+     FFTW_BACKWARD,
+     FFTW_NOTW,
+     364,
+     0,
+     (const int *) 0,
+};
@@ -0,0 +1,1480 @@
+/*
+ * Copyright (c) 1997-1999 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/* This file was automatically generated --- DO NOT EDIT */
+/* Generated on Sun Nov  7 20:44:16 EST 1999 */
+
+#include <fftw-int.h>
+#include <fftw.h>
+
+/* Generated by: ./genfft -magic-alignment-check -magic-twiddle-load-all -magic-variables 4 -magic-loopi -notwiddleinv 32 */
+/* Batch version generated by: sh makebatch.sh fni_32.c */
+
+/*
+ * This function contains 372 FP additions, 84 FP multiplications,
+ * (or, 340 additions, 52 multiplications, 32 fused multiply/add),
+ * 92 stack variables, and 128 memory accesses
+ */
+static const fftw_real K195090322 = FFTW_KONST(+0.195090322016128267848284868477022240927691618);
+static const fftw_real K980785280 = FFTW_KONST(+0.980785280403230449126182236134239036973933731);
+static const fftw_real K831469612 = FFTW_KONST(+0.831469612302545237078788377617905756738560812);
+static const fftw_real K555570233 = FFTW_KONST(+0.555570233019602224742830813948532874374937191);
+static const fftw_real K382683432 = FFTW_KONST(+0.382683432365089771728459984030398866761344562);
+static const fftw_real K923879532 = FFTW_KONST(+0.923879532511286756128183189396788286822416626);
+static const fftw_real K707106781 = FFTW_KONST(+0.707106781186547524400844362104849039284835938);
+
+/*
+ * Generator Id's : 
+ * $Id: exprdag.ml,v 1.41 1999/05/26 15:44:14 fftw Exp $
+ * $Id: fft.ml,v 1.43 1999/05/17 19:44:18 fftw Exp $
+ * $Id: to_c.ml,v 1.25 1999/10/26 21:41:32 stevenj Exp $
+ */
+
+void fftwi_no_twiddle_batch_32(const fftw_complex *input, fftw_complex *output, int istride, int ostride, int idist, int odist)
+{
+     int l;
+     fftw_real tmp7[FFTW_BATCH_LANES];
+     fftw_real tmp339[FFTW_BATCH_LANES];
+     fftw_real tmp70[FFTW_BATCH_LANES];
+     fftw_real tmp313[FFTW_BATCH_LANES];
+     fftw_real tmp97[FFTW_BATCH_LANES];
+     fftw_real tmp215[FFTW_BATCH_LANES];
+     fftw_real tmp179[FFTW_BATCH_LANES];
+     fftw_real tmp241[FFTW_BATCH_LANES];
+     fftw_real tmp14[FFTW_BATCH_LANES];
+     fftw_real tmp314[FFTW_BATCH_LANES];
+     fftw_real tmp77[FFTW_BATCH_LANES];
+     fftw_real tmp340[FFTW_BATCH_LANES];
+     fftw_real tmp182[FFTW_BATCH_LANES];
+     fftw_real tmp216[FFTW_BATCH_LANES];
+     fftw_real tmp104[FFTW_BATCH_LANES];
+     fftw_real tmp242[FFTW_BATCH_LANES];
+     fftw_real tmp153[FFTW_BATCH_LANES];
+     fftw_real tmp236[FFTW_BATCH_LANES];
+     fftw_real tmp53[FFTW_BATCH_LANES];
+     fftw_real tmp60[FFTW_BATCH_LANES];
+     fftw_real tmp287[FFTW_BATCH_LANES];
+     fftw_real tmp336[FFTW_BATCH_LANES];
+     fftw_real tmp360[FFTW_BATCH_LANES];
+     fftw_real tmp290[FFTW_BATCH_LANES];
+     fftw_real tmp293[FFTW_BATCH_LANES];
+     fftw_real tmp294[FFTW_BATCH_LANES];
+     fftw_real tmp170[FFTW_BATCH_LANES];
+     fftw_real tmp233[FFTW_BATCH_LANES];
+     fftw_real tmp333[FFTW_BATCH_LANES];
+     fftw_real tmp359[FFTW_BATCH_LANES];
+     fftw_real tmp164[FFTW_BATCH_LANES];
+     fftw_real tmp234[FFTW_BATCH_LANES];
+     fftw_real tmp173[FFTW_BATCH_LANES];
+     fftw_real tmp237[FFTW_BATCH_LANES];
+     fftw_real tmp22[FFTW_BATCH_LANES];
+     fftw_real tmp318[FFTW_BATCH_LANES];
+     fftw_real tmp343[FFTW_BATCH_LANES];
+     fftw_real tmp85[FFTW_BATCH_LANES];
+     fftw_real tmp112[FFTW_BATCH_LANES];
+     fftw_real tmp185[FFTW_BATCH_LANES];
+     fftw_real tmp220[FFTW_BATCH_LANES];
+     fftw_real tmp245[FFTW_BATCH_LANES];
+     fftw_real tmp29[FFTW_BATCH_LANES];
+     fftw_real tmp321[FFTW_BATCH_LANES];
+     fftw_real tmp342[FFTW_BATCH_LANES];
+     fftw_real tmp92[FFTW_BATCH_LANES];
+     fftw_real tmp119[FFTW_BATCH_LANES];
+     fftw_real tmp184[FFTW_BATCH_LANES];
+     fftw_real tmp223[FFTW_BATCH_LANES];
+     fftw_real tmp244[FFTW_BATCH_LANES];
+     fftw_real tmp126[FFTW_BATCH_LANES];
+     fftw_real tmp229[FFTW_BATCH_LANES];
+     fftw_real tmp38[FFTW_BATCH_LANES];
+     fftw_real tmp45[FFTW_BATCH_LANES];
+     fftw_real tmp278[FFTW_BATCH_LANES];
+     fftw_real tmp329[FFTW_BATCH_LANES];
+     fftw_real tmp357[FFTW_BATCH_LANES];
+     fftw_real tmp281[FFTW_BATCH_LANES];
+     fftw_real tmp284[FFTW_BATCH_LANES];
+     fftw_real tmp285[FFTW_BATCH_LANES];
+     fftw_real tmp143[FFTW_BATCH_LANES];
+     fftw_real tmp226[FFTW_BATCH_LANES];
+     fftw_real tmp326[FFTW_BATCH_LANES];
+     fftw_real tmp356[FFTW_BATCH_LANES];
+     fftw_real tmp137[FFTW_BATCH_LANES];
+     fftw_real tmp227[FFTW_BATCH_LANES];
+     fftw_real tmp146[FFTW_BATCH_LANES];
+     fftw_real tmp230[FFTW_BATCH_LANES];
+     ASSERT_ALIGNED_DOUBLE;
+     {
+	  fftw_real tmp3[FFTW_BATCH_LANES];
+	  fftw_real tmp177[FFTW_BATCH_LANES];
+	  fftw_real tmp66[FFTW_BATCH_LANES];
+	  fftw_real tmp96[FFTW_BATCH_LANES];
+	  fftw_real tmp6[FFTW_BATCH_LANES];
+	  fftw_real tmp95[FFTW_BATCH_LANES];
+	  fftw_real tmp69[FFTW_BATCH_LANES];
+	  fftw_real tmp178[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp1[FFTW_BATCH_LANES];
+	       fftw_real tmp2[FFTW_BATCH_LANES];
+	       fftw_real tmp64[FFTW_BATCH_LANES];
+	       fftw_real tmp65[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp1[l] = c_re(input[l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp2[l] = c_re(input[16 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp3[l] = tmp1[l] + tmp2[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp177[l] = tmp1[l] - tmp2[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp64[l] = c_im(input[l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp65[l] = c_im(input[16 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp66[l] = tmp64[l] + tmp65[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp96[l] = tmp64[l] - tmp65[l];
+	  }
+	  {
+	       fftw_real tmp4[FFTW_BATCH_LANES];
+	       fftw_real tmp5[FFTW_BATCH_LANES];
+	       fftw_real tmp67[FFTW_BATCH_LANES];
+	       fftw_real tmp68[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp4[l] = c_re(input[8 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp5[l] = c_re(input[24 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp6[l] = tmp4[l] + tmp5[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp95[l] = tmp4[l] - tmp5[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp67[l] = c_im(input[8 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp68[l] = c_im(input[24 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp69[l] = tmp67[l] + tmp68[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp178[l] = tmp67[l] - tmp68[l];
+	  }
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp7[l] = tmp3[l] + tmp6[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp339[l] = tmp3[l] - tmp6[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp70[l] = tmp66[l] + tmp69[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp313[l] = tmp66[l] - tmp69[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp97[l] = tmp95[l] + tmp96[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp215[l] = tmp96[l] - tmp95[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp179[l] = tmp177[l] - tmp178[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp241[l] = tmp177[l] + tmp178[l];
+     }
+     {
+	  fftw_real tmp10[FFTW_BATCH_LANES];
+	  fftw_real tmp98[FFTW_BATCH_LANES];
+	  fftw_real tmp73[FFTW_BATCH_LANES];
+	  fftw_real tmp99[FFTW_BATCH_LANES];
+	  fftw_real tmp13[FFTW_BATCH_LANES];
+	  fftw_real tmp102[FFTW_BATCH_LANES];
+	  fftw_real tmp76[FFTW_BATCH_LANES];
+	  fftw_real tmp101[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp8[FFTW_BATCH_LANES];
+	       fftw_real tmp9[FFTW_BATCH_LANES];
+	       fftw_real tmp71[FFTW_BATCH_LANES];
+	       fftw_real tmp72[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp8[l] = c_re(input[4 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp9[l] = c_re(input[20 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp10[l] = tmp8[l] + tmp9[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp98[l] = tmp8[l] - tmp9[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp71[l] = c_im(input[4 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp72[l] = c_im(input[20 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp73[l] = tmp71[l] + tmp72[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp99[l] = tmp71[l] - tmp72[l];
+	  }
+	  {
+	       fftw_real tmp11[FFTW_BATCH_LANES];
+	       fftw_real tmp12[FFTW_BATCH_LANES];
+	       fftw_real tmp74[FFTW_BATCH_LANES];
+	       fftw_real tmp75[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp11[l] = c_re(input[28 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp12[l] = c_re(input[12 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp13[l] = tmp11[l] + tmp12[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp102[l] = tmp11[l] - tmp12[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp74[l] = c_im(input[28 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp75[l] = c_im(input[12 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp76[l] = tmp74[l] + tmp75[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp101[l] = tmp74[l] - tmp75[l];
+	  }
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp14[l] = tmp10[l] + tmp13[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp314[l] = tmp10[l] - tmp13[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp77[l] = tmp73[l] + tmp76[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp340[l] = tmp76[l] - tmp73[l];
+	  {
+	       fftw_real tmp180[FFTW_BATCH_LANES];
+	       fftw_real tmp181[FFTW_BATCH_LANES];
+	       fftw_real tmp100[FFTW_BATCH_LANES];
+	       fftw_real tmp103[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp180[l] = tmp98[l] - tmp99[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp181[l] = tmp102[l] + tmp101[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp182[l] = K707106781 * (tmp180[l] + tmp181[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp216[l] = K707106781 * (tmp180[l] - tmp181[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp100[l] = tmp98[l] + tmp99[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp103[l] = tmp101[l] - tmp102[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp104[l] = K707106781 * (tmp100[l] + tmp103[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp242[l] = K707106781 * (tmp103[l] - tmp100[l]);
+	  }
+     }
+     {
+	  fftw_real tmp49[FFTW_BATCH_LANES];
+	  fftw_real tmp149[FFTW_BATCH_LANES];
+	  fftw_real tmp169[FFTW_BATCH_LANES];
+	  fftw_real tmp288[FFTW_BATCH_LANES];
+	  fftw_real tmp52[FFTW_BATCH_LANES];
+	  fftw_real tmp166[FFTW_BATCH_LANES];
+	  fftw_real tmp152[FFTW_BATCH_LANES];
+	  fftw_real tmp289[FFTW_BATCH_LANES];
+	  fftw_real tmp56[FFTW_BATCH_LANES];
+	  fftw_real tmp154[FFTW_BATCH_LANES];
+	  fftw_real tmp157[FFTW_BATCH_LANES];
+	  fftw_real tmp291[FFTW_BATCH_LANES];
+	  fftw_real tmp59[FFTW_BATCH_LANES];
+	  fftw_real tmp159[FFTW_BATCH_LANES];
+	  fftw_real tmp162[FFTW_BATCH_LANES];
+	  fftw_real tmp292[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp47[FFTW_BATCH_LANES];
+	       fftw_real tmp48[FFTW_BATCH_LANES];
+	       fftw_real tmp167[FFTW_BATCH_LANES];
+	       fftw_real tmp168[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp47[l] = c_re(input[31 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp48[l] = c_re(input[15 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp49[l] = tmp47[l] + tmp48[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp149[l] = tmp47[l] - tmp48[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp167[l] = c_im(input[31 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp168[l] = c_im(input[15 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp169[l] = tmp167[l] - tmp168[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp288[l] = tmp167[l] + tmp168[l];
+	  }
+	  {
+	       fftw_real tmp50[FFTW_BATCH_LANES];
+	       fftw_real tmp51[FFTW_BATCH_LANES];
+	       fftw_real tmp150[FFTW_BATCH_LANES];
+	       fftw_real tmp151[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp50[l] = c_re(input[7 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp51[l] = c_re(input[23 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp52[l] = tmp50[l] + tmp51[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp166[l] = tmp50[l] - tmp51[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp150[l] = c_im(input[7 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp151[l] = c_im(input[23 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp152[l] = tmp150[l] - tmp151[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp289[l] = tmp150[l] + tmp151[l];
+	  }
+	  {
+	       fftw_real tmp54[FFTW_BATCH_LANES];
+	       fftw_real tmp55[FFTW_BATCH_LANES];
+	       fftw_real tmp155[FFTW_BATCH_LANES];
+	       fftw_real tmp156[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp54[l] = c_re(input[3 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp55[l] = c_re(input[19 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp56[l] = tmp54[l] + tmp55[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp154[l] = tmp54[l] - tmp55[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp155[l] = c_im(input[3 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp156[l] = c_im(input[19 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp157[l] = tmp155[l] - tmp156[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp291[l] = tmp155[l] + tmp156[l];
+	  }
+	  {
+	       fftw_real tmp57[FFTW_BATCH_LANES];
+	       fftw_real tmp58[FFTW_BATCH_LANES];
+	       fftw_real tmp160[FFTW_BATCH_LANES];
+	       fftw_real tmp161[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp57[l] = c_re(input[27 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp58[l] = c_re(input[11 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp59[l] = tmp57[l] + tmp58[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp159[l] = tmp57[l] - tmp58[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp160[l] = c_im(input[27 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp161[l] = c_im(input[11 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp162[l] = tmp160[l] - tmp161[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp292[l] = tmp160[l] + tmp161[l];
+	  }
+	  {
+	       fftw_real tmp334[FFTW_BATCH_LANES];
+	       fftw_real tmp335[FFTW_BATCH_LANES];
+	       fftw_real tmp331[FFTW_BATCH_LANES];
+	       fftw_real tmp332[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp153[l] = tmp149[l] - tmp152[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp236[l] = tmp149[l] + tmp152[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp53[l] = tmp49[l] + tmp52[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp60[l] = tmp56[l] + tmp59[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp287[l] = tmp53[l] - tmp60[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp334[l] = tmp49[l] - tmp52[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp335[l] = tmp292[l] - tmp291[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp336[l] = tmp334[l] - tmp335[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp360[l] = tmp334[l] + tmp335[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp290[l] = tmp288[l] + tmp289[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp293[l] = tmp291[l] + tmp292[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp294[l] = tmp290[l] - tmp293[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp170[l] = tmp166[l] + tmp169[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp233[l] = tmp169[l] - tmp166[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp331[l] = tmp288[l] - tmp289[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp332[l] = tmp56[l] - tmp59[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp333[l] = tmp331[l] - tmp332[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp359[l] = tmp332[l] + tmp331[l];
+	       {
+		    fftw_real tmp158[FFTW_BATCH_LANES];
+		    fftw_real tmp163[FFTW_BATCH_LANES];
+		    fftw_real tmp171[FFTW_BATCH_LANES];
+		    fftw_real tmp172[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp158[l] = tmp154[l] - tmp157[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp163[l] = tmp159[l] + tmp162[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp164[l] = K707106781 * (tmp158[l] + tmp163[l]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp234[l] = K707106781 * (tmp158[l] - tmp163[l]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp171[l] = tmp154[l] + tmp157[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp172[l] = tmp162[l] - tmp159[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp173[l] = K707106781 * (tmp171[l] + tmp172[l]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp237[l] = K707106781 * (tmp172[l] - tmp171[l]);
+	       }
+	  }
+     }
+     {
+	  fftw_real tmp18[FFTW_BATCH_LANES];
+	  fftw_real tmp106[FFTW_BATCH_LANES];
+	  fftw_real tmp81[FFTW_BATCH_LANES];
+	  fftw_real tmp110[FFTW_BATCH_LANES];
+	  fftw_real tmp21[FFTW_BATCH_LANES];
+	  fftw_real tmp109[FFTW_BATCH_LANES];
+	  fftw_real tmp84[FFTW_BATCH_LANES];
+	  fftw_real tmp107[FFTW_BATCH_LANES];
+	  fftw_real tmp316[FFTW_BATCH_LANES];
+	  fftw_real tmp317[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp16[FFTW_BATCH_LANES];
+	       fftw_real tmp17[FFTW_BATCH_LANES];
+	       fftw_real tmp79[FFTW_BATCH_LANES];
+	       fftw_real tmp80[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp16[l] = c_re(input[2 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp17[l] = c_re(input[18 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp18[l] = tmp16[l] + tmp17[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp106[l] = tmp16[l] - tmp17[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp79[l] = c_im(input[2 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp80[l] = c_im(input[18 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp81[l] = tmp79[l] + tmp80[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp110[l] = tmp79[l] - tmp80[l];
+	  }
+	  {
+	       fftw_real tmp19[FFTW_BATCH_LANES];
+	       fftw_real tmp20[FFTW_BATCH_LANES];
+	       fftw_real tmp82[FFTW_BATCH_LANES];
+	       fftw_real tmp83[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp19[l] = c_re(input[10 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp20[l] = c_re(input[26 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp21[l] = tmp19[l] + tmp20[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp109[l] = tmp19[l] - tmp20[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp82[l] = c_im(input[10 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp83[l] = c_im(input[26 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp84[l] = tmp82[l] + tmp83[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp107[l] = tmp82[l] - tmp83[l];
+	  }
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp22[l] = tmp18[l] + tmp21[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp316[l] = tmp18[l] - tmp21[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp317[l] = tmp81[l] - tmp84[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp318[l] = tmp316[l] - tmp317[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp343[l] = tmp316[l] + tmp317[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp85[l] = tmp81[l] + tmp84[l];
+	  {
+	       fftw_real tmp108[FFTW_BATCH_LANES];
+	       fftw_real tmp111[FFTW_BATCH_LANES];
+	       fftw_real tmp218[FFTW_BATCH_LANES];
+	       fftw_real tmp219[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp108[l] = tmp106[l] - tmp107[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp111[l] = tmp109[l] + tmp110[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp112[l] = (K923879532 * tmp108[l]) - (K382683432 * tmp111[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp185[l] = (K923879532 * tmp111[l]) + (K382683432 * tmp108[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp218[l] = tmp106[l] + tmp107[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp219[l] = tmp110[l] - tmp109[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp220[l] = (K382683432 * tmp218[l]) - (K923879532 * tmp219[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp245[l] = (K382683432 * tmp219[l]) + (K923879532 * tmp218[l]);
+	  }
+     }
+     {
+	  fftw_real tmp25[FFTW_BATCH_LANES];
+	  fftw_real tmp116[FFTW_BATCH_LANES];
+	  fftw_real tmp88[FFTW_BATCH_LANES];
+	  fftw_real tmp114[FFTW_BATCH_LANES];
+	  fftw_real tmp28[FFTW_BATCH_LANES];
+	  fftw_real tmp113[FFTW_BATCH_LANES];
+	  fftw_real tmp91[FFTW_BATCH_LANES];
+	  fftw_real tmp117[FFTW_BATCH_LANES];
+	  fftw_real tmp319[FFTW_BATCH_LANES];
+	  fftw_real tmp320[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp23[FFTW_BATCH_LANES];
+	       fftw_real tmp24[FFTW_BATCH_LANES];
+	       fftw_real tmp86[FFTW_BATCH_LANES];
+	       fftw_real tmp87[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp23[l] = c_re(input[30 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp24[l] = c_re(input[14 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp25[l] = tmp23[l] + tmp24[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp116[l] = tmp23[l] - tmp24[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp86[l] = c_im(input[30 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp87[l] = c_im(input[14 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp88[l] = tmp86[l] + tmp87[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp114[l] = tmp86[l] - tmp87[l];
+	  }
+	  {
+	       fftw_real tmp26[FFTW_BATCH_LANES];
+	       fftw_real tmp27[FFTW_BATCH_LANES];
+	       fftw_real tmp89[FFTW_BATCH_LANES];
+	       fftw_real tmp90[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp26[l] = c_re(input[6 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp27[l] = c_re(input[22 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp28[l] = tmp26[l] + tmp27[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp113[l] = tmp26[l] - tmp27[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp89[l] = c_im(input[6 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp90[l] = c_im(input[22 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp91[l] = tmp89[l] + tmp90[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp117[l] = tmp89[l] - tmp90[l];
+	  }
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp29[l] = tmp25[l] + tmp28[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp319[l] = tmp25[l] - tmp28[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp320[l] = tmp88[l] - tmp91[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp321[l] = tmp319[l] + tmp320[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp342[l] = tmp320[l] - tmp319[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       tmp92[l] = tmp88[l] + tmp91[l];
+	  {
+	       fftw_real tmp115[FFTW_BATCH_LANES];
+	       fftw_real tmp118[FFTW_BATCH_LANES];
+	       fftw_real tmp221[FFTW_BATCH_LANES];
+	       fftw_real tmp222[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp115[l] = tmp113[l] + tmp114[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp118[l] = tmp116[l] - tmp117[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp119[l] = (K382683432 * tmp115[l]) + (K923879532 * tmp118[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp184[l] = (K923879532 * tmp115[l]) - (K382683432 * tmp118[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp221[l] = tmp114[l] - tmp113[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp222[l] = tmp116[l] + tmp117[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp223[l] = (K923879532 * tmp221[l]) + (K382683432 * tmp222[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp244[l] = (K382683432 * tmp221[l]) - (K923879532 * tmp222[l]);
+	  }
+     }
+     {
+	  fftw_real tmp34[FFTW_BATCH_LANES];
+	  fftw_real tmp122[FFTW_BATCH_LANES];
+	  fftw_real tmp142[FFTW_BATCH_LANES];
+	  fftw_real tmp279[FFTW_BATCH_LANES];
+	  fftw_real tmp37[FFTW_BATCH_LANES];
+	  fftw_real tmp139[FFTW_BATCH_LANES];
+	  fftw_real tmp125[FFTW_BATCH_LANES];
+	  fftw_real tmp280[FFTW_BATCH_LANES];
+	  fftw_real tmp41[FFTW_BATCH_LANES];
+	  fftw_real tmp127[FFTW_BATCH_LANES];
+	  fftw_real tmp130[FFTW_BATCH_LANES];
+	  fftw_real tmp282[FFTW_BATCH_LANES];
+	  fftw_real tmp44[FFTW_BATCH_LANES];
+	  fftw_real tmp132[FFTW_BATCH_LANES];
+	  fftw_real tmp135[FFTW_BATCH_LANES];
+	  fftw_real tmp283[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp32[FFTW_BATCH_LANES];
+	       fftw_real tmp33[FFTW_BATCH_LANES];
+	       fftw_real tmp140[FFTW_BATCH_LANES];
+	       fftw_real tmp141[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp32[l] = c_re(input[istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp33[l] = c_re(input[17 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp34[l] = tmp32[l] + tmp33[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp122[l] = tmp32[l] - tmp33[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp140[l] = c_im(input[istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp141[l] = c_im(input[17 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp142[l] = tmp140[l] - tmp141[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp279[l] = tmp140[l] + tmp141[l];
+	  }
+	  {
+	       fftw_real tmp35[FFTW_BATCH_LANES];
+	       fftw_real tmp36[FFTW_BATCH_LANES];
+	       fftw_real tmp123[FFTW_BATCH_LANES];
+	       fftw_real tmp124[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp35[l] = c_re(input[9 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp36[l] = c_re(input[25 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp37[l] = tmp35[l] + tmp36[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp139[l] = tmp35[l] - tmp36[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp123[l] = c_im(input[9 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp124[l] = c_im(input[25 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp125[l] = tmp123[l] - tmp124[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp280[l] = tmp123[l] + tmp124[l];
+	  }
+	  {
+	       fftw_real tmp39[FFTW_BATCH_LANES];
+	       fftw_real tmp40[FFTW_BATCH_LANES];
+	       fftw_real tmp128[FFTW_BATCH_LANES];
+	       fftw_real tmp129[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp39[l] = c_re(input[5 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp40[l] = c_re(input[21 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp41[l] = tmp39[l] + tmp40[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp127[l] = tmp39[l] - tmp40[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp128[l] = c_im(input[5 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp129[l] = c_im(input[21 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp130[l] = tmp128[l] - tmp129[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp282[l] = tmp128[l] + tmp129[l];
+	  }
+	  {
+	       fftw_real tmp42[FFTW_BATCH_LANES];
+	       fftw_real tmp43[FFTW_BATCH_LANES];
+	       fftw_real tmp133[FFTW_BATCH_LANES];
+	       fftw_real tmp134[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp42[l] = c_re(input[29 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp43[l] = c_re(input[13 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp44[l] = tmp42[l] + tmp43[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp132[l] = tmp42[l] - tmp43[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp133[l] = c_im(input[29 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp134[l] = c_im(input[13 * istride + l * idist]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp135[l] = tmp133[l] - tmp134[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp283[l] = tmp133[l] + tmp134[l];
+	  }
+	  {
+	       fftw_real tmp327[FFTW_BATCH_LANES];
+	       fftw_real tmp328[FFTW_BATCH_LANES];
+	       fftw_real tmp324[FFTW_BATCH_LANES];
+	       fftw_real tmp325[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp126[l] = tmp122[l] - tmp125[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp229[l] = tmp122[l] + tmp125[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp38[l] = tmp34[l] + tmp37[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp45[l] = tmp41[l] + tmp44[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp278[l] = tmp38[l] - tmp45[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp327[l] = tmp34[l] - tmp37[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp328[l] = tmp283[l] - tmp282[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp329[l] = tmp327[l] - tmp328[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp357[l] = tmp327[l] + tmp328[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp281[l] = tmp279[l] + tmp280[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp284[l] = tmp282[l] + tmp283[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp285[l] = tmp281[l] - tmp284[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp143[l] = tmp139[l] + tmp142[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp226[l] = tmp142[l] - tmp139[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp324[l] = tmp279[l] - tmp280[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp325[l] = tmp41[l] - tmp44[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp326[l] = tmp324[l] - tmp325[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp356[l] = tmp325[l] + tmp324[l];
+	       {
+		    fftw_real tmp131[FFTW_BATCH_LANES];
+		    fftw_real tmp136[FFTW_BATCH_LANES];
+		    fftw_real tmp144[FFTW_BATCH_LANES];
+		    fftw_real tmp145[FFTW_BATCH_LANES];
+		    ASSERT_ALIGNED_DOUBLE;
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp131[l] = tmp127[l] - tmp130[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp136[l] = tmp132[l] + tmp135[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp137[l] = K707106781 * (tmp131[l] + tmp136[l]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp227[l] = K707106781 * (tmp131[l] - tmp136[l]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp144[l] = tmp127[l] + tmp130[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp145[l] = tmp135[l] - tmp132[l];
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp146[l] = K707106781 * (tmp144[l] + tmp145[l]);
+		    for (l = 0; l < FFTW_BATCH_LANES; ++l)
+		         tmp230[l] = K707106781 * (tmp145[l] - tmp144[l]);
+	       }
+	  }
+     }
+     {
+	  fftw_real tmp277[FFTW_BATCH_LANES];
+	  fftw_real tmp301[FFTW_BATCH_LANES];
+	  fftw_real tmp304[FFTW_BATCH_LANES];
+	  fftw_real tmp306[FFTW_BATCH_LANES];
+	  fftw_real tmp296[FFTW_BATCH_LANES];
+	  fftw_real tmp300[FFTW_BATCH_LANES];
+	  fftw_real tmp299[FFTW_BATCH_LANES];
+	  fftw_real tmp305[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp275[FFTW_BATCH_LANES];
+	       fftw_real tmp276[FFTW_BATCH_LANES];
+	       fftw_real tmp302[FFTW_BATCH_LANES];
+	       fftw_real tmp303[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp275[l] = tmp70[l] - tmp77[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp276[l] = tmp22[l] - tmp29[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp277[l] = tmp275[l] - tmp276[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp301[l] = tmp276[l] + tmp275[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp302[l] = tmp278[l] + tmp285[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp303[l] = tmp294[l] - tmp287[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp304[l] = K707106781 * (tmp302[l] + tmp303[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp306[l] = K707106781 * (tmp303[l] - tmp302[l]);
+	  }
+	  {
+	       fftw_real tmp286[FFTW_BATCH_LANES];
+	       fftw_real tmp295[FFTW_BATCH_LANES];
+	       fftw_real tmp297[FFTW_BATCH_LANES];
+	       fftw_real tmp298[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp286[l] = tmp278[l] - tmp285[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp295[l] = tmp287[l] + tmp294[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp296[l] = K707106781 * (tmp286[l] - tmp295[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp300[l] = K707106781 * (tmp286[l] + tmp295[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp297[l] = tmp7[l] - tmp14[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp298[l] = tmp92[l] - tmp85[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp299[l] = tmp297[l] + tmp298[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp305[l] = tmp297[l] - tmp298[l];
+	  }
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[28 * ostride + l * odist]) = tmp277[l] - tmp296[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[12 * ostride + l * odist]) = tmp277[l] + tmp296[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[20 * ostride + l * odist]) = tmp299[l] - tmp300[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[4 * ostride + l * odist]) = tmp299[l] + tmp300[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[20 * ostride + l * odist]) = tmp301[l] - tmp304[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[4 * ostride + l * odist]) = tmp301[l] + tmp304[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[28 * ostride + l * odist]) = tmp305[l] - tmp306[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[12 * ostride + l * odist]) = tmp305[l] + tmp306[l];
+     }
+     {
+	  fftw_real tmp31[FFTW_BATCH_LANES];
+	  fftw_real tmp311[FFTW_BATCH_LANES];
+	  fftw_real tmp310[FFTW_BATCH_LANES];
+	  fftw_real tmp312[FFTW_BATCH_LANES];
+	  fftw_real tmp62[FFTW_BATCH_LANES];
+	  fftw_real tmp63[FFTW_BATCH_LANES];
+	  fftw_real tmp94[FFTW_BATCH_LANES];
+	  fftw_real tmp307[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp15[FFTW_BATCH_LANES];
+	       fftw_real tmp30[FFTW_BATCH_LANES];
+	       fftw_real tmp308[FFTW_BATCH_LANES];
+	       fftw_real tmp309[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp15[l] = tmp7[l] + tmp14[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp30[l] = tmp22[l] + tmp29[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp31[l] = tmp15[l] + tmp30[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp311[l] = tmp15[l] - tmp30[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp308[l] = tmp281[l] + tmp284[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp309[l] = tmp290[l] + tmp293[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp310[l] = tmp308[l] + tmp309[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp312[l] = tmp309[l] - tmp308[l];
+	  }
+	  {
+	       fftw_real tmp46[FFTW_BATCH_LANES];
+	       fftw_real tmp61[FFTW_BATCH_LANES];
+	       fftw_real tmp78[FFTW_BATCH_LANES];
+	       fftw_real tmp93[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp46[l] = tmp38[l] + tmp45[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp61[l] = tmp53[l] + tmp60[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp62[l] = tmp46[l] + tmp61[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp63[l] = tmp46[l] - tmp61[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp78[l] = tmp70[l] + tmp77[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp93[l] = tmp85[l] + tmp92[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp94[l] = tmp78[l] - tmp93[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp307[l] = tmp78[l] + tmp93[l];
+	  }
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[16 * ostride + l * odist]) = tmp31[l] - tmp62[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[l * odist]) = tmp31[l] + tmp62[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[8 * ostride + l * odist]) = tmp63[l] + tmp94[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[24 * ostride + l * odist]) = tmp94[l] - tmp63[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[16 * ostride + l * odist]) = tmp307[l] - tmp310[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[l * odist]) = tmp307[l] + tmp310[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[24 * ostride + l * odist]) = tmp311[l] - tmp312[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[8 * ostride + l * odist]) = tmp311[l] + tmp312[l];
+     }
+     {
+	  fftw_real tmp121[FFTW_BATCH_LANES];
+	  fftw_real tmp189[FFTW_BATCH_LANES];
+	  fftw_real tmp187[FFTW_BATCH_LANES];
+	  fftw_real tmp193[FFTW_BATCH_LANES];
+	  fftw_real tmp148[FFTW_BATCH_LANES];
+	  fftw_real tmp190[FFTW_BATCH_LANES];
+	  fftw_real tmp175[FFTW_BATCH_LANES];
+	  fftw_real tmp191[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp105[FFTW_BATCH_LANES];
+	       fftw_real tmp120[FFTW_BATCH_LANES];
+	       fftw_real tmp183[FFTW_BATCH_LANES];
+	       fftw_real tmp186[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp105[l] = tmp97[l] - tmp104[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp120[l] = tmp112[l] - tmp119[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp121[l] = tmp105[l] - tmp120[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp189[l] = tmp105[l] + tmp120[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp183[l] = tmp179[l] - tmp182[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp186[l] = tmp184[l] - tmp185[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp187[l] = tmp183[l] + tmp186[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp193[l] = tmp183[l] - tmp186[l];
+	  }
+	  {
+	       fftw_real tmp138[FFTW_BATCH_LANES];
+	       fftw_real tmp147[FFTW_BATCH_LANES];
+	       fftw_real tmp165[FFTW_BATCH_LANES];
+	       fftw_real tmp174[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp138[l] = tmp126[l] - tmp137[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp147[l] = tmp143[l] - tmp146[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp148[l] = (K555570233 * tmp138[l]) - (K831469612 * tmp147[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp190[l] = (K831469612 * tmp138[l]) + (K555570233 * tmp147[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp165[l] = tmp153[l] - tmp164[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp174[l] = tmp170[l] - tmp173[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp175[l] = (K555570233 * tmp165[l]) + (K831469612 * tmp174[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp191[l] = (K555570233 * tmp174[l]) - (K831469612 * tmp165[l]);
+	  }
+	  {
+	       fftw_real tmp176[FFTW_BATCH_LANES];
+	       fftw_real tmp188[FFTW_BATCH_LANES];
+	       fftw_real tmp192[FFTW_BATCH_LANES];
+	       fftw_real tmp194[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp176[l] = tmp148[l] - tmp175[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[29 * ostride + l * odist]) = tmp121[l] - tmp176[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[13 * ostride + l * odist]) = tmp121[l] + tmp176[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp188[l] = tmp148[l] + tmp175[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[21 * ostride + l * odist]) = tmp187[l] - tmp188[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[5 * ostride + l * odist]) = tmp187[l] + tmp188[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp192[l] = tmp190[l] + tmp191[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[21 * ostride + l * odist]) = tmp189[l] - tmp192[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[5 * ostride + l * odist]) = tmp189[l] + tmp192[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp194[l] = tmp191[l] - tmp190[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[29 * ostride + l * odist]) = tmp193[l] - tmp194[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[13 * ostride + l * odist]) = tmp193[l] + tmp194[l];
+	  }
+     }
+     {
+	  fftw_real tmp197[FFTW_BATCH_LANES];
+	  fftw_real tmp209[FFTW_BATCH_LANES];
+	  fftw_real tmp207[FFTW_BATCH_LANES];
+	  fftw_real tmp213[FFTW_BATCH_LANES];
+	  fftw_real tmp200[FFTW_BATCH_LANES];
+	  fftw_real tmp210[FFTW_BATCH_LANES];
+	  fftw_real tmp203[FFTW_BATCH_LANES];
+	  fftw_real tmp211[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp195[FFTW_BATCH_LANES];
+	       fftw_real tmp196[FFTW_BATCH_LANES];
+	       fftw_real tmp205[FFTW_BATCH_LANES];
+	       fftw_real tmp206[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp195[l] = tmp97[l] + tmp104[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp196[l] = tmp185[l] + tmp184[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp197[l] = tmp195[l] - tmp196[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp209[l] = tmp195[l] + tmp196[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp205[l] = tmp179[l] + tmp182[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp206[l] = tmp112[l] + tmp119[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp207[l] = tmp205[l] + tmp206[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp213[l] = tmp205[l] - tmp206[l];
+	  }
+	  {
+	       fftw_real tmp198[FFTW_BATCH_LANES];
+	       fftw_real tmp199[FFTW_BATCH_LANES];
+	       fftw_real tmp201[FFTW_BATCH_LANES];
+	       fftw_real tmp202[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp198[l] = tmp126[l] + tmp137[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp199[l] = tmp143[l] + tmp146[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp200[l] = (K980785280 * tmp198[l]) - (K195090322 * tmp199[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp210[l] = (K195090322 * tmp198[l]) + (K980785280 * tmp199[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp201[l] = tmp153[l] + tmp164[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp202[l] = tmp170[l] + tmp173[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp203[l] = (K980785280 * tmp201[l]) + (K195090322 * tmp202[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp211[l] = (K980785280 * tmp202[l]) - (K195090322 * tmp201[l]);
+	  }
+	  {
+	       fftw_real tmp204[FFTW_BATCH_LANES];
+	       fftw_real tmp208[FFTW_BATCH_LANES];
+	       fftw_real tmp212[FFTW_BATCH_LANES];
+	       fftw_real tmp214[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp204[l] = tmp200[l] - tmp203[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[25 * ostride + l * odist]) = tmp197[l] - tmp204[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[9 * ostride + l * odist]) = tmp197[l] + tmp204[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp208[l] = tmp200[l] + tmp203[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[17 * ostride + l * odist]) = tmp207[l] - tmp208[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[ostride + l * odist]) = tmp207[l] + tmp208[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp212[l] = tmp210[l] + tmp211[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[17 * ostride + l * odist]) = tmp209[l] - tmp212[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[ostride + l * odist]) = tmp209[l] + tmp212[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp214[l] = tmp211[l] - tmp210[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[25 * ostride + l * odist]) = tmp213[l] - tmp214[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[9 * ostride + l * odist]) = tmp213[l] + tmp214[l];
+	  }
+     }
+     {
+	  fftw_real tmp323[FFTW_BATCH_LANES];
+	  fftw_real tmp347[FFTW_BATCH_LANES];
+	  fftw_real tmp350[FFTW_BATCH_LANES];
+	  fftw_real tmp352[FFTW_BATCH_LANES];
+	  fftw_real tmp338[FFTW_BATCH_LANES];
+	  fftw_real tmp346[FFTW_BATCH_LANES];
+	  fftw_real tmp345[FFTW_BATCH_LANES];
+	  fftw_real tmp351[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp315[FFTW_BATCH_LANES];
+	       fftw_real tmp322[FFTW_BATCH_LANES];
+	       fftw_real tmp348[FFTW_BATCH_LANES];
+	       fftw_real tmp349[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp315[l] = tmp313[l] - tmp314[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp322[l] = K707106781 * (tmp318[l] - tmp321[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp323[l] = tmp315[l] + tmp322[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp347[l] = tmp315[l] - tmp322[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp348[l] = (K382683432 * tmp329[l]) - (K923879532 * tmp326[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp349[l] = (K923879532 * tmp333[l]) + (K382683432 * tmp336[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp350[l] = tmp348[l] - tmp349[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp352[l] = tmp348[l] + tmp349[l];
+	  }
+	  {
+	       fftw_real tmp330[FFTW_BATCH_LANES];
+	       fftw_real tmp337[FFTW_BATCH_LANES];
+	       fftw_real tmp341[FFTW_BATCH_LANES];
+	       fftw_real tmp344[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp330[l] = (K382683432 * tmp326[l]) + (K923879532 * tmp329[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp337[l] = (K382683432 * tmp333[l]) - (K923879532 * tmp336[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp338[l] = tmp330[l] + tmp337[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp346[l] = tmp337[l] - tmp330[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp341[l] = tmp339[l] - tmp340[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp344[l] = K707106781 * (tmp342[l] - tmp343[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp345[l] = tmp341[l] - tmp344[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp351[l] = tmp341[l] + tmp344[l];
+	  }
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[22 * ostride + l * odist]) = tmp323[l] - tmp338[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[6 * ostride + l * odist]) = tmp323[l] + tmp338[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[30 * ostride + l * odist]) = tmp345[l] - tmp346[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[14 * ostride + l * odist]) = tmp345[l] + tmp346[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[30 * ostride + l * odist]) = tmp347[l] - tmp350[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[14 * ostride + l * odist]) = tmp347[l] + tmp350[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[22 * ostride + l * odist]) = tmp351[l] - tmp352[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[6 * ostride + l * odist]) = tmp351[l] + tmp352[l];
+     }
+     {
+	  fftw_real tmp355[FFTW_BATCH_LANES];
+	  fftw_real tmp367[FFTW_BATCH_LANES];
+	  fftw_real tmp370[FFTW_BATCH_LANES];
+	  fftw_real tmp372[FFTW_BATCH_LANES];
+	  fftw_real tmp362[FFTW_BATCH_LANES];
+	  fftw_real tmp366[FFTW_BATCH_LANES];
+	  fftw_real tmp365[FFTW_BATCH_LANES];
+	  fftw_real tmp371[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp353[FFTW_BATCH_LANES];
+	       fftw_real tmp354[FFTW_BATCH_LANES];
+	       fftw_real tmp368[FFTW_BATCH_LANES];
+	       fftw_real tmp369[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp353[l] = tmp314[l] + tmp313[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp354[l] = K707106781 * (tmp343[l] + tmp342[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp355[l] = tmp353[l] + tmp354[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp367[l] = tmp353[l] - tmp354[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp368[l] = (K923879532 * tmp357[l]) - (K382683432 * tmp356[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp369[l] = (K382683432 * tmp359[l]) + (K923879532 * tmp360[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp370[l] = tmp368[l] - tmp369[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp372[l] = tmp368[l] + tmp369[l];
+	  }
+	  {
+	       fftw_real tmp358[FFTW_BATCH_LANES];
+	       fftw_real tmp361[FFTW_BATCH_LANES];
+	       fftw_real tmp363[FFTW_BATCH_LANES];
+	       fftw_real tmp364[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp358[l] = (K923879532 * tmp356[l]) + (K382683432 * tmp357[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp361[l] = (K923879532 * tmp359[l]) - (K382683432 * tmp360[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp362[l] = tmp358[l] + tmp361[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp366[l] = tmp361[l] - tmp358[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp363[l] = tmp339[l] + tmp340[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp364[l] = K707106781 * (tmp318[l] + tmp321[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp365[l] = tmp363[l] - tmp364[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp371[l] = tmp363[l] + tmp364[l];
+	  }
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[18 * ostride + l * odist]) = tmp355[l] - tmp362[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[2 * ostride + l * odist]) = tmp355[l] + tmp362[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[26 * ostride + l * odist]) = tmp365[l] - tmp366[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[10 * ostride + l * odist]) = tmp365[l] + tmp366[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[26 * ostride + l * odist]) = tmp367[l] - tmp370[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_im(output[10 * ostride + l * odist]) = tmp367[l] + tmp370[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[18 * ostride + l * odist]) = tmp371[l] - tmp372[l];
+	  for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	       c_re(output[2 * ostride + l * odist]) = tmp371[l] + tmp372[l];
+     }
+     {
+	  fftw_real tmp225[FFTW_BATCH_LANES];
+	  fftw_real tmp249[FFTW_BATCH_LANES];
+	  fftw_real tmp247[FFTW_BATCH_LANES];
+	  fftw_real tmp253[FFTW_BATCH_LANES];
+	  fftw_real tmp232[FFTW_BATCH_LANES];
+	  fftw_real tmp250[FFTW_BATCH_LANES];
+	  fftw_real tmp239[FFTW_BATCH_LANES];
+	  fftw_real tmp251[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp217[FFTW_BATCH_LANES];
+	       fftw_real tmp224[FFTW_BATCH_LANES];
+	       fftw_real tmp243[FFTW_BATCH_LANES];
+	       fftw_real tmp246[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp217[l] = tmp215[l] - tmp216[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp224[l] = tmp220[l] - tmp223[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp225[l] = tmp217[l] + tmp224[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp249[l] = tmp217[l] - tmp224[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp243[l] = tmp241[l] - tmp242[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp246[l] = tmp244[l] - tmp245[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp247[l] = tmp243[l] - tmp246[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp253[l] = tmp243[l] + tmp246[l];
+	  }
+	  {
+	       fftw_real tmp228[FFTW_BATCH_LANES];
+	       fftw_real tmp231[FFTW_BATCH_LANES];
+	       fftw_real tmp235[FFTW_BATCH_LANES];
+	       fftw_real tmp238[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp228[l] = tmp226[l] - tmp227[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp231[l] = tmp229[l] - tmp230[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp232[l] = (K195090322 * tmp228[l]) + (K980785280 * tmp231[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp250[l] = (K195090322 * tmp231[l]) - (K980785280 * tmp228[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp235[l] = tmp233[l] - tmp234[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp238[l] = tmp236[l] - tmp237[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp239[l] = (K195090322 * tmp235[l]) - (K980785280 * tmp238[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp251[l] = (K980785280 * tmp235[l]) + (K195090322 * tmp238[l]);
+	  }
+	  {
+	       fftw_real tmp240[FFTW_BATCH_LANES];
+	       fftw_real tmp248[FFTW_BATCH_LANES];
+	       fftw_real tmp252[FFTW_BATCH_LANES];
+	       fftw_real tmp254[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp240[l] = tmp232[l] + tmp239[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[23 * ostride + l * odist]) = tmp225[l] - tmp240[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[7 * ostride + l * odist]) = tmp225[l] + tmp240[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp248[l] = tmp239[l] - tmp232[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[31 * ostride + l * odist]) = tmp247[l] - tmp248[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[15 * ostride + l * odist]) = tmp247[l] + tmp248[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp252[l] = tmp250[l] - tmp251[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[31 * ostride + l * odist]) = tmp249[l] - tmp252[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[15 * ostride + l * odist]) = tmp249[l] + tmp252[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp254[l] = tmp250[l] + tmp251[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[23 * ostride + l * odist]) = tmp253[l] - tmp254[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[7 * ostride + l * odist]) = tmp253[l] + tmp254[l];
+	  }
+     }
+     {
+	  fftw_real tmp257[FFTW_BATCH_LANES];
+	  fftw_real tmp269[FFTW_BATCH_LANES];
+	  fftw_real tmp267[FFTW_BATCH_LANES];
+	  fftw_real tmp273[FFTW_BATCH_LANES];
+	  fftw_real tmp260[FFTW_BATCH_LANES];
+	  fftw_real tmp270[FFTW_BATCH_LANES];
+	  fftw_real tmp263[FFTW_BATCH_LANES];
+	  fftw_real tmp271[FFTW_BATCH_LANES];
+	  ASSERT_ALIGNED_DOUBLE;
+	  {
+	       fftw_real tmp255[FFTW_BATCH_LANES];
+	       fftw_real tmp256[FFTW_BATCH_LANES];
+	       fftw_real tmp265[FFTW_BATCH_LANES];
+	       fftw_real tmp266[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp255[l] = tmp215[l] + tmp216[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp256[l] = tmp245[l] + tmp244[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp257[l] = tmp255[l] + tmp256[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp269[l] = tmp255[l] - tmp256[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp265[l] = tmp241[l] + tmp242[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp266[l] = tmp220[l] + tmp223[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp267[l] = tmp265[l] - tmp266[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp273[l] = tmp265[l] + tmp266[l];
+	  }
+	  {
+	       fftw_real tmp258[FFTW_BATCH_LANES];
+	       fftw_real tmp259[FFTW_BATCH_LANES];
+	       fftw_real tmp261[FFTW_BATCH_LANES];
+	       fftw_real tmp262[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp258[l] = tmp226[l] + tmp227[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp259[l] = tmp229[l] + tmp230[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp260[l] = (K831469612 * tmp258[l]) + (K555570233 * tmp259[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp270[l] = (K831469612 * tmp259[l]) - (K555570233 * tmp258[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp261[l] = tmp233[l] + tmp234[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp262[l] = tmp236[l] + tmp237[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp263[l] = (K831469612 * tmp261[l]) - (K555570233 * tmp262[l]);
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp271[l] = (K555570233 * tmp261[l]) + (K831469612 * tmp262[l]);
+	  }
+	  {
+	       fftw_real tmp264[FFTW_BATCH_LANES];
+	       fftw_real tmp268[FFTW_BATCH_LANES];
+	       fftw_real tmp272[FFTW_BATCH_LANES];
+	       fftw_real tmp274[FFTW_BATCH_LANES];
+	       ASSERT_ALIGNED_DOUBLE;
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp264[l] = tmp260[l] + tmp263[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[19 * ostride + l * odist]) = tmp257[l] - tmp264[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[3 * ostride + l * odist]) = tmp257[l] + tmp264[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp268[l] = tmp263[l] - tmp260[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[27 * ostride + l * odist]) = tmp267[l] - tmp268[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[11 * ostride + l * odist]) = tmp267[l] + tmp268[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp272[l] = tmp270[l] - tmp271[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[27 * ostride + l * odist]) = tmp269[l] - tmp272[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_im(output[11 * ostride + l * odist]) = tmp269[l] + tmp272[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            tmp274[l] = tmp270[l] + tmp271[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[19 * ostride + l * odist]) = tmp273[l] - tmp274[l];
+	       for (l = 0; l < FFTW_BATCH_LANES; ++l)
+	            c_re(output[3 * ostride + l * odist]) = tmp273[l] + tmp274[l];
+	  }
+     }
+}
+
+fftw_codelet_desc fftwi_no_twiddle_batch_32_desc =
+{
+     "fftwi_no_twiddle_batch_32",
+     (void (*)()) fftwi_no_twiddle_batch_32,
+     32,
+     FFTW_BACKWARD,
+     FFTW_NOTW,
+     716,
+     0,
+     (const int *) 0,
+};
@@ -32,6 +32,8 @@
 #include <stdlib.h>
 #include <stdio.h>
 
+extern fftw_codelet_desc *fftw_batch_config[];	/* global from config.c */
+
 int fftw_node_cnt = 0;
 int fftw_plan_cnt = 0;
 
@@ -59,6 +61,17 @@ void fftw_use_node(fftw_plan_node *p)
      ++p->refcnt;
 }
 
+/* find the batch version of a no-twiddle codelet, if there is one */
+static fftw_notw_batch_codelet *lookup_batch(const fftw_codelet_desc *config)
+{
+     fftw_codelet_desc **q;
+
+     for (q = &fftw_batch_config[0]; *q; ++q)
+	  if ((*q)->size == config->size && (*q)->dir == config->dir)
+	       return (fftw_notw_batch_codelet *) (*q)->codelet;
+     return (fftw_notw_batch_codelet *) 0;
+}
+
 fftw_plan_node *fftw_make_node_notw(int size, const fftw_codelet_desc *config)
 {
      fftw_plan_node *p = fftw_make_node();
@@ -67,6 +80,7 @@ fftw_plan_node *fftw_make_node_notw(int size, const fftw_codelet_desc *config)
      p->nodeu.notw.size = size;
      p->nodeu.notw.codelet = (fftw_notw_codelet *) config->codelet;
      p->nodeu.notw.codelet_desc = config;
+     p->nodeu.notw.batch = lookup_batch(config);
      return p;
 }
 
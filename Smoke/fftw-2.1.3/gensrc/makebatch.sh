@@ -0,0 +1,38 @@
+#! /bin/sh
+
+# This shell script turns a no-twiddle codelet, as generated by genfft,
+# into a batch codelet that computes FFTW_BATCH_LANES independent
+# transforms at once (the transforms being idist/odist apart).
+#
+# Every temporary becomes an array with one element per lane, and every
+# statement becomes a loop over the lanes.  The lane loops have a
+# constant trip count and touch only local arrays (or exactly one
+# input/output element per lane), so the C compiler turns each of them
+# into a handful of SIMD instructions; the dataflow of the codelet is
+# otherwise unchanged.  In particular, all of the inputs are still read
+# before any output is written, so batch codelets work in place too.
+#
+# usage: sh makebatch.sh fn_16.c >fnb_16.c
+
+src=$1
+name=`basename $src`
+
+cat $src |
+    sed -e 's/no_twiddle_\([0-9][0-9]*\)/no_twiddle_batch_\1/g' |
+    sed -e 's/^\(void fftwi*_no_twiddle_batch_[0-9]*(.*int ostride\))$/\1, int idist, int odist)/' |
+    sed -e '/^void fftwi*_no_twiddle_batch_/{
+n
+a\
+     int l;
+}' |
+    sed -e 's/^\([ 	]*fftw_real tmp[0-9][0-9]*\);$/\1[FFTW_BATCH_LANES];/' |
+    sed -e '/^[ 	]*\(tmp[0-9]*\|c_re(output\[.*\])\|c_im(output\[.*\])\) = .*;$/{
+s/\(tmp[0-9][0-9]*\)/\1[l]/g
+s/input\[\([^]]*\)\]/input[\1 + l * idist]/g
+s/output\[\([^]]*\)\]/output[\1 + l * odist]/g
+s/\[0 + l \* \([io]dist\)\]/[l * \1]/g
+s/^\([ 	]*\)\(.*\)$/\1for (l = 0; l < FFTW_BATCH_LANES; ++l)\
+\1     \2/
+}' |
+    sed -e "s|^/\* Generated by: \(.*\) \*/$|/* Generated by: \1 */\\
+/* Batch version generated by: sh makebatch.sh $name */|"
@@ -21,6 +21,11 @@ do
     echo "extern fftw_codelet_desc fftw_twiddle_${i}_desc;"
     echo "extern fftw_codelet_desc fftwi_twiddle_${i}_desc;"
 done
+for i in $NOTW_BATCH
+do
+    echo "extern fftw_codelet_desc fftw_no_twiddle_batch_${i}_desc;"
+    echo "extern fftw_codelet_desc fftwi_no_twiddle_batch_${i}_desc;"
+done
 
 echo
 echo
@@ -41,3 +46,17 @@ done
 
 echo "(fftw_codelet_desc *) 0 "
 echo "};"
+
+# batch codelets are not planned for; they stand in for the no-twiddle
+# codelet of the same size when the executor gets interleaved transforms
+echo
+echo "fftw_codelet_desc *fftw_batch_config[] = {"
+
+for i in $NOTW_BATCH
+do
+    echo "NOTW_BATCH_CODELET(${i}),"
+    echo "NOTWI_BATCH_CODELET(${i}),"
+done
+
+echo "(fftw_codelet_desc *) 0 "
+echo "};"
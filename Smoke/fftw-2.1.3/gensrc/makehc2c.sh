@@ -0,0 +1,142 @@
+#! /bin/sh
+
+# This shell script turns an hc2hc codelet, as generated by genfft, into
+# an out-of-place version that exchanges its halfcomplex data with an
+# array of n/2 + 1 fftw_complex numbers (the FFTW_COMPLEX layout of
+# rfftwnd), so that the last twiddle pass of a real->complex transform
+# can store the complex output directly, and the first twiddle pass of
+# a complex->real transform can load it directly.
+#
+# The forward version reads the halfcomplex array A and writes C; the
+# backward version reads C and writes A.  Each halfcomplex element
+# X[k * iostride] or Y[-k * iostride] is the real or the imaginary part
+# of exactly one complex element.  Which one depends only on k, the
+# radix r and the block of the codelet (the first block, the loop, or
+# the block for i == m), so the mapping is resolved here, statically.
+# The codelet still assumes that its blocks are the ones of an n-point
+# halfcomplex array with n = r * m; the imaginary parts of the DC and
+# (for even n) Nyquist elements are not stored.
+#
+# An in-place codelet reads every element of a block before writing
+# it, and distinct blocks touch distinct elements, so redirecting
+# either the loads or the stores to another array does not change the
+# result.
+#
+# usage: sh makehc2c.sh fhf_16.c >fhfc_16.c
+#        sh makehc2c.sh fhb_16.c >fhbc_16.c
+
+src=$1
+name=`basename $src`
+
+awk -v name="$name" '
+function kof(s) {
+     if (s == "0") return 0
+     if (s == "iostride" || s == "-iostride") return 1
+     sub(/^-/, "", s)
+     sub(/ \* iostride$/, "", s)
+     return s + 0
+}
+
+function cindex(k, neg) {
+     if (k == 0) return "0"
+     if (k == 1) return neg "cm"
+     return neg k " * cm"
+}
+
+# the complex element holding X[...] or Y[...], in block "region"
+function cref(v, idx,    k, isreal) {
+     k = kof(idx)
+     if (v == "X") {
+	  if (region == "first")
+	       isreal = (2 * k <= r)
+	  else
+	       isreal = (2 * k < r)
+	  if (isreal)
+	       return "c_re(CX[" cindex(k, "") "])"
+	  return "c_im(CY[" cindex(k, "-") "])"
+     }
+     if (region == "last")
+	  isreal = (2 * k >= r - 1)
+     else
+	  isreal = (2 * k >= r)
+     if (isreal)
+	  return "c_re(CY[" cindex(k, "-") "])"
+     return "c_im(CX[" cindex(k, "") "])"
+}
+
+BEGIN {
+     region = "first"
+     forward = (name ~ /^fhf_/)
+     cconst = forward ? "" : "const "
+}
+
+/^void fftw_hc2hc_(forward|backward)_[0-9]+\(/ {
+     sub(/\)$/, ", " cconst "fftw_complex *C, int cstride)")
+     if (forward)
+	  sub(/\(fftw_real \*A/, "(const fftw_real *A")
+}
+
+{
+     gsub(/hc2hc_forward_/, "hc2hc_forward_to_c_")
+     gsub(/hc2hc_backward_/, "hc2hc_backward_from_c_")
+}
+
+/^     fftw_real \*[XY];$/ && forward {
+     sub(/fftw_real/, "const fftw_real")
+}
+
+/^     Y = A \+ \([0-9]+ \* iostride\);$/ {
+     r = $0
+     sub(/^.*\(/, "", r)
+     sub(/ .*$/, "", r)
+     r = r + 0
+     print
+     print "     cm = m * cstride;"
+     print "     CX = C;"
+     print "     CY = C + (" r " * cm);"
+     next
+}
+
+/^     X = X \+ dist;$/ {
+     print
+     print "     CX = CX + cstride;"
+     next
+}
+
+/^     Y = Y - dist;$/ {
+     print
+     print "     CY = CY - cstride;"
+     next
+}
+
+/^     for \(i = 2; i < m;/ {
+     region = "loop"
+     sub(/Y = Y - dist, /, "Y = Y - dist, CX = CX + cstride, CY = CY - cstride, ")
+}
+
+/^     if \(i == m\) \{$/ {
+     region = "last"
+}
+
+# stores, in the forward version; loads, in the backward one
+(forward && /^[ 	]*[XY]\[[^]]*\] = .*;$/) || (!forward && /^[ 	]*tmp[0-9]+ = [XY]\[[^]]*\];$/) {
+     match($0, /[XY]\[[^]]*\]/)
+     v = substr($0, RSTART, 1)
+     idx = substr($0, RSTART + 2, RLENGTH - 3)
+     $0 = substr($0, 1, RSTART - 1) cref(v, idx) substr($0, RSTART + RLENGTH)
+}
+
+{
+     print
+}
+
+/^     (const )?fftw_real \*Y;$/ {
+     print "     " cconst "fftw_complex *CX;"
+     print "     " cconst "fftw_complex *CY;"
+     print "     int cm;"
+}
+
+/^\/\* Generated by: .* \*\/$/ {
+     print "/* Complex-layout version generated by: sh makehc2c.sh " name " */"
+}
+' $src
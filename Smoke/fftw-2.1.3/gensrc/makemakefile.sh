@@ -17,6 +17,13 @@ do
     notwi_codelets="$notwi_codelets ${NOTWI_PREFIX}${i}.c"
 done
 
+notw_batch_codelets=""
+
+for i in $NOTW_BATCH
+do
+    notw_batch_codelets="$notw_batch_codelets ${NOTW_BATCH_PREFIX}${i}.c ${NOTWI_BATCH_PREFIX}${i}.c"
+done
+
 twiddle_codelets=""
 twiddlei_codelets=""
 
@@ -33,6 +40,7 @@ cat Makefile.fftw.am |
     sed -e "s/@NOTWI_CODELETS@/$notwi_codelets/g" |
     sed -e "s/@TWID_CODELETS@/$twiddle_codelets/g" |
     sed -e "s/@TWIDI_CODELETS@/$twiddlei_codelets/g" |
+    sed -e "s/@NOTW_BATCH_CODELETS@/$notw_batch_codelets/g" |
 cat >Makefile.fftw
 
 ###########################################################################
@@ -56,6 +64,13 @@ do
     twiddlei_codelets="$twiddlei_codelets ${HC2HC_BACKWARD_PREFIX}${i}.c"
 done
 
+twiddle_c_codelets=""
+
+for i in $TWIDDLE_REAL
+do
+    twiddle_c_codelets="$twiddle_c_codelets ${HC2HC_FORWARD_C_PREFIX}${i}.c ${HC2HC_BACKWARD_C_PREFIX}${i}.c"
+done
+
 # now substitute list in Makefile.rfftw.am, to get Makefile.rfftw
 # (the two cats are redundant, but the script is clearer this way)
 cat Makefile.rfftw.am |
@@ -63,4 +78,5 @@ cat Makefile.rfftw.am |
     sed -e "s/@NOTWI_CODELETS@/$notwi_codelets/g" |
     sed -e "s/@TWID_CODELETS@/$twiddle_codelets/g" |
     sed -e "s/@TWIDI_CODELETS@/$twiddlei_codelets/g" |
+    sed -e "s/@TWID_C_CODELETS@/$twiddle_c_codelets/g" |
 cat >Makefile.rfftw
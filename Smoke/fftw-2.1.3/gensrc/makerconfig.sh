@@ -21,6 +21,11 @@ do
     echo "extern fftw_codelet_desc fftw_hc2hc_forward_${i}_desc;"
     echo "extern fftw_codelet_desc fftw_hc2hc_backward_${i}_desc;"
 done
+for i in $TWIDDLE_REAL
+do
+    echo "extern fftw_codelet_desc fftw_hc2hc_forward_to_c_${i}_desc;"
+    echo "extern fftw_codelet_desc fftw_hc2hc_backward_from_c_${i}_desc;"
+done
 
 echo
 echo
@@ -41,3 +46,17 @@ done
 
 echo "(fftw_codelet_desc *) 0 "
 echo "};"
+
+# the complex-layout versions of the hc2hc codelets are not planned
+# for; rexec2.c uses them for the root of an rfftwnd row transform
+echo
+echo "fftw_codelet_desc *rfftw_c_config[] = {"
+
+for i in $TWIDDLE_REAL
+do
+    echo "TWIDDLE_C_CODELET(${i}),"
+    echo "TWIDDLEI_C_CODELET(${i}),"
+done
+
+echo "(fftw_codelet_desc *) 0 "
+echo "};"
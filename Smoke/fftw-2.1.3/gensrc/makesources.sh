@@ -36,3 +36,17 @@ do
 done
 
 make $PARALLEL -f Makefile.sources $notw_codelets $notwi_codelets $twiddle_codelets $twiddlei_codelets
+
+# the batch codelets are derived from the no-twiddle codelets
+for i in $NOTW_BATCH
+do
+    sh makebatch.sh ${NOTW_PREFIX}${i}.c >${NOTW_BATCH_PREFIX}${i}.c
+    sh makebatch.sh ${NOTWI_PREFIX}${i}.c >${NOTWI_BATCH_PREFIX}${i}.c
+done
+
+# the complex-layout hc2hc codelets are derived from the hc2hc codelets
+for i in $TWIDDLE_REAL
+do
+    sh makehc2c.sh ${HC2HC_FORWARD_PREFIX}${i}.c >${HC2HC_FORWARD_C_PREFIX}${i}.c
+    sh makehc2c.sh ${HC2HC_BACKWARD_PREFIX}${i}.c >${HC2HC_BACKWARD_C_PREFIX}${i}.c
+done
@@ -52,6 +52,11 @@
 #define TWIDDLEI_CODELET(x) \
 	 &fftw_hc2hc_backward_##x##_desc
 
+#define TWIDDLE_C_CODELET(x) \
+	 &fftw_hc2hc_forward_to_c_##x##_desc
+#define TWIDDLEI_C_CODELET(x) \
+	 &fftw_hc2hc_backward_from_c_##x##_desc
+
 /* automatically-generated list of codelets */
 
 extern fftw_codelet_desc fftw_real2hc_1_desc;
@@ -114,6 +119,28 @@ extern fftw_codelet_desc fftw_hc2hc_forward_16_desc;
 extern fftw_codelet_desc fftw_hc2hc_backward_16_desc;
 extern fftw_codelet_desc fftw_hc2hc_forward_32_desc;
 extern fftw_codelet_desc fftw_hc2hc_backward_32_desc;
+extern fftw_codelet_desc fftw_hc2hc_forward_to_c_2_desc;
+extern fftw_codelet_desc fftw_hc2hc_backward_from_c_2_desc;
+extern fftw_codelet_desc fftw_hc2hc_forward_to_c_3_desc;
+extern fftw_codelet_desc fftw_hc2hc_backward_from_c_3_desc;
+extern fftw_codelet_desc fftw_hc2hc_forward_to_c_4_desc;
+extern fftw_codelet_desc fftw_hc2hc_backward_from_c_4_desc;
+extern fftw_codelet_desc fftw_hc2hc_forward_to_c_5_desc;
+extern fftw_codelet_desc fftw_hc2hc_backward_from_c_5_desc;
+extern fftw_codelet_desc fftw_hc2hc_forward_to_c_6_desc;
+extern fftw_codelet_desc fftw_hc2hc_backward_from_c_6_desc;
+extern fftw_codelet_desc fftw_hc2hc_forward_to_c_7_desc;
+extern fftw_codelet_desc fftw_hc2hc_backward_from_c_7_desc;
+extern fftw_codelet_desc fftw_hc2hc_forward_to_c_8_desc;
+extern fftw_codelet_desc fftw_hc2hc_backward_from_c_8_desc;
+extern fftw_codelet_desc fftw_hc2hc_forward_to_c_9_desc;
+extern fftw_codelet_desc fftw_hc2hc_backward_from_c_9_desc;
+extern fftw_codelet_desc fftw_hc2hc_forward_to_c_10_desc;
+extern fftw_codelet_desc fftw_hc2hc_backward_from_c_10_desc;
+extern fftw_codelet_desc fftw_hc2hc_forward_to_c_16_desc;
+extern fftw_codelet_desc fftw_hc2hc_backward_from_c_16_desc;
+extern fftw_codelet_desc fftw_hc2hc_forward_to_c_32_desc;
+extern fftw_codelet_desc fftw_hc2hc_backward_from_c_32_desc;
 
 fftw_codelet_desc *rfftw_config[] =
 {
@@ -179,3 +206,30 @@ fftw_codelet_desc *rfftw_config[] =
      TWIDDLEI_CODELET(32),
      (fftw_codelet_desc *) 0
 };
+
+fftw_codelet_desc *rfftw_c_config[] =
+{
+     TWIDDLE_C_CODELET(2),
+     TWIDDLEI_C_CODELET(2),
+     TWIDDLE_C_CODELET(3),
+     TWIDDLEI_C_CODELET(3),
+     TWIDDLE_C_CODELET(4),
+     TWIDDLEI_C_CODELET(4),
+     TWIDDLE_C_CODELET(5),
+     TWIDDLEI_C_CODELET(5),
+     TWIDDLE_C_CODELET(6),
+     TWIDDLEI_C_CODELET(6),
+     TWIDDLE_C_CODELET(7),
+     TWIDDLEI_C_CODELET(7),
+     TWIDDLE_C_CODELET(8),
+     TWIDDLEI_C_CODELET(8),
+     TWIDDLE_C_CODELET(9),
+     TWIDDLEI_C_CODELET(9),
+     TWIDDLE_C_CODELET(10),
+     TWIDDLEI_C_CODELET(10),
+     TWIDDLE_C_CODELET(16),
+     TWIDDLEI_C_CODELET(16),
+     TWIDDLE_C_CODELET(32),
+     TWIDDLEI_C_CODELET(32),
+     (fftw_codelet_desc *) 0
+};
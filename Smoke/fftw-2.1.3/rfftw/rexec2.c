@@ -28,6 +28,66 @@
 #include <fftw-int.h>
 #include <rfftw.h>
 
+/*
+ * The loops of rfftw_hc2c and rfftw_c2hc, for a stride s.  They are
+ * macros so that the common unit-stride case (the last dimension of an
+ * rfftwnd array) can be expanded with a literal 1: with a constant
+ * stride, each unrolled block is a contiguous load, a reversed
+ * contiguous load and one interleaved store, which the compiler turns
+ * into SIMD shuffles.
+ */
+#define HC2C_LOOP(s)						\
+     for (; i < ((n2 - 1) & 3) + 1; ++i) {			\
+	  c_re(out[i * (s)]) = in[i];				\
+	  c_im(out[i * (s)]) = in[n - i];			\
+     }								\
+     for (; i < n2; i += 4) {					\
+	  fftw_real r0, r1, r2, r3;				\
+	  fftw_real i0, i1, i2, i3;				\
+	  r0 = in[i];						\
+	  r1 = in[i + 1];					\
+	  r2 = in[i + 2];					\
+	  r3 = in[i + 3];					\
+	  i3 = in[n - (i + 3)];					\
+	  i2 = in[n - (i + 2)];					\
+	  i1 = in[n - (i + 1)];					\
+	  i0 = in[n - i];					\
+	  c_re(out[i * (s)]) = r0;				\
+	  c_im(out[i * (s)]) = i0;				\
+	  c_re(out[(i + 1) * (s)]) = r1;			\
+	  c_im(out[(i + 1) * (s)]) = i1;			\
+	  c_re(out[(i + 2) * (s)]) = r2;			\
+	  c_im(out[(i + 2) * (s)]) = i2;			\
+	  c_re(out[(i + 3) * (s)]) = r3;			\
+	  c_im(out[(i + 3) * (s)]) = i3;			\
+     }
+
+#define C2HC_LOOP(s)						\
+     for (; i < ((n2 - 1) & 3) + 1; ++i) {			\
+	  out[i] = c_re(in[i * (s)]);				\
+	  out[n - i] = c_im(in[i * (s)]);			\
+     }								\
+     for (; i < n2; i += 4) {					\
+	  fftw_real r0, r1, r2, r3;				\
+	  fftw_real i0, i1, i2, i3;				\
+	  r0 = c_re(in[i * (s)]);				\
+	  i0 = c_im(in[i * (s)]);				\
+	  r1 = c_re(in[(i + 1) * (s)]);				\
+	  i1 = c_im(in[(i + 1) * (s)]);				\
+	  r2 = c_re(in[(i + 2) * (s)]);				\
+	  i2 = c_im(in[(i + 2) * (s)]);				\
+	  r3 = c_re(in[(i + 3) * (s)]);				\
+	  i3 = c_im(in[(i + 3) * (s)]);				\
+	  out[i] = r0;						\
+	  out[i + 1] = r1;					\
+	  out[i + 2] = r2;					\
+	  out[i + 3] = r3;					\
+	  out[n - (i + 3)] = i3;				\
+	  out[n - (i + 2)] = i2;				\
+	  out[n - (i + 1)] = i1;				\
+	  out[n - i] = i0;					\
+     }
+
 /* copies halfcomplex array in (contiguous) to fftw_complex array out. */
 void rfftw_hc2c(int n, fftw_real *in, fftw_complex *out, int ostride)
 {
@@ -36,29 +96,10 @@ void rfftw_hc2c(int n, fftw_real *in, fftw_complex *out, int ostride)
 
      c_re(out[0]) = in[0];
      c_im(out[0]) = 0.0;
-     for (; i < ((n2 - 1) & 3) + 1; ++i) {
-	  c_re(out[i * ostride]) = in[i];
-	  c_im(out[i * ostride]) = in[n - i];
-     }
-     for (; i < n2; i += 4) {
-	  fftw_real r0, r1, r2, r3;
-	  fftw_real i0, i1, i2, i3;
-	  r0 = in[i];
-	  r1 = in[i + 1];
-	  r2 = in[i + 2];
-	  r3 = in[i + 3];
-	  i3 = in[n - (i + 3)];
-	  i2 = in[n - (i + 2)];
-	  i1 = in[n - (i + 1)];
-	  i0 = in[n - i];
-	  c_re(out[i * ostride]) = r0;
-	  c_im(out[i * ostride]) = i0;
-	  c_re(out[(i + 1) * ostride]) = r1;
-	  c_im(out[(i + 1) * ostride]) = i1;
-	  c_re(out[(i + 2) * ostride]) = r2;
-	  c_im(out[(i + 2) * ostride]) = i2;
-	  c_re(out[(i + 3) * ostride]) = r3;
-	  c_im(out[(i + 3) * ostride]) = i3;
+     if (ostride == 1) {
+	  HC2C_LOOP(1)
+     } else {
+	  HC2C_LOOP(ostride)
      }
      if ((n & 1) == 0) {	/* store the Nyquist frequency */
 	  c_re(out[n2 * ostride]) = in[n2];
@@ -73,34 +114,31 @@ void rfftw_c2hc(int n, fftw_complex *in, int istride, fftw_real *out)
      int i = 1;
 
      out[0] = c_re(in[0]);
-     for (; i < ((n2 - 1) & 3) + 1; ++i) {
-	  out[i] = c_re(in[i * istride]);
-	  out[n - i] = c_im(in[i * istride]);
-     }
-     for (; i < n2; i += 4) {
-	  fftw_real r0, r1, r2, r3;
-	  fftw_real i0, i1, i2, i3;
-	  r0 = c_re(in[i * istride]);
-	  i0 = c_im(in[i * istride]);
-	  r1 = c_re(in[(i + 1) * istride]);
-	  i1 = c_im(in[(i + 1) * istride]);
-	  r2 = c_re(in[(i + 2) * istride]);
-	  i2 = c_im(in[(i + 2) * istride]);
-	  r3 = c_re(in[(i + 3) * istride]);
-	  i3 = c_im(in[(i + 3) * istride]);
-	  out[i] = r0;
-	  out[i + 1] = r1;
-	  out[i + 2] = r2;
-	  out[i + 3] = r3;
-	  out[n - (i + 3)] = i3;
-	  out[n - (i + 2)] = i2;
-	  out[n - (i + 1)] = i1;
-	  out[n - i] = i0;
+     if (istride == 1) {
+	  C2HC_LOOP(1)
+     } else {
+	  C2HC_LOOP(istride)
      }
      if ((n & 1) == 0)		/* store the Nyquist frequency */
 	  out[n2] = c_re(in[n2 * istride]);
 }
 
+extern fftw_codelet_desc *rfftw_c_config[];	/* global from rconfig.c */
+
+/*
+ * find the version of an hc2hc codelet that stores (forward) or loads
+ * (backward) the FFTW_COMPLEX layout directly, if there is one
+ */
+static const fftw_codelet_desc *lookup_c(const fftw_codelet_desc *config)
+{
+     fftw_codelet_desc **q;
+
+     for (q = &rfftw_c_config[0]; *q; ++q)
+	  if ((*q)->size == config->size && (*q)->dir == config->dir)
+	       return *q;
+     return (const fftw_codelet_desc *) 0;
+}
+
 /* 
  * in: array of n real numbers (* howmany).
  * out: array of n/2 + 1 complex numbers (* howmany).
@@ -135,7 +173,44 @@ void rfftw_real2c_aux(fftw_plan plan, int howmany,
 		   break;
 	      }
 
+	 case FFTW_HC2HC:
+	      {
+		   const fftw_codelet_desc *d =
+		   lookup_c(p->nodeu.hc2hc.codelet_desc);
+		   fftw_hc2hc_to_c_codelet *codelet;
+		   int n = plan->n;
+		   int r = p->nodeu.hc2hc.size;
+		   int m = n / r;
+		   int n2 = (n & 1) ? 0 : (n + 1) / 2;
+		   fftw_recurse_kind recurse_kind = plan->recurse_kind;
+		   fftw_complex *W = p->nodeu.hc2hc.tw->twarray;
+		   int i;
+
+		   if (!d)
+			goto generic;
+		   codelet = (fftw_hc2hc_to_c_codelet *) d->codelet;
+
+		   /* 
+		    * the children as in rfftw_executor_simple, then the
+		    * last twiddle pass stores the complex output directly
+		    */
+		   for (j = 0; j < howmany; ++j, in += idist, out += odist) {
+			for (i = 0; i < r; ++i)
+			     rfftw_executor_simple(m, in + i * istride,
+						   work + i * m,
+						   p->nodeu.hc2hc.recurse,
+						   istride * r, 1,
+						   recurse_kind);
+			HACK_ALIGN_STACK_EVEN;
+			codelet(work, W, m, m, 1, out, ostride);
+			c_im(out[0]) = 0.0;
+			c_im(out[n2 * ostride]) = 0.0;
+		   }
+		   break;
+	      }
+
 	 default:
+	    generic:
 	      {
 		   int n = plan->n;
 		   fftw_recurse_kind recurse_kind = plan->recurse_kind;
@@ -179,7 +254,41 @@ void rfftw_c2real_aux(fftw_plan plan, int howmany,
 		   break;
 	      }
 
+	 case FFTW_HC2HC:
+	      {
+		   const fftw_codelet_desc *d =
+		   lookup_c(p->nodeu.hc2hc.codelet_desc);
+		   fftw_hc2hc_from_c_codelet *codelet;
+		   int j, i, n = plan->n;
+		   int r = p->nodeu.hc2hc.size;
+		   int m = n / r;
+		   fftw_recurse_kind recurse_kind = plan->recurse_kind;
+		   fftw_complex *W = p->nodeu.hc2hc.tw->twarray;
+
+		   if (!d)
+			goto generic;
+		   codelet = (fftw_hc2hc_from_c_codelet *) d->codelet;
+
+		   /* 
+		    * the first twiddle pass loads the complex input
+		    * directly (into work, so that in is not destroyed),
+		    * then the children as in rfftw_executor_simple
+		    */
+		   for (j = 0; j < howmany; ++j, in += idist, out += odist) {
+			HACK_ALIGN_STACK_EVEN;
+			codelet(work, W, m, m, 1, in, istride);
+			for (i = 0; i < r; ++i)
+			     rfftw_executor_simple(m, work + i * m,
+						   out + i * ostride,
+						   p->nodeu.hc2hc.recurse,
+						   1, ostride * r,
+						   recurse_kind);
+		   }
+		   break;
+	      }
+
 	 default:
+	    generic:
 	      {
 		   int j, n = plan->n;
 		   fftw_recurse_kind recurse_kind = plan->recurse_kind;
@@ -91,6 +91,111 @@ extern void rfftwnd_one_real_to_complex(rfftwnd_plan p,
 extern void rfftwnd_one_complex_to_real(rfftwnd_plan p,
 					fftw_complex *in, fftw_real *out);
 
+/****************************************************************************/
+/*                        Out-of-core transforms                            */
+/****************************************************************************/
+
+/*
+ * I/O abstraction for out-of-core transforms.  Offsets and counts are
+ * in units of fftw_real, relative to the start of the (in-place,
+ * padded) rfftwnd array.  read and write may return before the
+ * transfer is complete; wait(buf) must then block until every request
+ * issued on buf has finished.  wait may be NULL for synchronous I/O.
+ * The memory and stdio layers below are synchronous; the fd layer
+ * hands the transfers to an I/O thread, so that they overlap the
+ * computation.
+ */
+typedef struct {
+     void (*read) (fftw_real *buf, size_t offset, size_t count, void *data);
+     void (*write) (const fftw_real *buf, size_t offset, size_t count,
+		    void *data);
+     void (*wait) (const fftw_real *buf, void *data);
+     void *data;
+} rfftwnd_ooc_io;
+
+typedef struct {
+     int rank;
+     int *n;
+     fftw_direction dir;
+
+     rfftwnd_plan slab_plan;	/* in-place plan for dimensions 1..rank-1 */
+     fftw_plan col_plan;	/* in-place plan for dimension 0 */
+
+     size_t plane_size;		/* fftw_reals per (padded) plane */
+     int slab_planes;		/* planes per slab */
+     int col_width;		/* complex columns per column block */
+     size_t nbuf;		/* fftw_reals per buffer */
+     fftw_real *buf[2];		/* double buffers (see rfftwnd_ooc_io) */
+     fftw_complex *work;	/* n[0] elements, for col_plan */
+} rfftwnd_ooc_data;
+
+typedef rfftwnd_ooc_data *rfftwnd_ooc_plan;
+
+extern rfftwnd_ooc_plan rfftwnd_ooc_create_plan(int rank, const int *n,
+						fftw_direction dir,
+						int flags,
+						size_t max_memory);
+extern void rfftwnd_ooc_destroy_plan(rfftwnd_ooc_plan p);
+extern void rfftwnd_ooc_fprint_plan(FILE *f, rfftwnd_ooc_plan p);
+extern void rfftwnd_ooc_one(rfftwnd_ooc_plan p, rfftwnd_ooc_io *io);
+
+extern void rfftwnd_ooc_memory_io(rfftwnd_ooc_io *io, fftw_real *base);
+extern void rfftwnd_ooc_file_io(rfftwnd_ooc_io *io, FILE *f);
+extern int rfftwnd_ooc_fd_io(rfftwnd_ooc_io *io, int fd, rfftwnd_ooc_plan p);
+extern void rfftwnd_ooc_fd_io_destroy(rfftwnd_ooc_io *io);
+
+/****************************************************************************/
+/*                   Split-format complex transforms                        */
+/****************************************************************************/
+
+/*
+ * Complex transforms of data held as separate real and imaginary
+ * arrays.  These are computed with the real-to-halfcomplex codelets
+ * (whose inputs and outputs are already separate real arrays), so
+ * they live in rfftw rather than in fftw.
+ */
+typedef struct {
+     int n;
+     fftw_direction dir;
+     int flags;
+     rfftw_plan plan;		/* real-to-halfcomplex plan of size n */
+     fftw_real *work;		/* scratch for in-place transforms */
+} fftw_split_data;
+
+typedef fftw_split_data *fftw_split_plan;
+
+extern fftw_split_plan fftw_split_create_plan(int n, fftw_direction dir,
+					      int flags);
+extern void fftw_split_destroy_plan(fftw_split_plan plan);
+extern void fftw_split(fftw_split_plan plan, int howmany,
+		       fftw_real *ri, fftw_real *ii, int istride, int idist,
+		       fftw_real *ro, fftw_real *io, int ostride, int odist);
+extern void fftw_split_one(fftw_split_plan plan,
+			   fftw_real *ri, fftw_real *ii,
+			   fftw_real *ro, fftw_real *io);
+
+typedef struct {
+     int is_in_place;
+     int rank;
+     int *n;
+     int *n_before;
+     int *n_after;
+     fftw_split_plan *plans;	/* 1d split plans for each dimension */
+} fftwnd_split_data;
+
+typedef fftwnd_split_data *fftwnd_split_plan;
+
+extern fftwnd_split_plan fftwnd_split_create_plan(int rank, const int *n,
+						  fftw_direction dir,
+						  int flags);
+extern void fftwnd_split_destroy_plan(fftwnd_split_plan plan);
+extern void fftwnd_split(fftwnd_split_plan plan, int howmany,
+			 fftw_real *ri, fftw_real *ii, int istride, int idist,
+			 fftw_real *ro, fftw_real *io, int ostride, int odist);
+extern void fftwnd_split_one(fftwnd_split_plan plan,
+			     fftw_real *ri, fftw_real *ii,
+			     fftw_real *ro, fftw_real *io);
+
 /****************************************************************************/
 
 #ifdef __cplusplus
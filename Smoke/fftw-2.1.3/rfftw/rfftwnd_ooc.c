@@ -0,0 +1,610 @@
+
+/*
+ * Copyright (c) 1997-1999 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/*
+ * rfftwnd_ooc.c -- out-of-core multi-dimensional real transforms.
+ *
+ * The array lives outside of memory (in a file, or in a memory-mapped
+ * region that is larger than we want resident) and is accessed only
+ * through an rfftwnd_ooc_io.  Its layout is that of an in-place
+ * rfftwnd transform: n[0] x ... x n[rank-1] reals, with the last
+ * dimension padded to 2*(n[rank-1]/2+1).  Output is therefore
+ * bit-for-bit the layout produced by rfftwnd_one_real_to_complex
+ * with FFTW_IN_PLACE.
+ *
+ * The transform is done in two passes:
+ *
+ *   1) slabs of consecutive planes (index 0 fixed) are read, given an
+ *      in-core (rank-1)-dimensional in-place rfftwnd, and written back;
+ *
+ *   2) blocks of complex columns are gathered from every plane (a
+ *      blocked transpose through the I/O layer), transformed along
+ *      dimension 0, and scattered back.
+ *
+ * (complex-to-real transforms do the passes in the opposite order.)
+ * Each pass alternates between two buffers: the read of block k+1 is
+ * issued before block k is computed, and a buffer is only reused after
+ * io->wait has been called on it.  The memory and stdio layers
+ * provided here are synchronous, so with them nothing overlaps.  The
+ * fd layer is asynchronous: its read and write queue the transfer to
+ * an I/O thread and return, and its wait blocks only until the
+ * transfers on the given buffer have finished, so the read of block
+ * k+1 and the write of block k-1 proceed while block k is computed.
+ */
+
+#include <string.h>
+
+#include <fftw-int.h>
+#include <rfftw.h>
+
+/********************** Initializing the Plan ***********************/
+
+rfftwnd_ooc_plan rfftwnd_ooc_create_plan(int rank, const int *n,
+					 fftw_direction dir, int flags,
+					 size_t max_memory)
+{
+     rfftwnd_ooc_plan p;
+     int i, nhc;
+     size_t plane_complex, half, slab_size, col_size;
+
+     if (rank < 2)
+	  return 0;
+     for (i = 0; i < rank; ++i)
+	  if (n[i] <= 0)
+	       return 0;
+
+     flags |= FFTW_IN_PLACE;
+
+     p = (rfftwnd_ooc_plan) fftw_malloc(sizeof(rfftwnd_ooc_data));
+     p->rank = rank;
+     p->dir = dir;
+     p->n = (int *) fftw_malloc(sizeof(int) * rank);
+     for (i = 0; i < rank; ++i)
+	  p->n[i] = n[i];
+     p->slab_plan = 0;
+     p->col_plan = 0;
+     p->buf[0] = p->buf[1] = 0;
+     p->work = 0;
+
+     nhc = n[rank - 1] / 2 + 1;
+     plane_complex = nhc;
+     for (i = 1; i < rank - 1; ++i)
+	  plane_complex *= n[i];
+     p->plane_size = 2 * plane_complex;
+
+     /*
+      * max_memory covers the two buffers; each of them must hold at
+      * least one plane and one column of the complex array.
+      */
+     half = max_memory / 2;
+     p->slab_planes = (int) (half / (p->plane_size * sizeof(fftw_real)));
+     if (p->slab_planes < 1)
+	  p->slab_planes = 1;
+     if (p->slab_planes > n[0])
+	  p->slab_planes = n[0];
+     p->col_width = (int) (half / (n[0] * sizeof(fftw_complex)));
+     if (p->col_width < 1)
+	  p->col_width = 1;
+     if ((size_t) p->col_width > plane_complex)
+	  p->col_width = (int) plane_complex;
+
+     slab_size = p->slab_planes * p->plane_size;
+     col_size = 2 * (size_t) n[0] * p->col_width;
+     p->nbuf = slab_size > col_size ? slab_size : col_size;
+
+     p->slab_plan = rfftwnd_create_plan(rank - 1, n + 1, dir, flags);
+     p->col_plan = fftw_create_plan(n[0], dir, flags);
+     p->buf[0] = (fftw_real *) fftw_malloc(p->nbuf * sizeof(fftw_real));
+     p->buf[1] = (fftw_real *) fftw_malloc(p->nbuf * sizeof(fftw_real));
+     p->work = (fftw_complex *) fftw_malloc(n[0] * sizeof(fftw_complex));
+
+     if (!p->slab_plan || !p->col_plan || !p->buf[0] || !p->buf[1]
+	 || !p->work) {
+	  rfftwnd_ooc_destroy_plan(p);
+	  return 0;
+     }
+     return p;
+}
+
+/************************ Freeing the Plan ************************/
+
+void rfftwnd_ooc_destroy_plan(rfftwnd_ooc_plan p)
+{
+     if (p) {
+	  if (p->slab_plan)
+	       rfftwnd_destroy_plan(p->slab_plan);
+	  if (p->col_plan)
+	       fftw_destroy_plan(p->col_plan);
+	  if (p->buf[0])
+	       fftw_free(p->buf[0]);
+	  if (p->buf[1])
+	       fftw_free(p->buf[1]);
+	  if (p->work)
+	       fftw_free(p->work);
+	  fftw_free(p->n);
+	  fftw_free(p);
+     }
+}
+
+/************************ Printing the Plan ************************/
+
+void rfftwnd_ooc_fprint_plan(FILE *f, rfftwnd_ooc_plan p)
+{
+     if (p) {
+	  int i;
+
+	  fprintf(f, "out-of-core plan for ");
+	  for (i = 0; i < p->rank; ++i)
+	       fprintf(f, "%s%d", i ? "x" : "", p->n[i]);
+	  fprintf(f, " transform:\n");
+	  fprintf(f, "  -- %d planes per slab, %d columns per block, "
+		  "2 buffers of %lu bytes\n",
+		  p->slab_planes, p->col_width,
+		  (unsigned long) (p->nbuf * sizeof(fftw_real)));
+	  fprintf(f, "* slabs: ");
+	  rfftwnd_fprint_plan(f, p->slab_plan);
+	  fprintf(f, "* columns: ");
+	  fftw_fprint_plan(f, p->col_plan);
+     }
+}
+
+/********************* Block I/O and Computation *********************/
+
+enum ooc_pass {
+     OOC_SLABS, OOC_COLUMNS
+};
+
+static int pass_nblocks(rfftwnd_ooc_plan p, enum ooc_pass pass)
+{
+     if (pass == OOC_SLABS)
+	  return (p->n[0] + p->slab_planes - 1) / p->slab_planes;
+     else {
+	  int ncols = (int) (p->plane_size / 2);
+	  return (ncols + p->col_width - 1) / p->col_width;
+     }
+}
+
+/*
+ * Issue the reads (writing == 0) or writes (writing != 0) that move
+ * block k of the given pass between the I/O layer and buf.  Returns
+ * the number of planes (slabs) or columns (column blocks) in block k.
+ */
+static int block_io(rfftwnd_ooc_plan p, rfftwnd_ooc_io *io,
+		    enum ooc_pass pass, int k, fftw_real *buf, int writing)
+{
+     if (pass == OOC_SLABS) {
+	  int first = k * p->slab_planes;
+	  int count = p->n[0] - first;
+	  size_t offset = first * p->plane_size;
+
+	  if (count > p->slab_planes)
+	       count = p->slab_planes;
+	  if (writing)
+	       io->write(buf, offset, count * p->plane_size, io->data);
+	  else
+	       io->read(buf, offset, count * p->plane_size, io->data);
+	  return count;
+     } else {
+	  int ncols = (int) (p->plane_size / 2);
+	  int first = k * p->col_width;
+	  int count = ncols - first;
+	  int i, n0 = p->n[0];
+
+	  if (count > p->col_width)
+	       count = p->col_width;
+	  for (i = 0; i < n0; ++i) {
+	       size_t offset = i * p->plane_size + 2 * (size_t) first;
+
+	       if (writing)
+		    io->write(buf + 2 * i * count, offset, 2 * count,
+			      io->data);
+	       else
+		    io->read(buf + 2 * i * count, offset, 2 * count,
+			     io->data);
+	  }
+	  return count;
+     }
+}
+
+static void block_compute(rfftwnd_ooc_plan p, enum ooc_pass pass,
+			  fftw_real *buf, int count)
+{
+     if (pass == OOC_SLABS) {
+	  if (p->dir == FFTW_REAL_TO_COMPLEX)
+	       rfftwnd_real_to_complex(p->slab_plan, count,
+				       buf, 1, (int) p->plane_size,
+				       0, 1, 0);
+	  else
+	       rfftwnd_complex_to_real(p->slab_plan, count,
+				       (fftw_complex *) buf, 1,
+				       (int) (p->plane_size / 2),
+				       0, 1, 0);
+     } else
+	  fftw(p->col_plan, count, (fftw_complex *) buf, count, 1,
+	       p->work, 1, 0);
+}
+
+static void ooc_wait(rfftwnd_ooc_io *io, const fftw_real *buf)
+{
+     if (io->wait)
+	  io->wait(buf, io->data);
+}
+
+/* run one pass over the whole array, double-buffered */
+static void ooc_pass(rfftwnd_ooc_plan p, rfftwnd_ooc_io *io,
+		     enum ooc_pass pass)
+{
+     int k, nblocks = pass_nblocks(p, pass);
+     int count, next_count = 0;
+
+     next_count = block_io(p, io, pass, 0, p->buf[0], 0);
+
+     for (k = 0; k < nblocks; ++k) {
+	  fftw_real *cur = p->buf[k & 1];
+	  fftw_real *next = p->buf[(k + 1) & 1];
+
+	  count = next_count;
+	  ooc_wait(io, cur);
+
+	  if (k + 1 < nblocks) {
+	       /* next still holds block k-1, which may be in flight */
+	       ooc_wait(io, next);
+	       next_count = block_io(p, io, pass, k + 1, next, 0);
+	  }
+
+	  block_compute(p, pass, cur, count);
+	  block_io(p, io, pass, k, cur, 1);
+     }
+
+     ooc_wait(io, p->buf[0]);
+     ooc_wait(io, p->buf[1]);
+}
+
+/********************* Computing the Transform *********************/
+
+void rfftwnd_ooc_one(rfftwnd_ooc_plan p, rfftwnd_ooc_io *io)
+{
+     if (p->dir == FFTW_REAL_TO_COMPLEX) {
+	  ooc_pass(p, io, OOC_SLABS);
+	  ooc_pass(p, io, OOC_COLUMNS);
+     } else {
+	  ooc_pass(p, io, OOC_COLUMNS);
+	  ooc_pass(p, io, OOC_SLABS);
+     }
+}
+
+/************************ Standard I/O Layers ************************/
+
+/*
+ * memory I/O: the array is at base, typically a memory-mapped file.
+ * The kernel pages it in and out; we only ever touch a slab or a
+ * column block of it at a time.
+ */
+static void memory_read(fftw_real *buf, size_t offset, size_t count,
+			void *data)
+{
+     memcpy(buf, (fftw_real *) data + offset, count * sizeof(fftw_real));
+}
+
+static void memory_write(const fftw_real *buf, size_t offset, size_t count,
+			 void *data)
+{
+     memcpy((fftw_real *) data + offset, buf, count * sizeof(fftw_real));
+}
+
+void rfftwnd_ooc_memory_io(rfftwnd_ooc_io *io, fftw_real *base)
+{
+     io->read = memory_read;
+     io->write = memory_write;
+     io->wait = 0;
+     io->data = (void *) base;
+}
+
+/*
+ * stdio I/O: the array starts at offset 0 of a binary file f.
+ * Synchronous.  Offsets are 64-bit, since the file is meant to be
+ * larger than memory (long is only 32 bits on Windows).
+ */
+#ifdef _WIN32
+#define ooc_seek(f, offset) \
+     _fseeki64(f, (__int64) (offset) * sizeof(fftw_real), SEEK_SET)
+#else
+#define ooc_seek(f, offset) \
+     fseeko(f, (off_t) (offset) * sizeof(fftw_real), SEEK_SET)
+#endif
+
+static void file_read(fftw_real *buf, size_t offset, size_t count,
+		      void *data)
+{
+     FILE *f = (FILE *) data;
+
+     if (ooc_seek(f, offset)
+	 || fread(buf, sizeof(fftw_real), count, f) != count)
+	  fftw_die("rfftwnd_ooc: error reading file\n");
+}
+
+static void file_write(const fftw_real *buf, size_t offset, size_t count,
+		       void *data)
+{
+     FILE *f = (FILE *) data;
+
+     if (ooc_seek(f, offset)
+	 || fwrite(buf, sizeof(fftw_real), count, f) != count)
+	  fftw_die("rfftwnd_ooc: error writing file\n");
+}
+
+void rfftwnd_ooc_file_io(rfftwnd_ooc_io *io, FILE *f)
+{
+     io->read = file_read;
+     io->write = file_write;
+     io->wait = 0;
+     io->data = (void *) f;
+}
+
+/*
+ * fd I/O: the array starts at offset 0 of the file open on fd.  The
+ * transfers are done, in the order they are issued, by an I/O thread.
+ * The layer is made for one plan: a transfer belongs to the buffer of
+ * the plan it lies in, and wait(buf) blocks until the transfers of
+ * that buffer are done (and those outside the buffers of the plan,
+ * which the layer cannot tell apart).
+ */
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#define fd_lock(d)   EnterCriticalSection(&(d)->lock)
+#define fd_unlock(d) LeaveCriticalSection(&(d)->lock)
+#define fd_sleep(d)  SleepConditionVariableCS(&(d)->wake, &(d)->lock, INFINITE)
+#define fd_wake(d)   WakeAllConditionVariable(&(d)->wake)
+#else
+#include <pthread.h>
+#include <unistd.h>
+#include <errno.h>
+#define fd_lock(d)   pthread_mutex_lock(&(d)->lock)
+#define fd_unlock(d) pthread_mutex_unlock(&(d)->lock)
+#define fd_sleep(d)  pthread_cond_wait(&(d)->wake, &(d)->lock)
+#define fd_wake(d)   pthread_cond_broadcast(&(d)->wake)
+#endif
+
+typedef struct fd_request_s {
+     struct fd_request_s *next;
+     fftw_real *buf;
+     size_t offset, count;
+     int writing;
+     int owner;			/* 0 or 1: buffer of the plan; 2: neither */
+} fd_request;
+
+typedef struct {
+     int fd;
+     const fftw_real *base[2];	/* the buffers of the plan */
+     size_t nbuf;
+     fd_request *head, *tail;	/* queued, not yet started */
+     fd_request *spare;		/* done, for reuse */
+     int pending[3];		/* issued and not done, per owner */
+     int quit;
+#ifdef _WIN32
+     CRITICAL_SECTION lock;
+     CONDITION_VARIABLE wake;
+     HANDLE thread;
+#else
+     pthread_mutex_t lock;
+     pthread_cond_t wake;
+     pthread_t thread;
+#endif
+} fd_data;
+
+static int fd_owner(fd_data *d, const fftw_real *buf)
+{
+     int i;
+
+     for (i = 0; i < 2; ++i)
+	  if (buf >= d->base[i] && buf < d->base[i] + d->nbuf)
+	       return i;
+     return 2;
+}
+
+/* move r->count reals between r->buf and the file; called by the I/O thread only */
+static void fd_transfer(fd_data *d, fd_request *r)
+{
+     char *p = (char *) r->buf;
+     size_t left = r->count * sizeof(fftw_real);
+#ifdef _WIN32
+     if (_lseeki64(d->fd, (__int64) r->offset * sizeof(fftw_real),
+		   SEEK_SET) < 0)
+	  fftw_die("rfftwnd_ooc: error seeking in file\n");
+     while (left > 0) {
+	  unsigned int chunk = left > (1u << 30) ? (1u << 30) : (unsigned int) left;
+	  int done = r->writing ? _write(d->fd, p, chunk)
+	       : _read(d->fd, p, chunk);
+
+	  if (done <= 0)
+	       fftw_die(r->writing ? "rfftwnd_ooc: error writing file\n"
+			: "rfftwnd_ooc: error reading file\n");
+	  p += done;
+	  left -= done;
+     }
+#else
+     off_t offset = (off_t) r->offset * sizeof(fftw_real);
+
+     while (left > 0) {
+	  ssize_t done = r->writing ? pwrite(d->fd, p, left, offset)
+	       : pread(d->fd, p, left, offset);
+
+	  if (done < 0 && errno == EINTR)
+	       continue;
+	  if (done <= 0)
+	       fftw_die(r->writing ? "rfftwnd_ooc: error writing file\n"
+			: "rfftwnd_ooc: error reading file\n");
+	  p += done;
+	  offset += done;
+	  left -= done;
+     }
+#endif
+}
+
+#ifdef _WIN32
+static DWORD WINAPI fd_thread(LPVOID arg)
+#else
+static void *fd_thread(void *arg)
+#endif
+{
+     fd_data *d = (fd_data *) arg;
+     fd_request *r;
+
+     fd_lock(d);
+     for (;;) {
+	  while (!d->head && !d->quit)
+	       fd_sleep(d);
+	  if (!d->head)
+	       break;		/* quit, with the queue drained */
+	  r = d->head;
+	  d->head = r->next;
+	  if (!d->head)
+	       d->tail = 0;
+	  fd_unlock(d);
+
+	  fd_transfer(d, r);
+
+	  fd_lock(d);
+	  --d->pending[r->owner];
+	  r->next = d->spare;
+	  d->spare = r;
+	  fd_wake(d);
+     }
+     fd_unlock(d);
+     return 0;
+}
+
+static void fd_queue(fd_data *d, fftw_real *buf, size_t offset, size_t count,
+		     int writing)
+{
+     fd_request *r;
+
+     fd_lock(d);
+     if (d->spare) {
+	  r = d->spare;
+	  d->spare = r->next;
+     } else
+	  r = (fd_request *) fftw_malloc(sizeof(fd_request));
+     r->next = 0;
+     r->buf = buf;
+     r->offset = offset;
+     r->count = count;
+     r->writing = writing;
+     r->owner = fd_owner(d, buf);
+     if (d->tail)
+	  d->tail->next = r;
+     else
+	  d->head = r;
+     d->tail = r;
+     ++d->pending[r->owner];
+     fd_wake(d);
+     fd_unlock(d);
+}
+
+static void fd_read(fftw_real *buf, size_t offset, size_t count, void *data)
+{
+     fd_queue((fd_data *) data, buf, offset, count, 0);
+}
+
+static void fd_write(const fftw_real *buf, size_t offset, size_t count,
+		     void *data)
+{
+     fd_queue((fd_data *) data, (fftw_real *) buf, offset, count, 1);
+}
+
+static void fd_wait(const fftw_real *buf, void *data)
+{
+     fd_data *d = (fd_data *) data;
+     int owner = fd_owner(d, buf);
+
+     fd_lock(d);
+     while (d->pending[2] || (owner == 2 ? d->pending[0] || d->pending[1]
+			       : d->pending[owner]))
+	  fd_sleep(d);
+     fd_unlock(d);
+}
+
+/*
+ * Set up io for the transforms of plan p on the file open on fd, and
+ * start its I/O thread.  Returns 0, or -1 if the thread cannot be
+ * started.  rfftwnd_ooc_fd_io_destroy finishes the transfers still
+ * queued and stops the thread.
+ */
+int rfftwnd_ooc_fd_io(rfftwnd_ooc_io *io, int fd, rfftwnd_ooc_plan p)
+{
+     fd_data *d = (fd_data *) fftw_malloc(sizeof(fd_data));
+
+     memset(d, 0, sizeof(fd_data));
+     d->fd = fd;
+     d->base[0] = p->buf[0];
+     d->base[1] = p->buf[1];
+     d->nbuf = p->nbuf;
+#ifdef _WIN32
+     InitializeCriticalSection(&d->lock);
+     InitializeConditionVariable(&d->wake);
+     d->thread = CreateThread(0, 0, fd_thread, d, 0, 0);
+     if (!d->thread) {
+	  DeleteCriticalSection(&d->lock);
+	  fftw_free(d);
+	  return -1;
+     }
+#else
+     pthread_mutex_init(&d->lock, 0);
+     pthread_cond_init(&d->wake, 0);
+     if (pthread_create(&d->thread, 0, fd_thread, d) != 0) {
+	  pthread_cond_destroy(&d->wake);
+	  pthread_mutex_destroy(&d->lock);
+	  fftw_free(d);
+	  return -1;
+     }
+#endif
+     io->read = fd_read;
+     io->write = fd_write;
+     io->wait = fd_wait;
+     io->data = (void *) d;
+     return 0;
+}
+
+void rfftwnd_ooc_fd_io_destroy(rfftwnd_ooc_io *io)
+{
+     fd_data *d = (fd_data *) io->data;
+     fd_request *r;
+
+     fd_lock(d);
+     d->quit = 1;
+     fd_wake(d);
+     fd_unlock(d);
+#ifdef _WIN32
+     WaitForSingleObject(d->thread, INFINITE);
+     CloseHandle(d->thread);
+     DeleteCriticalSection(&d->lock);
+#else
+     pthread_join(d->thread, 0);
+     pthread_cond_destroy(&d->wake);
+     pthread_mutex_destroy(&d->lock);
+#endif
+     while ((r = d->spare) != 0) {
+	  d->spare = r->next;
+	  fftw_free(r);
+     }
+     fftw_free(d);
+     io->data = 0;
+}
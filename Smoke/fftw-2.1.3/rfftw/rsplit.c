@@ -0,0 +1,273 @@
+
+/*
+ * Copyright (c) 1997-1999 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/*
+ * rsplit.c -- complex transforms of split-format data, i.e. data
+ * stored as separate arrays of real and imaginary parts.
+ *
+ * The transform of x = r + i*s is computed from the real-to-halfcomplex
+ * transforms R and S of the two (real) input arrays, which are done by
+ * the ordinary rfftw codelets directly on the split arrays.  For
+ * 0 < k < n/2, with R[k] = a + i*b and S[k] = c + i*d (a, b, c and d
+ * being the halfcomplex outputs at k and n-k),
+ *
+ *      X[k]   = (a - d) + i*(b + c)
+ *      X[n-k] = (a + d) + i*(c - b)
+ *
+ * so that a single in-place pass over the two halfcomplex arrays
+ * turns them into the real and imaginary parts of X.  The backward
+ * transform is the forward transform with the roles of the real and
+ * imaginary arrays exchanged, on both input and output.
+ */
+
+#include <fftw-int.h>
+#include <rfftw.h>
+
+/********************** Initializing the Plans ***********************/
+
+fftw_split_plan fftw_split_create_plan(int n, fftw_direction dir, int flags)
+{
+     fftw_split_plan p;
+
+     if (n <= 0)
+	  return 0;
+
+     p = (fftw_split_plan) fftw_malloc(sizeof(fftw_split_data));
+     p->n = n;
+     p->dir = dir;
+     p->flags = flags;
+     p->work = 0;
+
+     /* both directions are computed with a forward real transform */
+     p->plan = rfftw_create_plan(n, FFTW_REAL_TO_COMPLEX, flags);
+     if (!p->plan) {
+	  fftw_free(p);
+	  return 0;
+     }
+
+     if ((flags & FFTW_IN_PLACE) && !(flags & FFTW_THREADSAFE))
+	  p->work = (fftw_real *) fftw_malloc(n * sizeof(fftw_real));
+
+     return p;
+}
+
+/* like fftwnd: dimensions of equal size share a single 1d plan */
+fftwnd_split_plan fftwnd_split_create_plan(int rank, const int *n,
+					   fftw_direction dir, int flags)
+{
+     fftwnd_split_plan p;
+     int i, j;
+
+     if (rank <= 0)
+	  return 0;
+     for (i = 0; i < rank; ++i)
+	  if (n[i] <= 0)
+	       return 0;
+
+     p = (fftwnd_split_plan) fftw_malloc(sizeof(fftwnd_split_data));
+     p->is_in_place = flags & FFTW_IN_PLACE;
+     p->rank = rank;
+     p->n = (int *) fftw_malloc(sizeof(int) * rank);
+     p->n_before = (int *) fftw_malloc(sizeof(int) * rank);
+     p->n_after = (int *) fftw_malloc(sizeof(int) * rank);
+     p->plans = (fftw_split_plan *)
+	 fftw_malloc(sizeof(fftw_split_plan) * rank);
+
+     p->n_before[0] = 1;
+     p->n_after[rank - 1] = 1;
+     for (i = 0; i < rank; ++i) {
+	  p->n[i] = n[i];
+	  p->plans[i] = 0;
+	  if (i) {
+	       p->n_before[i] = p->n_before[i - 1] * n[i - 1];
+	       p->n_after[rank - 1 - i] = p->n_after[rank - i] * n[rank - i];
+	  }
+     }
+
+     /*
+      * The last dimension goes from the input to the output; the
+      * others are then done in place on the output.
+      */
+     for (i = rank - 1; i >= 0; --i) {
+	  int in_place = (i < rank - 1) || p->is_in_place;
+
+	  for (j = i + 1; j < rank; ++j)
+	       if (n[j] == n[i] && ((j < rank - 1) || p->is_in_place)) {
+		    p->plans[i] = p->plans[j];
+		    break;
+	       }
+	  if (j == rank) {
+	       p->plans[i] = fftw_split_create_plan(n[i], dir,
+				 in_place ? (flags | FFTW_IN_PLACE)
+				 : (flags & ~FFTW_IN_PLACE));
+	       if (!p->plans[i]) {
+		    fftwnd_split_destroy_plan(p);
+		    return 0;
+	       }
+	  }
+     }
+
+     return p;
+}
+
+/************************ Freeing the Plans ************************/
+
+void fftw_split_destroy_plan(fftw_split_plan plan)
+{
+     if (plan) {
+	  rfftw_destroy_plan(plan->plan);
+	  if (plan->work)
+	       fftw_free(plan->work);
+	  fftw_free(plan);
+     }
+}
+
+void fftwnd_split_destroy_plan(fftwnd_split_plan plan)
+{
+     if (plan) {
+	  int i, j;
+
+	  for (i = 0; i < plan->rank; ++i) {
+	       /* don't free shared plans twice */
+	       for (j = i + 1; j < plan->rank; ++j)
+		    if (plan->plans[i] == plan->plans[j])
+			 break;
+	       if (j == plan->rank)
+		    fftw_split_destroy_plan(plan->plans[i]);
+	  }
+	  fftw_free(plan->plans);
+	  fftw_free(plan->n_after);
+	  fftw_free(plan->n_before);
+	  fftw_free(plan->n);
+	  fftw_free(plan);
+     }
+}
+
+/********************* Computing the Transforms *********************/
+
+/* turn the halfcomplex transforms of re and im into re + i*im */
+static void split_combine(int n, fftw_real *re, fftw_real *im, int stride)
+{
+     int k;
+     fftw_real *re2 = re + n * stride, *im2 = im + n * stride;
+
+     for (k = 1; 2 * k < n; ++k) {
+	  fftw_real a, b, c, d;
+
+	  re2 -= stride;
+	  im2 -= stride;
+	  a = re[k * stride];
+	  b = *re2;
+	  c = im[k * stride];
+	  d = *im2;
+	  re[k * stride] = a - d;
+	  im[k * stride] = b + c;
+	  *re2 = a + d;
+	  *im2 = c - b;
+     }
+}
+
+void fftw_split(fftw_split_plan plan, int howmany,
+		fftw_real *ri, fftw_real *ii, int istride, int idist,
+		fftw_real *ro, fftw_real *io, int ostride, int odist)
+{
+     int n = plan->n;
+     int i;
+
+     if (plan->dir == FFTW_BACKWARD) {
+	  fftw_real *t;
+
+	  t = ri;
+	  ri = ii;
+	  ii = t;
+	  t = ro;
+	  ro = io;
+	  io = t;
+     }
+
+     if (plan->flags & FFTW_IN_PLACE) {
+	  rfftw(plan->plan, howmany, ri, istride, idist, plan->work, 1, 0);
+	  rfftw(plan->plan, howmany, ii, istride, idist, plan->work, 1, 0);
+	  ro = ri;
+	  io = ii;
+	  ostride = istride;
+	  odist = idist;
+     } else {
+	  rfftw(plan->plan, howmany, ri, istride, idist, ro, ostride, odist);
+	  rfftw(plan->plan, howmany, ii, istride, idist, io, ostride, odist);
+     }
+
+     for (i = 0; i < howmany; ++i)
+	  split_combine(n, ro + i * odist, io + i * odist, ostride);
+}
+
+void fftw_split_one(fftw_split_plan plan,
+		    fftw_real *ri, fftw_real *ii,
+		    fftw_real *ro, fftw_real *io)
+{
+     fftw_split(plan, 1, ri, ii, 1, 0, ro, io, 1, 0);
+}
+
+static void fftwnd_split_aux(fftwnd_split_plan p,
+			     fftw_real *ri, fftw_real *ii, int istride,
+			     fftw_real *ro, fftw_real *io, int ostride)
+{
+     int last = p->rank - 1;
+     int d, b;
+
+     fftw_split(p->plans[last], p->n_before[last],
+		ri, ii, istride, p->n[last] * istride,
+		ro, io, ostride, p->n[last] * ostride);
+
+     for (d = last - 1; d >= 0; --d) {
+	  int nb = p->n[d] * p->n_after[d] * ostride;
+
+	  for (b = 0; b < p->n_before[d]; ++b)
+	       fftw_split(p->plans[d], p->n_after[d],
+			  ro + b * nb, io + b * nb,
+			  p->n_after[d] * ostride, ostride,
+			  0, 0, 0, 0);
+     }
+}
+
+void fftwnd_split(fftwnd_split_plan plan, int howmany,
+		  fftw_real *ri, fftw_real *ii, int istride, int idist,
+		  fftw_real *ro, fftw_real *io, int ostride, int odist)
+{
+     int i;
+
+     if (plan->is_in_place) {
+	  ro = ri;
+	  io = ii;
+	  ostride = istride;
+	  odist = idist;
+     }
+
+     for (i = 0; i < howmany; ++i)
+	  fftwnd_split_aux(plan, ri + i * idist, ii + i * idist, istride,
+			   ro + i * odist, io + i * odist, ostride);
+}
+
+void fftwnd_split_one(fftwnd_split_plan plan,
+		      fftw_real *ri, fftw_real *ii,
+		      fftw_real *ro, fftw_real *io)
+{
+     fftwnd_split(plan, 1, ri, ii, 1, 0, ro, io, 1, 0);
+}
@@ -713,9 +713,57 @@ void test_in_place_both(int n, int istride, int howmany,
      }
 }
 
+/*
+ * interleaved batches (idist = 1 < istride = howmany), which the
+ * executor hands to the batch codelets, lanes at a time
+ */
+void test_interleaved(int n, int howmany, fftw_direction dir,
+		      int in_place, fftw_plan validated_plan)
+{
+     fftw_complex *in1, *out1, *in2, *out2;
+     fftw_plan plan;
+     int i, j;
+     int flags = measure_flag | wisdom_flag;
+
+     if (coinflip())
+	  flags |= FFTW_THREADSAFE;
+     flags |= in_place ? FFTW_IN_PLACE : FFTW_OUT_OF_PLACE;
+
+     in1 = (fftw_complex *) fftw_malloc(n * howmany * sizeof(fftw_complex));
+     out1 = (fftw_complex *) fftw_malloc(n * howmany * sizeof(fftw_complex));
+     in2 = (fftw_complex *) fftw_malloc(n * sizeof(fftw_complex));
+     out2 = (fftw_complex *) fftw_malloc(n * sizeof(fftw_complex));
+
+     plan = fftw_create_plan(n, dir, flags);
+     CHECK(plan != NULL, "can't create plan");
+
+     fill_random(in1, n * howmany);
+     array_copy(out1, in1, n * howmany);
+
+     if (in_place)
+	  fftw(plan, howmany, out1, howmany, 1, (fftw_complex *) NULL, 0, 0);
+     else
+	  fftw(plan, howmany, in1, howmany, 1, out1, howmany, 1);
+
+     for (j = 0; j < howmany; ++j) {
+	  for (i = 0; i < n; ++i)
+	       in2[i] = in1[i * howmany + j];
+	  fftw(validated_plan, 1, in2, 1, n, out2, 1, n);
+	  CHECK(compute_error_complex(out1 + j, howmany, out2, 1, n)
+		< TOLERANCE, "test_interleaved: wrong answer");
+     }
+
+     fftw_destroy_plan(plan);
+
+     fftw_free(out2);
+     fftw_free(in2);
+     fftw_free(out1);
+     fftw_free(in1);
+}
+
 void test_correctness(int n)
 {
-     int istride, ostride, howmany;
+     int istride, ostride, howmany, i;
      fftw_plan validated_plan_forward, validated_plan_backward;
 
      WHEN_VERBOSE(1,
@@ -743,6 +791,13 @@ void test_correctness(int n)
 				  validated_plan_forward,
 				  validated_plan_backward);
 
+     for (i = 0; i <= 1; ++i) {
+	  test_interleaved(n, 2 * FFTW_BATCH_LANES + 1, FFTW_FORWARD, i,
+			   validated_plan_forward);
+	  test_interleaved(n, 2 * FFTW_BATCH_LANES + 1, FFTW_BACKWARD, i,
+			   validated_plan_backward);
+     }
+
      fftw_destroy_plan(validated_plan_forward);
      fftw_destroy_plan(validated_plan_backward);
 
@@ -897,6 +952,113 @@ void testnd_in_place(int rank, int *n, fftw_direction dir,
      fftw_free(in1);
 }
 
+/*
+ * guru interface: a 2x3 batch of transforms of sub-blocks of a padded
+ * array, batch index 1 innermost (interleaved), written out transposed
+ * (column-major) with the batch outermost.
+ */
+void testnd_guru(int rank, int *n, fftw_direction dir,
+		 fftwnd_plan validated_plan, int in_place)
+{
+     fftw_iodim *dims, howmany_dims[2];
+     int N, NP, dim, i, h, k;
+     int *ioff, *ooff;
+     fftw_complex *in1, *out1, *in2, *in3, *out2;
+     fftw_guru_plan p;
+     int flags = measure_flag | wisdom_flag;
+
+     if (coinflip())
+	  flags |= FFTW_THREADSAFE;
+     if (in_place)
+	  flags |= FFTW_IN_PLACE;
+
+     dims = (fftw_iodim *) fftw_malloc(rank * sizeof(fftw_iodim));
+     N = NP = 1;
+     for (dim = rank - 1; dim >= 0; --dim) {
+	  dims[dim].n = n[dim];
+	  dims[dim].is = 3 * NP;
+	  NP *= n[dim] + 1;
+     }
+     for (dim = 0; dim < rank; ++dim) {
+	  dims[dim].os = in_place ? dims[dim].is : N;
+	  N *= n[dim];
+     }
+     howmany_dims[0].n = 2;
+     howmany_dims[0].is = 3 * NP;
+     howmany_dims[0].os = in_place ? 3 * NP : 3 * N;
+     howmany_dims[1].n = 3;
+     howmany_dims[1].is = 1;
+     howmany_dims[1].os = in_place ? 1 : N;
+
+     /* offsets of each (row-major) element in the input and output */
+     ioff = (int *) fftw_malloc(N * sizeof(int));
+     ooff = (int *) fftw_malloc(N * sizeof(int));
+     for (i = 0; i < N; ++i) {
+	  int r = i;
+
+	  ioff[i] = ooff[i] = 0;
+	  for (dim = rank - 1; dim >= 0; --dim) {
+	       ioff[i] += (r % n[dim]) * dims[dim].is;
+	       ooff[i] += (r % n[dim]) * dims[dim].os;
+	       r /= n[dim];
+	  }
+     }
+
+     in1 = (fftw_complex *) fftw_malloc(6 * NP * sizeof(fftw_complex));
+     out1 = (fftw_complex *) fftw_malloc(6 * N * sizeof(fftw_complex));
+     in2 = (fftw_complex *) fftw_malloc(N * sizeof(fftw_complex));
+     in3 = (fftw_complex *) fftw_malloc(N * sizeof(fftw_complex));
+     out2 = (fftw_complex *) fftw_malloc(N * sizeof(fftw_complex));
+
+     p = fftw_create_guru_plan(rank, dims, 2, howmany_dims, dir, flags);
+     CHECK(p != NULL, "can't create plan");
+
+     /* the padding must be left alone */
+     for (i = 0; i < 6 * NP; ++i)
+	  c_re(in1[i]) = c_im(in1[i]) = 42.0;
+     fill_random(in2, N);
+     for (h = 0; h < 6; ++h)
+	  for (i = 0; i < N; ++i) {
+	       k = ioff[i] + (h / 3) * howmany_dims[0].is + h % 3;
+	       c_re(in1[k]) = c_re(in2[i]) + h;
+	       c_im(in1[k]) = c_im(in2[i]) - h;
+	  }
+
+     fftw_guru(p, in1, out1);
+
+     for (h = 0; h < 6; ++h) {
+	  for (i = 0; i < N; ++i) {
+	       c_re(in3[i]) = c_re(in2[i]) + h;
+	       c_im(in3[i]) = c_im(in2[i]) - h;
+	  }
+	  fftwnd(validated_plan, 1, in3, 1, 1, out2, 1, 1);
+	  for (i = 0; i < N; ++i) {
+	       k = ooff[i] + (h / 3) * howmany_dims[0].os
+		   + (h % 3) * howmany_dims[1].os;
+	       CHECK(compute_error_complex((in_place ? in1 : out1) + k, 1,
+					   out2 + i, 1, 1) < TOLERANCE,
+		     "testnd_guru: wrong answer");
+	  }
+     }
+
+     k = 0;
+     for (i = 0; i < 6 * NP; ++i)
+	  if (c_re(in1[i]) == 42.0 && c_im(in1[i]) == 42.0)
+	       ++k;
+     CHECK(k == 6 * (NP - N), "testnd_guru: padding overwritten");
+
+     fftw_destroy_guru_plan(p);
+
+     fftw_free(out2);
+     fftw_free(in3);
+     fftw_free(in2);
+     fftw_free(out1);
+     fftw_free(in1);
+     fftw_free(ooff);
+     fftw_free(ioff);
+     fftw_free(dims);
+}
+
 void testnd_correctness(struct size sz, fftw_direction dir,
 			int alt_api, int specific, int force_buf)
 {
@@ -908,6 +1070,10 @@ void testnd_correctness(struct size sz, fftw_direction dir,
 
      testnd_out_of_place(sz.rank, sz.narray, dir, validated_plan);
      testnd_in_place(sz.rank, sz.narray, dir, validated_plan, alt_api, specific, force_buf);
+     if (sz.rank >= 1) {
+	  testnd_guru(sz.rank, sz.narray, dir, validated_plan, 0);
+	  testnd_guru(sz.rank, sz.narray, dir, validated_plan, 1);
+     }
 
      fftwnd_destroy_plan(validated_plan);
 }
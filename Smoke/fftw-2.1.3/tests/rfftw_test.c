@@ -484,6 +484,94 @@ void test_in_place_both(int n, int istride, int howmany,
      }
 }
 
+void test_split(int n, int istride, int ostride, int howmany,
+		fftw_direction dir, int in_place, fftw_plan validated_plan)
+{
+     fftw_real *ri, *ii, *ro, *io;
+     fftw_complex *in2, *out2;
+     fftw_split_plan plan;
+     int flags = measure_flag | wisdom_flag;
+     int i, j, idist, odist;
+
+     if (coinflip())
+	  flags |= FFTW_THREADSAFE;
+     if (in_place) {
+	  flags |= FFTW_IN_PLACE;
+	  ostride = istride;
+     }
+     idist = n * istride;
+     odist = n * ostride;
+
+     ri = (fftw_real *) fftw_malloc(idist * howmany * sizeof(fftw_real));
+     ii = (fftw_real *) fftw_malloc(idist * howmany * sizeof(fftw_real));
+     ro = (fftw_real *) fftw_malloc(odist * howmany * sizeof(fftw_real));
+     io = (fftw_real *) fftw_malloc(odist * howmany * sizeof(fftw_real));
+     in2 = (fftw_complex *) fftw_malloc(n * howmany * sizeof(fftw_complex));
+     out2 = (fftw_complex *) fftw_malloc(n * sizeof(fftw_complex));
+
+     plan = fftw_split_create_plan(n, dir, flags);
+     CHECK(plan != NULL, "can't create plan");
+
+     for (j = 0; j < howmany; ++j)
+	  for (i = 0; i < n; ++i) {
+	       c_re(in2[j * n + i]) = ri[j * idist + i * istride] = DRAND();
+	       c_im(in2[j * n + i]) = ii[j * idist + i * istride] = DRAND();
+	  }
+
+     if (in_place) {
+	  if (howmany == 1 && istride == 1 && coinflip())
+	       fftw_split_one(plan, ri, ii, 0, 0);
+	  else
+	       fftw_split(plan, howmany, ri, ii, istride, idist,
+			  0, 0, 0, 0);
+	  for (i = 0; i < idist * howmany; ++i) {
+	       ro[i] = ri[i];
+	       io[i] = ii[i];
+	  }
+     } else if (howmany == 1 && istride == 1 && ostride == 1 && coinflip())
+	  fftw_split_one(plan, ri, ii, ro, io);
+     else
+	  fftw_split(plan, howmany, ri, ii, istride, idist,
+		     ro, io, ostride, odist);
+
+     for (j = 0; j < howmany; ++j) {
+	  fftw(validated_plan, 1, in2 + j * n, 1, n, out2, 1, n);
+	  CHECK(compute_error(ro + j * odist, ostride,
+			      &c_re(out2[0]), 2, n) < TOLERANCE &&
+		compute_error(io + j * odist, ostride,
+			      &c_im(out2[0]), 2, n) < TOLERANCE,
+		"split: wrong answer");
+     }
+
+     fftw_split_destroy_plan(plan);
+
+     fftw_free(out2);
+     fftw_free(in2);
+     fftw_free(io);
+     fftw_free(ro);
+     fftw_free(ii);
+     fftw_free(ri);
+}
+
+void test_split_both(int n, int istride, int ostride, int howmany,
+		     fftw_plan validated_plan_forward,
+		     fftw_plan validated_plan_backward)
+{
+     int in_place;
+
+     for (in_place = 0; in_place <= 1; ++in_place) {
+	  WHEN_VERBOSE(2,
+	       printf("TEST CORRECTNESS (split, %s)"
+		   " n = %d  istride = %d  ostride = %d  howmany = %d\n",
+		      in_place ? "in place" : "out of place",
+		      n, istride, ostride, howmany));
+	  test_split(n, istride, ostride, howmany, FFTW_FORWARD,
+		     in_place, validated_plan_forward);
+	  test_split(n, istride, ostride, howmany, FFTW_BACKWARD,
+		     in_place, validated_plan_backward);
+     }
+}
+
 void test_correctness(int n)
 {
      int istride, ostride, howmany;
@@ -514,6 +602,13 @@ void test_correctness(int n)
 				  validated_plan_forward,
 				  validated_plan_backward);
 
+     for (istride = 1; istride <= MAX_STRIDE; ++istride)
+	  for (ostride = 1; ostride <= MAX_STRIDE; ++ostride)
+	       for (howmany = 1; howmany <= MAX_HOWMANY; ++howmany)
+		    test_split_both(n, istride, ostride, howmany,
+				    validated_plan_forward,
+				    validated_plan_backward);
+
      fftw_destroy_plan(validated_plan_forward);
      fftw_destroy_plan(validated_plan_backward);
 
@@ -757,6 +852,178 @@ void testnd_in_place(int rank, int *n, fftwnd_plan validated_plan,
      fftw_free(in1);
 }
 
+void testnd_out_of_core(int rank, int *n, fftwnd_plan validated_plan)
+{
+     int N, dim, i, j;
+     int nc, nhc, nr;
+     fftw_real *in1;
+     fftw_complex *in2, *out2;
+     rfftwnd_ooc_plan p, ip;
+     rfftwnd_ooc_io io;
+     FILE *f;
+     size_t max_memory;
+     int flags = measure_flag | wisdom_flag;
+
+     N = 1;
+     for (dim = 0; dim < rank; ++dim)
+	  N *= n[dim];
+     nr = n[rank - 1];
+     nc = N / nr;
+     nhc = nr / 2 + 1;
+
+     in1 = (fftw_real *) fftw_malloc(2 * nhc * nc * sizeof(fftw_real));
+     in2 = (fftw_complex *) fftw_malloc(N * sizeof(fftw_complex));
+     out2 = (fftw_complex *) fftw_malloc(N * sizeof(fftw_complex));
+
+     /* small enough to force several slabs and column blocks */
+     max_memory = (2 * nhc * nc / n[0]) * sizeof(fftw_real) * 3;
+     p = rfftwnd_ooc_create_plan(rank, n, FFTW_REAL_TO_COMPLEX, flags,
+				 max_memory);
+     ip = rfftwnd_ooc_create_plan(rank, n, FFTW_COMPLEX_TO_REAL, flags,
+				  max_memory);
+     CHECK(p != NULL && ip != NULL, "can't create plan");
+
+     for (i = 0; i < nc; ++i)
+	  for (j = 0; j < nr; ++j) {
+	       c_re(in2[i * nr + j]) = DRAND();
+	       c_im(in2[i * nr + j]) = 0.0;
+	       in1[i * nhc * 2 + j] = c_re(in2[i * nr + j]);
+	  }
+
+     fftwnd(validated_plan, 1, in2, 1, 1, out2, 1, 1);
+
+     rfftwnd_ooc_memory_io(&io, in1);
+     rfftwnd_ooc_one(p, &io);
+
+     for (i = 0; i < nc; ++i)
+	  CHECK(compute_error_complex((fftw_complex *) in1 + i * nhc, 1,
+				      out2 + i * nr, 1,
+				      nhc) < TOLERANCE,
+		"out-of-core (r2c): wrong answer");
+
+     rfftwnd_ooc_one(ip, &io);
+
+     for (i = 0; i < nc * nhc * 2; ++i)
+	  in1[i] *= 1.0 / N;
+
+     for (i = 0; i < nc; ++i)
+	  CHECK(compute_error(in1 + i * nhc * 2, 1,
+			      (fftw_real *) (in2 + i * nr), 2,
+			      nr) < TOLERANCE,
+		"out-of-core (c2r): wrong answer");
+
+     /* the same forward transform through the stdio layer */
+     f = tmpfile();
+     CHECK(f != NULL, "can't create temporary file");
+     CHECK(fwrite(in1, sizeof(fftw_real), 2 * nhc * nc, f)
+	   == (size_t) (2 * nhc * nc), "can't write temporary file");
+     rfftwnd_ooc_file_io(&io, f);
+     rfftwnd_ooc_one(p, &io);
+     rewind(f);
+     CHECK(fread(in1, sizeof(fftw_real), 2 * nhc * nc, f)
+	   == (size_t) (2 * nhc * nc), "can't read temporary file");
+
+     for (i = 0; i < nc; ++i)
+	  CHECK(compute_error_complex((fftw_complex *) in1 + i * nhc, 1,
+				      out2 + i * nr, 1,
+				      nhc) < TOLERANCE,
+		"out-of-core (r2c, file): wrong answer");
+
+     /* the inverse transform of that file through the asynchronous fd layer */
+     fflush(f);
+     CHECK(rfftwnd_ooc_fd_io(&io, fileno(f), ip) == 0,
+	   "can't start the I/O thread");
+     rfftwnd_ooc_one(ip, &io);
+     rfftwnd_ooc_fd_io_destroy(&io);
+     rewind(f);
+     CHECK(fread(in1, sizeof(fftw_real), 2 * nhc * nc, f)
+	   == (size_t) (2 * nhc * nc), "can't read temporary file");
+     fclose(f);
+
+     for (i = 0; i < nc * nhc * 2; ++i)
+	  in1[i] *= 1.0 / N;
+
+     for (i = 0; i < nc; ++i)
+	  CHECK(compute_error(in1 + i * nhc * 2, 1,
+			      (fftw_real *) (in2 + i * nr), 2,
+			      nr) < TOLERANCE,
+		"out-of-core (c2r, fd): wrong answer");
+
+     rfftwnd_ooc_destroy_plan(p);
+     rfftwnd_ooc_destroy_plan(ip);
+
+     fftw_free(out2);
+     fftw_free(in2);
+     fftw_free(in1);
+}
+
+void testnd_split(int rank, int *n, fftwnd_plan validated_plan,
+		  int in_place)
+{
+     int N, dim, i, istride, ostride;
+     fftw_real *ri, *ii, *ro, *io;
+     fftw_complex *in2, *out2;
+     fftwnd_split_plan p;
+     int flags = measure_flag | wisdom_flag;
+
+     if (coinflip())
+	  flags |= FFTW_THREADSAFE;
+     if (in_place)
+	  flags |= FFTW_IN_PLACE;
+
+     N = 1;
+     for (dim = 0; dim < rank; ++dim)
+	  N *= n[dim];
+
+     ri = (fftw_real *) fftw_malloc(N * MAX_STRIDE * sizeof(fftw_real));
+     ii = (fftw_real *) fftw_malloc(N * MAX_STRIDE * sizeof(fftw_real));
+     ro = (fftw_real *) fftw_malloc(N * MAX_STRIDE * sizeof(fftw_real));
+     io = (fftw_real *) fftw_malloc(N * MAX_STRIDE * sizeof(fftw_real));
+     in2 = (fftw_complex *) fftw_malloc(N * sizeof(fftw_complex));
+     out2 = (fftw_complex *) fftw_malloc(N * sizeof(fftw_complex));
+
+     p = fftwnd_split_create_plan(rank, n, FFTW_FORWARD, flags);
+     CHECK(p != NULL, "can't create plan");
+
+     for (istride = 1; istride <= MAX_STRIDE; ++istride) {
+	  for (i = 0; i < N; ++i) {
+	       c_re(in2[i]) = ri[i * istride] = DRAND();
+	       c_im(in2[i]) = ii[i * istride] = DRAND();
+	  }
+
+	  fftwnd(validated_plan, 1, in2, 1, 1, out2, 1, 1);
+
+	  if (in_place) {
+	       ostride = istride;
+	       fftwnd_split(p, 1, ri, ii, istride, 0, 0, 0, 0, 0);
+	       for (i = 0; i < N; ++i) {
+		    ro[i * ostride] = ri[i * istride];
+		    io[i * ostride] = ii[i * istride];
+	       }
+	  } else {
+	       ostride = MAX_STRIDE + 1 - istride;
+	       if (istride == 1 && ostride == 1)
+		    fftwnd_split_one(p, ri, ii, ro, io);
+	       else
+		    fftwnd_split(p, 1, ri, ii, istride, 0,
+				 ro, io, ostride, 0);
+	  }
+
+	  CHECK(compute_error(ro, ostride, &c_re(out2[0]), 2, N) < TOLERANCE
+		&& compute_error(io, ostride, &c_im(out2[0]), 2, N)
+		< TOLERANCE, "split: wrong answer");
+     }
+
+     fftwnd_split_destroy_plan(p);
+
+     fftw_free(out2);
+     fftw_free(in2);
+     fftw_free(io);
+     fftw_free(ro);
+     fftw_free(ii);
+     fftw_free(ri);
+}
+
 void testnd_correctness(struct size sz, fftw_direction dir,
 			int alt_api, int specific, int force_buf)
 {
@@ -774,6 +1041,12 @@ void testnd_correctness(struct size sz, fftw_direction dir,
      testnd_out_of_place(sz.rank, sz.narray, validated_plan);
      testnd_in_place(sz.rank, sz.narray,
 		     validated_plan, alt_api, specific);
+     if (sz.rank >= 2)
+	  testnd_out_of_core(sz.rank, sz.narray, validated_plan);
+     if (sz.rank >= 1) {
+	  testnd_split(sz.rank, sz.narray, validated_plan, 0);
+	  testnd_split(sz.rank, sz.narray, validated_plan, 1);
+     }
 
      fftwnd_destroy_plan(validated_plan);
 }
@@ -6,13 +6,30 @@
 #include <GL/glut.h>            //the GLUT graphics library
 #include <stdio.h>              //for printing the help text
 #include <math.h>              //for printing the help text
+#include <string.h>             //for the command line and the commands of the frame server
+#include <ctype.h>              //for the command line
+#include "fluids.h"             //shared state of the simulation and the visualization modules
+#include "isolines.h"           //marching-squares isolines
+#include "tracer.h"             //streamlines and particles
+#include "lic.h"                //line integral convolution
+#include "ibfv.h"               //image-based flow visualization
+#include "spectrum.h"           //energy spectrum and enstrophy
+#include "history.h"            //velocity fields of the last steps
+#include "ftle.h"               //finite-time Lyapunov exponent
+#include "critical.h"           //critical points of the velocity
+#include "stats.h"              //statistics and automatic ranges of the displayed scalars
+#include "camera.h"             //zoom and pan
+#include "glyphs.h"             //hedgehogs with level of detail
+#include "shm_export.h"         //frames in shared memory for other processes
+#include "server.h"             //frames and commands over a local socket
+#include "snapshot.h"           //compressed recording of the fields
+#include "checkpoint.h"         //checkpoint and restart of the solver
+#include "vtk_export.h"         //VTK image data of the fields
+#include "video.h"              //uncompressed video of frames rendered on the CPU
+#include "heightplot.h"         //height plots
+#include "parallel.h"           //OpenMP helpers
 
-/*  Macro for sin & cos in degrees */
 #define PI 3.1415926535898
-#define Cos(th) cos(PI/180*(th))
-#define Sin(th) sin(PI/180*(th))
-
-#define DEF_D 5
 
 //--- SIMULATION PARAMETERS ------------------------------------------------------------------------
 const int DIM = 50;				//size of simulation grid
@@ -23,23 +40,130 @@ fftw_real *vx0, *vy0;           //(vx0,vy0) = velocity field at the previous mom
 fftw_real *fx, *fy;	            //(fx,fy)   = user-controlled simulation forces, steered with the mouse 
 fftw_real *rho, *rho0;			//smoke density at the current (rho) and previous (rho0) moment 
 rfftwnd_plan plan_rc, plan_cr;  //simulation domain discretization
+int frame_number = 0;           //number of simulation steps done so far
+int spectral_fields = 0;        //derived fields computed by solve(), see fluids.h
+fftw_real *vorticity, *stream, *divergence;   //the derived fields
+fftw_real *spectra;             //Fourier coefficients of the requested derived fields, one after the other
+fftw_real spectral_max[3];      //largest absolute value of each derived field in the last step
+int spectral_slot[3];           //position of vorticity, stream function and divergence in 'spectra', or -1
+energy_spectrum spectrum;       //energy spectrum and enstrophy, computed by solve() when requested
+shm_export exporter;            //publishes vx, vy and rho of every step in shared memory, when open
+frame_server server;            //serves the steps to local clients and takes their commands, when open
+int headless = 0;               //run without a window: for the clients of the frame server, or for -steps
+int max_steps = 0;              //without a window: steps to run before quitting, or 0 to run until told to quit
+snapshot_recorder recorder;     //records vx, vy, fx, fy and rho of every step in a compressed file, when open
+const char *record_path = "smoke.snap";         //file of the recorder
+double record_tolerance[SNAPSHOT_FIELDS];       //largest error of each recorded field
+checkpoint_writer checkpointer; //writes the checkpoints in the background, when started
+const char *checkpoint_path = "smoke.ckpt";     //file of the checkpoints
+int checkpoint_every = 0;       //steps between checkpoints, or 0 for checkpoints on request only
+vtk_export vtk;                 //writes density, velocity and force as VTK image data every few steps, when open
+const char *vtk_prefix = "smoke";               //<prefix>_<step>.vti and <prefix>.pvd
+int vtk_every = 10;             //steps between exported steps
+video_output video;             //streams the smoke, rendered on the CPU, as video, when open
+const char *video_path = "smoke.y4m";           //file or "|command"; ending in .rgb or .raw: raw RGB, else YUV4MPEG2
+int video_width = 512, video_height = 512;      //size of the frames
+int video_every = 1;            //steps between frames
 
 
 //--- VISUALIZATION PARAMETERS ---------------------------------------------------------------------
 int vector_dim_x = 50;			//Size of vector grid
 int vector_dim_y = 50;			//Size of vector grid
-int   winWidth, winHeight;      //size of the graphics window, in pixels
+int   screenWidth, screenHeight;    //size of the graphics window, in pixels
+int   winWidth, winHeight;      //size of a view, in pixels: the window is split into npanels views
 int   vector_type = 0;			//Vector type: velocity, force field (0, 1)
 int   scalar_type = 0;			//Scalar type: velocity, density, force magnitude (0, 1, 2)
 int   color_dir = 0;            //use direction color-coding or not
 float vec_scale = 1000;			//scaling of hedgehogs
 int   draw_smoke = 0;           //draw the smoke or not
+int   smoke_field = 0;          //field drawn as smoke: density, vorticity, stream function, divergence (0, 2, 3, 4)
 int   draw_vecs = 1;            //draw the vector field or not
 const int COLOR_BLACKWHITE=0;   //different types of color mapping: black-and-white, rainbow, banded
 const int COLOR_RAINBOW=1;
 const int COLOR_BANDS=2;
 int   scalar_col = 0;           //method for scalar coloring
 int   frozen = 0;               //toggles on/off the animation
+int   draw_isolines = 0;        //draw isolines or not
+int   iso_field = 0;            //field the isolines are drawn for: see scalar_field()
+int   iso_count = 8;            //number of iso-values, spread evenly over the range of the field
+iso_extractor isolines[5];      //isoline segments of the last frame, per scalar field
+fftw_real *vmag;                //velocity magnitude, computed when a visualization needs it
+int   vmag_frame = -1;          //simulation step vmag was computed for
+int   draw_streamlines = 0;     //draw streamlines or not
+int   draw_particles = 0;       //draw advected particles or not
+int   streamlines_frame = -1;   //simulation step the streamlines were traced for
+tracer flow_tracer;             //streamlines and particles of the velocity field
+int   draw_lic = 0;             //draw the LIC texture of the velocity field or not
+int   lic_frame = -1;           //simulation step the LIC texture was computed for
+lic_image lic;                  //LIC texture of the velocity field, at window resolution
+int   draw_ibfv = 0;            //draw the IBFV texture of the velocity field or not
+int   ibfv_frame = -1;          //simulation step the IBFV texture was advected to
+ibfv_image ibfv;                //IBFV texture of the velocity field
+int   draw_spectrum = 0;        //draw the energy spectrum plot or not
+velocity_history history;       //velocity fields of the last steps, for the visualizations that integrate in time
+int   history_compact = 0;      //keep the history in 16-bit fixed point or not
+int   draw_pathlines = 0;       //draw pathlines or not
+int   pathlines_frame = -1;     //simulation step the pathlines were traced for
+int   draw_streaklines = 0;     //draw streaklines or not
+int   draw_critical = 0;        //draw the critical points of the velocity or not
+critical_set critical;          //critical points of the velocity field of the last frame
+int   autoscale = 0;            //set the colour ranges and the hedgehog scaling automatically or not
+auto_range smoke_range[5];      //range of each smoke field, from its 2nd to 98th percentile
+auto_range ftle_range;          //range of the FTLE field, from 0 to its 98th percentile
+auto_range glyph_range[2];      //range of the hedgehog lengths of velocity and force, up to their 95th percentile
+camera view;                    //zoom and pan of the views, which are linked
+int   glyph_lod = 1;            //draw the hedgehogs with level of detail or not
+float *smoke_vertices;          //vertex arrays of the smoke: a position per grid point, a colour per grid point
+unsigned int *smoke_triangles;  //and field (see smoke_cache), and two triangles per cell
+fftw_real smoke_wn, smoke_hn;   //cell size smoke_vertices were computed for
+int   draw_height = 0;          //draw the height plot instead of the smoke or not
+int   height_field = 0;         //field of the height plot: density, velocity magnitude (0, 1)
+float height_tilt = 45;         //tilt of the views with a height plot about their horizontal axis, in degrees
+float height_scale = 0.25f;     //height of the top of the colour range, as a part of the height of the view
+
+//The views share the simulation and everything derived from one of its steps. Data that depends on the settings of
+//a view as well is cached with those settings, so views with the same settings compute it once per step.
+typedef struct
+{
+	unsigned char *colors;      //colour of every grid point, valid in rows j0..j1 and columns i0..i1
+	int frame, colormap, autoscale, i0, i1, j0, j1;
+	fftw_real offset, scale;    //colour mapping of the values (unless autoscale is on)
+} smoke_cache;
+
+typedef struct
+{
+	glyph_set glyphs;
+	int frame, method, nx, ny, lod, autoscale;
+	float scale;
+	camera view;
+} glyph_cache;
+
+typedef struct
+{
+	height_surface surface;
+	int frame, colormap, height;
+} height_cache;
+
+smoke_cache smoke_colors[5];    //smoke colours per scalar field
+glyph_cache hedgehogs[2];       //hedgehogs of the velocity and the force
+height_cache height_plots[2];   //height plots of the density and the velocity magnitude
+
+//panel: The settings of a view. The settings of the active view are held in the globals above, where the
+//       visualization code and the keys use them; the other views are drawn by loading theirs.
+typedef struct
+{
+	int draw_smoke, smoke_field, draw_vecs, vector_type, scalar_type, scalar_col;
+	int draw_isolines, iso_field, draw_streamlines, draw_particles, draw_lic, draw_ibfv;
+	int draw_spectrum, draw_pathlines, draw_streaklines, draw_critical, draw_ftle;
+	int draw_height, height_field;
+} panel;
+
+#define MAX_PANELS 4
+panel panels[MAX_PANELS];
+int   npanels = 1;              //number of views: 1, 2 (side by side) or 4 (2 x 2)
+int   active_panel = 0;         //view the keys act on
+int   draw_ftle = 0;            //draw the FTLE field or not
+ftle_engine ftle;               //FTLE of the flow over the last steps
 
 
 
@@ -62,8 +186,14 @@ void init_simulation(int n)
 	fy      = (fftw_real*) malloc(dim);
 	rho     = (fftw_real*) malloc(dim); 
 	rho0    = (fftw_real*) malloc(dim);
+	vmag    = (fftw_real*) malloc(dim);
+	vorticity  = (fftw_real*) calloc(n * n, sizeof(fftw_real));
+	stream     = (fftw_real*) calloc(n * n, sizeof(fftw_real));
+	divergence = (fftw_real*) calloc(n * n, sizeof(fftw_real));
+	spectra    = (fftw_real*) malloc(3 * n * 2*(n/2+1) * sizeof(fftw_real));
 	plan_rc = rfftw2d_create_plan(n, n, FFTW_REAL_TO_COMPLEX, FFTW_IN_PLACE);
 	plan_cr = rfftw2d_create_plan(n, n, FFTW_COMPLEX_TO_REAL, FFTW_IN_PLACE);
+	spectrum_init(&spectrum, n);
 	
 	for (i = 0; i < n * n; i++)                      //Initialize data structures to 0
 	{ vx[i] = vy[i] = vx0[i] = vy0[i] = fx[i] = fy[i] = rho[i] = rho0[i] = 0.0f; }
@@ -108,28 +238,69 @@ int rotational_increment(int x, int max)
 }
 
 
-double BilinearInterpolation(double q11, double q12, double q21, double q22, double x1, double x2, double y1, double y2, double x, double y) //https://helloacm.com/cc-function-to-compute-the-bilinear-interpolation/
+//spectral_mode: Compute the Fourier coefficients of the requested derived fields for the mode (kx,ky), at index 'k'
+//               of each field in 'spectra', from the velocity before (U,V) and after (U1,V1) the projection.
+//               A derivative d/dx is a multiplication by 2*pi*i*kx.
+void spectral_mode(int n, int k, fftw_real kx, fftw_real ky, const fftw_real U[2], const fftw_real V[2],
+                   const fftw_real U1[2], const fftw_real V1[2])
 {
-	double x2x1, y2y1, x2x, y2y, yy1, xx1;
-	x2x1 = x2 - x1;
-	y2y1 = y2 - y1;
-	x2x = x2 - x;
-	y2y = y2 - y;
-	yy1 = y - y1;
-	xx1 = x - x1;
-	return 1.0 / (x2x1 * y2y1) * (
-		q11 * x2x * y2y +
-		q21 * xx1 * y2y +
-		q12 * x2x * yy1 +
-		q22 * xx1 * yy1
-		);
+	const fftw_real tp = 2 * PI;
+	fftw_real *w;
+	fftw_real re, im;
+	int m = n * (n + 2);
+
+	re = kx * V1[0] - ky * U1[0];                     //vorticity: 2*pi*i*(kx*V - ky*U)
+	im = kx * V1[1] - ky * U1[1];
+	if (spectral_slot[0] >= 0)
+	{ w = spectra + spectral_slot[0] * m + k; w[0] = -tp * im; w[1] = tp * re; }
+	if (spectral_slot[1] >= 0)                        //stream function: vorticity / (2*pi*|k|)^2
+	{
+		fftw_real g = 1 / (tp * (kx * kx + ky * ky));
+		w = spectra + spectral_slot[1] * m + k; w[0] = -g * im; w[1] = g * re;
+	}
+	if (spectral_slot[2] >= 0)                        //divergence: 2*pi*i*(kx*U + ky*V), before the projection
+	{
+		re = kx * U[0] + ky * V[0];
+		im = kx * U[1] + ky * V[1];
+		w = spectra + spectral_slot[2] * m + k; w[0] = -tp * im; w[1] = tp * re;
+	}
+}
+
+//spectral_unpack: Inverse transform all requested derived fields at once (one batched transform of the 'count'
+//                 fields in 'spectra') and copy them, normalized, to their n x n arrays
+void spectral_unpack(int n, int count)
+{
+	fftw_real *fields[3];
+	fftw_real f = 1.0/(n*n);
+	int i, j, k, m = n * (n + 2);
+
+	rfftwnd_complex_to_real(plan_cr, count, (fftw_complex*) spectra, 1, m / 2, spectra, 1, m);
+
+	fields[0] = vorticity; fields[1] = stream; fields[2] = divergence;
+	for (k = 0; k < 3; k++)
+	{
+		const fftw_real *w = spectra + spectral_slot[k] * m;
+		if (spectral_slot[k] < 0) continue;
+		spectral_max[k] = 0;
+		for (i = 0; i < n; i++)
+			for (j = 0; j < n; j++)
+			{
+				fields[k][i+n*j] = f * w[i+(n+2)*j];
+				if (fabs(fields[k][i+n*j]) > spectral_max[k]) spectral_max[k] = fabs(fields[k][i+n*j]);
+			}
+	}
 }
 
 //solve: Solve (compute) one step of the fluid flow simulation
 void solve(int n, fftw_real* vx, fftw_real* vy, fftw_real* vx0, fftw_real* vy0, fftw_real visc, fftw_real dt) 
 {
 	fftw_real x, y, x0, y0, f, r, U[2], V[2], s, t;
-	int i, j, i0, j0, i1, j1;
+	int i, j, i0, j0, i1, j1, k, nspectral = 0, energy = spectral_fields & SPECTRAL_ENERGY;
+
+	for (k = 0; k < 3; k++)                           //slots of the derived fields requested for this step
+		spectral_slot[k] = (spectral_fields & (1 << k)) ? nspectral++ : -1;
+	for (k = 0; k < nspectral; k++)                   //the mean (mode 0) of every derived field is 0
+		spectra[k * n * (n + 2)] = spectra[k * n * (n + 2) + 1] = 0;
 
 	for (i=0;i<n*n;i++) 
 	{ vx[i] += dt*vx0[i]; vx0[i] = vx[i]; vy[i] += dt*vy0[i]; vy0[i] = vy[i]; }    
@@ -137,14 +308,10 @@ void solve(int n, fftw_real* vx, fftw_real* vy, fftw_real* vx0, fftw_real* vy0,
 	for ( x=0.5f/n,i=0 ; i<n ; i++,x+=1.0f/n ) 
 	   for ( y=0.5f/n,j=0 ; j<n ; j++,y+=1.0f/n ) 
 	   {
-	      x0 = n*(x-dt*vx0[i+n*j])-0.5f; 
-	      y0 = n*(y-dt*vy0[i+n*j])-0.5f;
-	      i0 = clamp(x0); s = x0-i0;
-	      i0 = (n+(i0%n))%n;
-	      i1 = (i0+1)%n;
-	      j0 = clamp(y0); t = y0-j0;
-	      j0 = (n+(j0%n))%n;
-	      j1 = (j0+1)%n;
+	      x0 = backtrace(n, x, vx0[i+n*j], dt);
+	      y0 = backtrace(n, y, vy0[i+n*j], dt);
+	      wrap(n, x0, &i0, &i1, &s);
+	      wrap(n, y0, &j0, &j1, &t);
 	      vx[i+n*j] = (1-s)*((1-t)*vx0[i0+n*j0]+t*vx0[i0+n*j1])+s*((1-t)*vx0[i1+n*j0]+t*vx0[i1+n*j1]);
 	      vy[i+n*j] = (1-s)*((1-t)*vy0[i0+n*j0]+t*vy0[i0+n*j1])+s*((1-t)*vy0[i1+n*j0]+t*vy0[i1+n*j1]);
 	   }     
@@ -156,8 +323,13 @@ void solve(int n, fftw_real* vx, fftw_real* vy, fftw_real* vx0, fftw_real* vy0,
 	FFT(1,vx0);
 	FFT(1,vy0);
 
+	if (energy)
+	   spectrum_begin(&spectrum);
+
+#pragma omp parallel for private(j, x, y, r, f, U, V)
 	for (i=0;i<=n;i+=2) 
 	{
+	   double *bins = energy ? spectrum_bins(&spectrum, omp_get_thread_num()) : 0;
 	   x = 0.5f*i;
 	   for (j=0;j<n;j++) 
 	   {
@@ -172,11 +344,21 @@ void solve(int n, fftw_real* vx, fftw_real* vy, fftw_real* vx0, fftw_real* vy0,
 	      vx0[i+1+(n+2)*j] = f*((1-x*x/r)*U[1]     -x*y/r *V[1]);
 	      vy0[i+  (n+2)*j] = f*(  -y*x/r *U[0] + (1-y*y/r)*V[0]);
 	      vy0[i+1+(n+2)*j] = f*(  -y*x/r *U[1] + (1-y*y/r)*V[1]);
+
+	      if (nspectral)
+	         spectral_mode(n, i+(n+2)*j, x, y, U, V, vx0+i+(n+2)*j, vy0+i+(n+2)*j);
+	      if (energy)
+	         spectrum_add(&spectrum, bins, i+(n+2)*j, r, vx0+i+(n+2)*j, vy0+i+(n+2)*j);
 	   }
 	}
 
+	if (energy)
+	   spectrum_end(&spectrum, frame_number);
+
 	FFT(-1,vx0); 
 	FFT(-1,vy0);
+	if (nspectral)
+	   spectral_unpack(n, nspectral);
 
 	f = 1.0/(n*n);
  	for (i=0;i<n;i++)
@@ -195,16 +377,10 @@ void diffuse_matter(int n, fftw_real *vx, fftw_real *vy, fftw_real *rho, fftw_re
 	for ( x=0.5f/n,i=0 ; i<n ; i++,x+=1.0f/n )
 		for ( y=0.5f/n,j=0 ; j<n ; j++,y+=1.0f/n ) 
 		{
-			x0 = n*(x-dt*vx[i+n*j])-0.5f; 
-			y0 = n*(y-dt*vy[i+n*j])-0.5f;
-			i0 = clamp(x0);
-			s = x0-i0;
-			i0 = (n+(i0%n))%n;
-			i1 = (i0+1)%n;
-			j0 = clamp(y0);
-			t = y0-j0;
-			j0 = (n+(j0%n))%n;
-			j1 = (j0+1)%n;
+			x0 = backtrace(n, x, vx[i+n*j], dt);
+			y0 = backtrace(n, y, vy[i+n*j], dt);
+			wrap(n, x0, &i0, &i1, &s);
+			wrap(n, y0, &j0, &j1, &t);
 			rho[i+n*j] = (1-s)*((1-t)*rho0[i0+n*j0]+t*rho0[i0+n*j1])+s*((1-t)*rho0[i1+n*j0]+t*rho0[i1+n*j1]);
 		}    
 }
@@ -225,6 +401,147 @@ void set_forces(void)
 }
 
 
+void velocity_magnitude(int n);
+
+//scalar_field: The scalar field with number 'which': density, velocity magnitude, vorticity, stream function,
+//              divergence (0..4). The velocity magnitude is computed on request; the derived fields are only
+//              up to date if they were requested from solve() (see spectral_flag).
+fftw_real *scalar_field(int which)
+{
+	switch (which)
+	{
+	  case 1: if (vmag_frame != frame_number) { velocity_magnitude(DIM); vmag_frame = frame_number; }
+	          return vmag;
+	  case 2: return vorticity;
+	  case 3: return stream;
+	  case 4: return divergence;
+	  default: return rho;
+	}
+}
+
+//spectral_flag: The flag solve() needs in 'spectral_fields' to compute scalar field 'which', or 0
+int spectral_flag(int which)
+{
+	return (which >= 2) ? 1 << (which - 2) : 0;
+}
+
+//record_stop: close the recording, and tell how much it saved
+void record_stop(void)
+{
+	if (!recorder.file) return;
+	printf("Recorded %d steps in %s: %.1f MB, %.1f times smaller than the raw fields\n", recorder.frames, record_path,
+	       recorder.written / 1048576, recorder.written > 0 ? recorder.raw / recorder.written : 0);
+	snapshot_record_close(&recorder);
+}
+
+//record_step: append the fields of the step just done to the recording
+void record_step(void)
+{
+	const fftw_real *fields[SNAPSHOT_FIELDS];
+
+	fields[SNAPSHOT_VX] = vx; fields[SNAPSHOT_VY] = vy;
+	fields[SNAPSHOT_FX] = fx; fields[SNAPSHOT_FY] = fy;
+	fields[SNAPSHOT_RHO] = rho;
+	if (snapshot_record(&recorder, frame_number, dt, fields) != 0)
+	{
+		printf("Cannot write %s: recording stopped\n", record_path);
+		record_stop();
+	}
+}
+
+//solver_state: the arrays and parameters of the solver, for a checkpoint or a restart
+void solver_state(checkpoint_state *s)
+{
+	size_t padded = DIM * 2*(DIM/2+1), plain = DIM * DIM;
+
+	s->n = DIM; s->frame = frame_number; s->dt = dt; s->visc = visc;
+	s->fields[CHECKPOINT_VX] = vx;   s->fields[CHECKPOINT_VY] = vy;
+	s->fields[CHECKPOINT_VX0] = vx0; s->fields[CHECKPOINT_VY0] = vy0;
+	s->fields[CHECKPOINT_FX] = fx;   s->fields[CHECKPOINT_FY] = fy;
+	s->fields[CHECKPOINT_RHO] = rho; s->fields[CHECKPOINT_RHO0] = rho0;
+	s->count[CHECKPOINT_VX] = s->count[CHECKPOINT_VY] = s->count[CHECKPOINT_VX0] = s->count[CHECKPOINT_VY0] = padded;
+	s->count[CHECKPOINT_FX] = s->count[CHECKPOINT_FY] = s->count[CHECKPOINT_RHO] = s->count[CHECKPOINT_RHO0] = plain;
+}
+
+//checkpoint: hand the state of the solver to the writer of the checkpoints, starting it when needed
+void checkpoint(void)
+{
+	checkpoint_state s;
+
+	if (!checkpointer.running && checkpoint_start(&checkpointer, checkpoint_path) != 0)
+	{
+		printf("Cannot start writing checkpoints\n");
+		return;
+	}
+	solver_state(&s);
+	if (checkpoint_save(&checkpointer, &s) == 1 && checkpoint_every == 0)
+		printf("The previous checkpoint is still being written\n");
+}
+
+//restart: continue from the checkpoint 'path'
+int restart(const char *path)
+{
+	checkpoint_state s;
+
+	solver_state(&s);
+	if (checkpoint_load(path, &s) != 0)
+		return -1;
+	frame_number = s.frame; dt = s.dt; visc = (float)s.visc;
+	printf("Restarted at step %d from %s\n", frame_number, path);
+	return 0;
+}
+
+//vtk_start: start exporting the fields as VTK image data
+void vtk_start(void)
+{
+	if (vtk_export_open(&vtk, vtk_prefix, DIM, vtk_every, VTK_DENSITY | VTK_VELOCITY | VTK_FORCE) == 0)
+		printf("Exporting every %d steps to %s.pvd\n", vtk_every, vtk_prefix);
+}
+
+//vtk_stop: write the exported steps still pending, and stop exporting
+void vtk_stop(void)
+{
+	if (!vtk.running) return;
+	printf("Exported %d steps to %s.pvd", vtk.written + vtk.count, vtk_prefix);
+	if (vtk.stalls) printf(", waiting for the disk %d times", vtk.stalls);
+	printf("\n");
+	vtk_export_close(&vtk);
+}
+
+//video_start: start streaming the smoke as video
+void video_start(void)
+{
+	size_t length = strlen(video_path);
+	int raw = length > 4 && (strcmp(video_path + length - 4, ".rgb") == 0 || strcmp(video_path + length - 4, ".raw") == 0);
+
+	if (video_open(&video, video_path, raw ? VIDEO_RGB : VIDEO_Y4M, video_width, video_height, 30) == 0)
+		fprintf(stderr, "Streaming %dx%d %s video to %s\n", video.width, video.height, raw ? "RGB" : "YUV4MPEG2", video_path);
+}
+
+//video_stop: write the frames still queued, and close the video
+void video_stop(void)
+{
+	if (!video.running) return;
+	fprintf(stderr, "Wrote %d frames to %s", video.written + video.count, video_path);
+	if (video.stalls) fprintf(stderr, ", waiting for the output %d times", video.stalls);
+	fprintf(stderr, "\n");
+	video_close(&video);
+}
+
+//finish_outputs: complete and close everything that is being written
+void finish_outputs(void)
+{
+	server_close(&server);              //drops the clients and removes the socket file
+	shm_export_close(&exporter);
+	record_stop();
+	checkpoint_stop(&checkpointer);
+	vtk_stop();
+	video_stop();
+}
+
+void render_frame(unsigned char *frame, int width, int height);
+void remote_command(const char *command);
+
 //do_one_simulation_step: Do one complete cycle of the simulation:
 //      - set_forces:       
 //      - solve:            read forces from the user
@@ -232,12 +549,46 @@ void set_forces(void)
 //      - gluPostRedisplay: draw a new visualization frame
 void do_one_simulation_step(void) 
 {
+	int p, particles = 0, streaklines = 0;
+
+	server_poll(&server, 0, remote_command);
 	if (!frozen)
 	{
+	  spectral_fields = 0;                    //what any of the views needs
+	  for (p = 0; p < npanels; p++)
+	  {
+		  const panel *v = panels + p;
+		  spectral_fields |= (v->draw_smoke ? spectral_flag(v->smoke_field) : 0) | (v->draw_isolines ? spectral_flag(v->iso_field) : 0)
+		                   | (v->draw_spectrum ? SPECTRAL_ENERGY : 0);
+		  if (video.running && p == active_panel)
+			  spectral_fields |= spectral_flag(v->smoke_field);
+		  particles |= v->draw_particles;
+		  streaklines |= v->draw_streaklines;
+	  }
 	  set_forces();
 	  solve(DIM, vx, vy, vx0, vy0, visc, dt);
 	  diffuse_matter(DIM, vx, vy, rho, rho0, dt);
-	  glutPostRedisplay();
+	  if (particles)
+		  tracer_advect_particles(&flow_tracer, DIM, vx, vy, dt);
+	  history_push(&history, vx, vy, dt);
+	  if (streaklines)
+		  tracer_advect_streaks(&flow_tracer, &history);
+	  frame_number++;
+	  shm_export_publish(&exporter, frame_number, dt, vx, vy, rho);
+	  server_publish(&server, frame_number, DIM, vx, vy, rho);
+	  if (recorder.file)
+		  record_step();
+	  if (checkpoint_every && frame_number % checkpoint_every == 0)
+		  checkpoint();
+	  if (vtk.running)
+		  vtk_export_step(&vtk, frame_number, dt, vx, vy, fx, fy, rho);
+	  if (video.running && frame_number % video_every == 0)
+	  {
+		  render_frame(video_frame(&video), video.width, video.height);
+		  video_submit(&video);
+	  }
+	  if (!headless)
+		  glutPostRedisplay();
 	}
 }
 
@@ -256,28 +607,34 @@ void rainbow(float value,float* R,float* G,float* B)
    *B = max(0.0,(3-fabs(value-1)-fabs(value-2))/2);
 }
 
-//set_colormap: Sets three different types of colormaps
-void set_colormap(float vy)
+//colormap: Maps the scalar 'vy' to a colour RGB with the selected colormap
+void colormap(float vy, float *R, float *G, float *B)
 {
-   float R,G,B; 
-
    if (scalar_col==COLOR_BLACKWHITE)
-       R = G = B = vy;
+       *R = *G = *B = (vy < 0) ? 0 : (vy > 1) ? 1 : vy;
    else if (scalar_col==COLOR_RAINBOW)
-       rainbow(vy,&R,&G,&B); 
+       rainbow(vy,R,G,B); 
    else if (scalar_col==COLOR_BANDS)
        {  
           const int NLEVELS = 7;
           vy *= NLEVELS; vy = (int)(vy); vy/= NLEVELS; 
-	      rainbow(vy,&R,&G,&B);   
+	      rainbow(vy,R,G,B);   
 	   }
-   
+}
+
+//set_colormap: Sets three different types of colormaps
+void set_colormap(float vy)
+{
+   float R,G,B; 
+   colormap(vy,&R,&G,&B);
    glColor3f(R,G,B);
 }
 
-void scalar_to_color(float x, float y, int method)
+//vector_color: Maps the vector (x,y) to a colour RGB with colouring method 'method': white, by direction, or by
+//              the density
+void vector_color(float x, float y, int method, float *R, float *G, float *B)
 {
-	float r, g, b, f;
+	float r = 1, g = 1, b = 1, f;
 	if (method == 0) {
 		r = g = b = 1;
 	}
@@ -301,156 +658,438 @@ void scalar_to_color(float x, float y, int method)
 		g = 0;
 		b = 0;
 	}
-	glColor3f(r, g, b);
+	*R = r; *G = g; *B = b;
 }
 
-//visualize: This is the main visualization function
-void visualize(void)
+//colormap_palette: The colour map sampled at 256 values from 0 to 1, as RGBA
+void colormap_palette(unsigned char palette[256][4])
 {
-	int        i, j;
-	int idx;
-	fftw_real  wn = (fftw_real)winWidth / (fftw_real)(vector_dim_x + 1);   // Grid cell width
-	fftw_real  hn = (fftw_real)winHeight / (fftw_real)(vector_dim_y + 1);  // Grid cell heigh
+	float R, G, B;
+	int i;
 
-	if (draw_smoke)
-	{	
-		int idx0, idx1, idx2, idx3;
-		double px0, py0, px1, py1, px2, py2, px3, py3;
-		glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
-		glBegin(GL_TRIANGLES);
-		for (j = 0; j < DIM - 1; j++)            //draw smoke
-		{
-			for (i = 0; i < DIM - 1; i++)
-			{
-				px0 = wn + (fftw_real)i * wn;
-				py0 = hn + (fftw_real)j * hn;
-				idx0 = (j * DIM) + i;
+	for (i = 0; i < 256; i++)
+	{
+		colormap(i / 255.0f, &R, &G, &B);
+		palette[i][0] = (unsigned char)(255 * R); palette[i][1] = (unsigned char)(255 * G);
+		palette[i][2] = (unsigned char)(255 * B); palette[i][3] = 255;
+	}
+}
 
+//render_frame: Render the smoke of the active view on the CPU into the width x height RGBX 'frame', top row first:
+//              the whole periodic domain, sampled bilinearly, with the colour map of the view
+void render_frame(unsigned char *frame, int width, int height)
+{
+	const fftw_real *smoke = scalar_field(smoke_field);
+	fftw_real scale = 1, offset = 0;
+	unsigned char palette[256][4];
+	int i, j;
 
-				px1 = wn + (fftw_real)i * wn;
-				py1 = hn + (fftw_real)(j + 1) * hn;
-				idx1 = ((j + 1) * DIM) + i;
+	if (smoke_field >= 2)                           //as in visualize: [-max,max] to [0,1]
+	{
+		scale = (spectral_max[smoke_field - 2] > 0) ? 0.5 / spectral_max[smoke_field - 2] : 0;
+		offset = 0.5;
+	}
+	colormap_palette(palette);
+#pragma omp parallel for private(i)
+	for (j = 0; j < height; j++)
+	{
+		unsigned char *row = frame + 4 * (size_t)width * (height - 1 - j);
+		fftw_real y = (j + 0.5f) * DIM / height - 0.5f;
+		for (i = 0; i < width; i++)
+		{
+			fftw_real value = offset + scale * sample_field(smoke, DIM, (i + 0.5f) * DIM / width - 0.5f, y);
+			int c = (value <= 0) ? 0 : (value >= 1) ? 255 : (int)(255 * value + 0.5f);
+			memcpy(row + 4 * i, palette[c], 4);
+		}
+	}
+}
 
+//velocity_magnitude: Compute |(vx,vy)| into 'vmag'
+void velocity_magnitude(int n)
+{
+	int i;
+#pragma omp parallel for
+	for (i = 0; i < n * n; i++)
+		vmag[i] = sqrt(vx[i] * vx[i] + vy[i] * vy[i]);
+}
 
-				px2 = wn + (fftw_real)(i + 1) * wn;
-				py2 = hn + (fftw_real)(j + 1) * hn;
-				idx2 = ((j + 1) * DIM) + (i + 1);
+//draw_isolines_of_field: Extract and draw the isolines of the selected field. The iso-values are spread over
+//                        the range the field had in the previous sweep, which the extractor computes anyway.
+void draw_isolines_of_field(fftw_real wn, fftw_real hn)
+{
+	static float lo[5], hi[5];
+	static int count[5];
+	iso_extractor *e = isolines + iso_field;            //one per field, so views of different fields share nothing
+	fftw_real *field = scalar_field(iso_field);
 
+	if (e->field_min != lo[iso_field] || e->field_max != hi[iso_field] || iso_count != count[iso_field])
+	{
+		lo[iso_field] = e->field_min; hi[iso_field] = e->field_max; count[iso_field] = iso_count;
+		iso_set_range(e, lo[iso_field], hi[iso_field], iso_count);
+	}
+	iso_extract(e, DIM, field, frame_number);
+	iso_draw(e, wn, hn);
+}
 
-				px3 = wn + (fftw_real)(i + 1) * wn;
-				py3 = hn + (fftw_real)j * hn;
-				idx3 = (j * DIM) + (i + 1);
+//draw_ftle_field: Bring the FTLE field up to date with the history and draw it with the colormap, scaled to its maximum.
+//                 FTLE grid point p lies at grid coordinate (p+0.5)*DIM/res-0.5, like the images of IBFV.
+void draw_ftle_field(fftw_real wn, fftw_real hn)
+{
+	int res = ftle.res, i, j;
+	float g = (float)DIM / res, scale;
 
+	ftle_update(&ftle, &history);
+	if (!ftle.valid) return;
+	scale = (ftle.max > 0) ? 1 / ftle.max : 0;
+	if (autoscale)
+	{
+		if (ftle_range.hi > 1e-6f)                  //ftle_range.lo stays 0: the FTLE is not negative here, up to
+			scale = 1 / ftle_range.hi;              //rounding; a degenerate range keeps the scale of ftle.max
+		range_begin(&ftle_range);
+	}
 
-				set_colormap(rho[idx0]);    glVertex2f(px0, py0);
-				set_colormap(rho[idx1]);    glVertex2f(px1, py1);
-				set_colormap(rho[idx2]);    glVertex2f(px2, py2);
+	glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+	for (j = 0; j < res - 1; j++)
+	{
+		glBegin(GL_QUAD_STRIP);
+		for (i = 0; i < res; i++)
+		{
+			float x = wn + ((i + 0.5f) * g - 0.5f) * wn;
+			if (autoscale)
+				range_add(&ftle_range, range_stats(&ftle_range, 0), ftle.field[i + res * j]);
+			set_colormap(scale * ftle.field[i + res * j]);
+			glVertex2f(x, hn + ((j + 0.5f) * g - 0.5f) * hn);
+			set_colormap(scale * ftle.field[i + res * (j + 1)]);
+			glVertex2f(x, hn + ((j + 1.5f) * g - 0.5f) * hn);
+		}
+		glEnd();
+	}
+	if (autoscale)
+	{
+		range_end(&ftle_range);
+		ftle_range.lo = 0;
+	}
+}
 
+//draw_smoke_field: Draw scalar field 'field' (see scalar_field) as smoke, with colour offset + scale * value, or with
+//                  the range of smoke_range[field] if autoscale is on. The colours of the grid points are computed in
+//                  parallel, in the pass that also collects the statistics of the field for the range of the next
+//                  frame, and the grid is then drawn from vertex arrays. Only the grid points in the visible part of
+//                  the view are coloured (and counted in the statistics), and only the cells between them are drawn.
+//                  The colours are kept per field, so other views of the same step reuse them.
+void draw_smoke_field(int field, fftw_real wn, fftw_real hn, fftw_real offset, fftw_real scale)
+{
+	smoke_cache *c = smoke_colors + field;
+	auto_range *range = smoke_range + field;
+	int i, j, i0, i1, j0, j1;
+	float x0, y0, x1, y1;
 
-				set_colormap(rho[idx0]);    glVertex2f(px0, py0);
-				set_colormap(rho[idx2]);    glVertex2f(px2, py2);
-				set_colormap(rho[idx3]);    glVertex2f(px3, py3);
+	if (!smoke_triangles)                           //the triangles never change
+	{
+		smoke_vertices  = (float*) malloc(2 * DIM * DIM * sizeof(float));
+		smoke_triangles = (unsigned int*) malloc(6 * (DIM - 1) * (DIM - 1) * sizeof(unsigned int));
+		for (j = 0; j < DIM - 1; j++)
+			for (i = 0; i < DIM - 1; i++)
+			{
+				unsigned int *t = smoke_triangles + 6 * (j * (DIM - 1) + i), idx0 = j * DIM + i;
+				t[0] = idx0; t[1] = idx0 + DIM; t[2] = idx0 + DIM + 1;
+				t[3] = idx0; t[4] = idx0 + DIM + 1; t[5] = idx0 + 1;
 			}
+	}
+	if (wn != smoke_wn || hn != smoke_hn)           //the positions only change with the size of the view
+	{
+		for (j = 0; j < DIM; j++)
+			for (i = 0; i < DIM; i++)
+			{
+				smoke_vertices[2 * (j * DIM + i)] = wn + (fftw_real)i * wn;
+				smoke_vertices[2 * (j * DIM + i) + 1] = hn + (fftw_real)j * hn;
+			}
+		smoke_wn = wn; smoke_hn = hn;
+	}
+	if (!c->colors)
+	{
+		c->colors = (unsigned char*) malloc(3 * DIM * DIM);
+		c->frame = -1;
+	}
+	camera_visible(&view, &x0, &y0, &x1, &y1);          //grid points i0..i1 and j0..j1 cover the view
+	i0 = clamp(x0 / wn - 1); i1 = clamp(x1 / wn - 1) + 1;
+	j0 = clamp(y0 / hn - 1); j1 = clamp(y1 / hn - 1) + 1;
+	if (i0 < 0) i0 = 0; if (i1 > DIM - 1) i1 = DIM - 1;
+	if (j0 < 0) j0 = 0; if (j1 > DIM - 1) j1 = DIM - 1;
+
+	if (c->frame != frame_number || c->colormap != scalar_col || c->autoscale != autoscale
+	    || (!autoscale && (c->offset != offset || c->scale != scale))     //else the range of the step is used
+	    || c->i0 != i0 || c->i1 != i1 || c->j0 != j0 || c->j1 != j1)
+	{
+		const fftw_real *smoke = scalar_field(field);
+		unsigned char *colors = c->colors;
+
+		if (autoscale)
+		{
+			scale = 1 / (range->hi - range->lo);
+			offset = -range->lo * scale;
+			range_begin(range);
 		}
-		glEnd();
+#pragma omp parallel for private(i)
+		for (j = j0; j <= j1; j++)
+		{
+			field_stats *stats = autoscale ? range_stats(range, omp_get_thread_num()) : 0;
+			for (i = i0; i <= i1; i++)
+			{
+				int idx = j * DIM + i;
+				float R, G, B;
+				if (autoscale) range_add(range, stats, smoke[idx]);
+				colormap(offset + scale * smoke[idx], &R, &G, &B);
+				colors[3 * idx] = (unsigned char)(255 * R);
+				colors[3 * idx + 1] = (unsigned char)(255 * G);
+				colors[3 * idx + 2] = (unsigned char)(255 * B);
+			}
+		}
+		if (autoscale)
+			range_end(range);
+		c->frame = frame_number; c->colormap = scalar_col; c->autoscale = autoscale;
+		c->offset = offset; c->scale = scale;
+		c->i0 = i0; c->i1 = i1; c->j0 = j0; c->j1 = j1;
 	}
 
-	if (draw_vecs)
+	glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_COLOR_ARRAY);
+	glVertexPointer(2, GL_FLOAT, 0, smoke_vertices);
+	glColorPointer(3, GL_UNSIGNED_BYTE, 0, c->colors);
+	if (i1 > i0)
+		for (j = j0; j < j1; j++)                       //the visible cells of row j are consecutive triangles
+			glDrawElements(GL_TRIANGLES, 6 * (i1 - i0), GL_UNSIGNED_INT, smoke_triangles + 6 * (j * (DIM - 1) + i0));
+	glDisableClientState(GL_COLOR_ARRAY);
+	glDisableClientState(GL_VERTEX_ARRAY);
+}
+
+//draw_height_plot: Draw the height plot of 'height_field', with the colours of the smoke: density as it is, velocity
+//                  magnitude over its largest value in the previous update. The surface is kept per field and brought
+//                  up to date when the step, the colour map or the size of the view changed, so other views of the
+//                  same step reuse it.
+void draw_height_plot(fftw_real wn, fftw_real hn)
+{
+	height_cache *c = height_plots + height_field;
+	unsigned char palette[256][4];
+
+	if (c->frame != frame_number || c->colormap != scalar_col || c->surface.wn != wn || c->surface.hn != hn
+	    || c->height != winHeight)
+	{
+		float scale = (height_field == 0) ? 1 : (c->surface.max > 0) ? 1 / c->surface.max : 0;
+
+		colormap_palette(palette);
+		height_update(&c->surface, DIM, scalar_field(height_field), wn, hn, 0, scale, height_scale * winHeight, palette);
+		if (scale == 0 && c->surface.max > 0)       //the first update of the velocity magnitude: now its scale is known
+			height_update(&c->surface, DIM, scalar_field(height_field), wn, hn, 0, 1 / c->surface.max,
+			              height_scale * winHeight, palette);
+		c->frame = frame_number; c->colormap = scalar_col; c->height = winHeight;
+	}
+	height_draw(&c->surface);
+}
+
+//draw_hedgehogs: Draw the hedgehogs of the velocity (vector_type 0) or the force (1). They are kept per vector type
+//                and rebuilt when the step or the settings they depend on change.
+void draw_hedgehogs(fftw_real wn, fftw_real hn)
+{
+	glyph_cache *c = hedgehogs + vector_type;
+	auto_range *range = glyph_range + vector_type;
+	fftw_real *vvx = (vector_type == 0) ? vx : fx, *vvy = (vector_type == 0) ? vy : fy;
+
+	if (c->frame != frame_number || c->method != scalar_type || c->nx != vector_dim_x || c->ny != vector_dim_y
+	    || c->lod != glyph_lod || c->autoscale != autoscale || (!autoscale && c->scale != vec_scale)
+	    || !camera_equal(&c->view, &view))
+	{
+		if (autoscale)                          //the 95th percentile of the lengths gets about a glyph spacing
+		{
+			if (range->hi > 1e-6f)              //a fluid at rest has no lengths to scale to: keep the last scale
+				vec_scale = 0.9 * ((winWidth * vector_dim_y < winHeight * vector_dim_x) ? (fftw_real)winWidth / vector_dim_x
+				                                                                        : (fftw_real)winHeight / vector_dim_y) / range->hi;
+			range_begin(range);
+		}
+		c->glyphs.lod = glyph_lod;
+		glyph_build(&c->glyphs, DIM, vvx, vvy, wn, hn, &view, vector_dim_x, vector_dim_y, vec_scale, scalar_type,
+		            autoscale ? range : 0);
+		if (autoscale)
+			range_end(range);
+		c->frame = frame_number; c->method = scalar_type; c->nx = vector_dim_x; c->ny = vector_dim_y;
+		c->lod = glyph_lod; c->autoscale = autoscale; c->scale = vec_scale; c->view = view;
+	}
+	vec_scale = c->scale;
+	glyph_draw(&c->glyphs);
+}
+
+//visualize: This is the main visualization function
+void visualize(void)
+{
+	fftw_real  wn = (fftw_real)winWidth / (fftw_real)(DIM + 1);   // Grid cell width
+	fftw_real  hn = (fftw_real)winHeight / (fftw_real)(DIM + 1);  // Grid cell heigh
+
+	if (draw_height)                                //tilt the view; everything but the images of LIC and IBFV tilts along
 	{
-		fftw_real *vvx, *vvy;
+		glMatrixMode(GL_PROJECTION);
+		glScalef(1, 1, 1.0f / (winWidth + winHeight));    //room in depth for the tilted view
+		glMatrixMode(GL_MODELVIEW);
+		glPushMatrix();
+		glTranslatef(0.5f * winWidth, 0.5f * winHeight, 0);
+		glRotatef(-height_tilt, 1, 0, 0);
+		glTranslatef(-0.5f * winWidth, -0.5f * winHeight, 0);
+	}
 
-		glBegin(GL_TRIANGLES);
+	if (draw_lic)
+	{
+		if (lic_frame != frame_number || lic.width != winWidth || lic.height != winHeight)
+		{
+			lic_compute(&lic, winWidth, winHeight, wn, hn, DIM, vx, vy);
+			lic_frame = frame_number;
+		}
+		lic_draw(&lic);
+	}
 
-		if (vector_type == 0) { // Velocity
-			vvx = vx;
-			vvy = vy;
+	if (draw_ibfv)
+	{
+		if (ibfv_frame != frame_number)
+		{
+			ibfv_step(&ibfv, DIM, vx, vy, dt);
+			ibfv_frame = frame_number;
 		}
-		else { // Force Field
-			vvx = fx;
-			vvy = fy;
+		ibfv_draw(&ibfv, wn, hn);
+	}
+
+	if (draw_height)
+		draw_height_plot(wn, hn);
+	else if (draw_smoke)
+	{	
+		fftw_real scale = 1, offset = 0;        //derived fields are signed: map [-max,max] to [0,1]
+		if (smoke_field >= 2)
+		{
+			scale = (spectral_max[smoke_field - 2] > 0) ? 0.5 / spectral_max[smoke_field - 2] : 0;
+			offset = 0.5;
 		}
+		draw_smoke_field(smoke_field, wn, hn, offset, scale);
+	}
 
-		double step_x = DIM / (double) vector_dim_x;
-		double step_y = DIM / (double) vector_dim_y;
+	if (draw_ftle)
+		draw_ftle_field(wn, hn);
 
-		for (i = 0; i < vector_dim_x; i++)
-			for (j = 0; j < vector_dim_y; j++)
-			{
-				double vectorX, vectorY;
-
-				int floor_x = floor(step_x * i);
-				int ceil_x = ceil(step_x * i);
-				int floor_y = floor(step_y * j);
-				int ceil_y = ceil(step_y * j);
-
-				vectorX = BilinearInterpolation(
-					vvx[ceil_y * DIM + ceil_x],
-					vvx[floor_y * DIM + ceil_x],
-					vvx[ceil_y * DIM + floor_x],
-					vvx[floor_y * DIM + floor_x],
-					floor_x,
-					ceil_x,
-					floor_y,
-					ceil_y,
-					step_x * (double)i,
-					step_y * (double)j
-				);
-
-				vectorY = BilinearInterpolation(
-					vvy[floor_y * DIM + floor_x],
-					vvy[ceil_y * DIM + floor_x],
-					vvy[floor_y * DIM + ceil_x],
-					vvy[ceil_y * DIM + ceil_x],
-					floor_x,
-					ceil_x,
-					floor_y,
-					ceil_y,
-					step_x * (double)i,
-					step_y * (double)j
-				);
-
-				if (floor(step_x * i) == step_x * i || floor(step_y * j) == step_y * j) {
-					idx = step_y * j * DIM + step_x * i;
-					vectorX = vvx[idx];
-					vectorY = vvy[idx];
-				}
-
-				scalar_to_color(vectorX, vectorY, scalar_type);
-				//glVertex2f(
-				//	wn + (fftw_real)i * wn,
-				//	hn + (fftw_real)j * hn
-				//);
-				//glVertex2f(
-				//	(wn + (fftw_real)i * wn) + vec_scale * vectorX, 
-				//	(hn + (fftw_real)j * hn) + vec_scale * vectorY
-				//);
-
-				for (int k = 0; k <= 360; k += DEF_D) {
-					glVertex3f(
-						(wn + (fftw_real)i * wn) + vec_scale * vectorX,
-						(hn + (fftw_real)j * hn) + vec_scale * vectorY,
-						1
-					);
-					glVertex3f(wn + (fftw_real)i * wn + 4 * Cos(k), hn + (fftw_real)j * hn + 4 * Sin(k), 0);
-					glVertex3f(wn + (fftw_real)i * wn + 4 * Cos(k + DEF_D), hn + (fftw_real)j * hn + 4 * Sin(k + DEF_D), 0);
-				}
+	if (draw_isolines)
+		draw_isolines_of_field(wn, hn);
 
-			}
+	if (draw_streamlines)
+	{
+		if (streamlines_frame != frame_number)
+		{
+			tracer_streamlines(&flow_tracer, DIM, vx, vy);
+			streamlines_frame = frame_number;
+		}
+		tracer_draw_streamlines(&flow_tracer, wn, hn);
+	}
 
-		glEnd();
+	if (draw_particles)
+		tracer_draw_particles(&flow_tracer, wn, hn);
+
+	if (draw_pathlines)
+	{
+		if (pathlines_frame != frame_number)
+		{
+			tracer_pathlines(&flow_tracer, &history);
+			pathlines_frame = frame_number;
+		}
+		tracer_draw_pathlines(&flow_tracer, wn, hn);
+	}
+
+	if (draw_streaklines)
+		tracer_draw_streaklines(&flow_tracer, wn, hn);
+
+	if (draw_vecs)
+		draw_hedgehogs(wn, hn);
+
+	if (draw_critical)
+	{
+		critical_find(&critical, DIM, vx, vy, frame_number);
+		critical_draw(&critical, wn, hn);
 	}
+
+	if (draw_height)
+		glPopMatrix();
+	camera_overlay(&view);
+	if (draw_spectrum)
+		spectrum_draw(&spectrum, 10, 10, 0.3f * winWidth, 0.25f * winHeight);
 }
 
 
 //------ INTERACTION CODE STARTS HERE -----------------------------------------------------------------
 
-//display: Handle window redrawing events. Simply delegates to visualize().
+//panel_store: Save the settings of the active view, held in the globals, into 'p'
+void panel_store(panel *p)
+{
+	p->draw_smoke = draw_smoke; p->smoke_field = smoke_field; p->draw_vecs = draw_vecs;
+	p->vector_type = vector_type; p->scalar_type = scalar_type; p->scalar_col = scalar_col;
+	p->draw_isolines = draw_isolines; p->iso_field = iso_field; p->draw_streamlines = draw_streamlines;
+	p->draw_particles = draw_particles; p->draw_lic = draw_lic; p->draw_ibfv = draw_ibfv;
+	p->draw_spectrum = draw_spectrum; p->draw_pathlines = draw_pathlines; p->draw_streaklines = draw_streaklines;
+	p->draw_critical = draw_critical; p->draw_ftle = draw_ftle;
+	p->draw_height = draw_height; p->height_field = height_field;
+}
+
+//panel_load: Make the settings 'p' the ones the visualization code uses
+void panel_load(const panel *p)
+{
+	draw_smoke = p->draw_smoke; smoke_field = p->smoke_field; draw_vecs = p->draw_vecs;
+	vector_type = p->vector_type; scalar_type = p->scalar_type; scalar_col = p->scalar_col;
+	draw_isolines = p->draw_isolines; iso_field = p->iso_field; draw_streamlines = p->draw_streamlines;
+	draw_particles = p->draw_particles; draw_lic = p->draw_lic; draw_ibfv = p->draw_ibfv;
+	draw_spectrum = p->draw_spectrum; draw_pathlines = p->draw_pathlines; draw_streaklines = p->draw_streaklines;
+	draw_critical = p->draw_critical; draw_ftle = p->draw_ftle;
+	draw_height = p->draw_height; height_field = p->height_field;
+}
+
+//panel_layout: Split the window into npanels views of winWidth x winHeight pixels
+void panel_layout(void)
+{
+	winWidth = (npanels > 1) ? screenWidth / 2 : screenWidth;
+	winHeight = (npanels > 2) ? screenHeight / 2 : screenHeight;
+}
+
+//panel_at: The view under window pixel (x,y), with y pointing down, and the pixel within that view in (*px,*py)
+int panel_at(int x, int y, int *px, int *py)
+{
+	int col = (npanels > 1 && x >= winWidth) ? 1 : 0, row = (npanels > 2 && y >= winHeight) ? 1 : 0;
+	*px = x - col * winWidth;
+	*py = y - row * winHeight;
+	return row * 2 + col;
+}
+
+//display: Handle window redrawing events. Draws every view with visualize(), in its own part of the window, with
+//         its settings loaded; the views share the camera and the caches of the simulation step.
 void display(void) 
 {
+	int p;
+
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-	glMatrixMode(GL_MODELVIEW);
-	glLoadIdentity();
-	visualize(); 
+	for (p = 0; p < npanels; p++)
+	{
+		int x = (p % 2) * winWidth, y = (npanels > 2 && p < 2) ? winHeight : 0;
+		glViewport(x, y, winWidth, winHeight);
+		glScissor(x, y, winWidth, winHeight);           //glDrawPixels is not clipped to the viewport
+		glEnable(GL_SCISSOR_TEST);
+		glMatrixMode(GL_MODELVIEW);
+		glLoadIdentity();
+		panel_load(panels + p);
+		camera_apply(&view, winWidth, winHeight);
+		visualize(); 
+		if (npanels > 1)                        //frame the views, the active one in white
+		{
+			float c = (p == active_panel) ? 1.0f : 0.4f;
+			glColor3f(c, c, c);
+			glBegin(GL_LINE_LOOP);
+			glVertex2f(0.5f, 0.5f); glVertex2f(winWidth - 0.5f, 0.5f);
+			glVertex2f(winWidth - 0.5f, winHeight - 0.5f); glVertex2f(0.5f, winHeight - 0.5f);
+			glEnd();
+		}
+	}
+	glDisable(GL_SCISSOR_TEST);
+	panel_load(panels + active_panel);
 	glFlush(); 
 	glutSwapBuffers();
 }
@@ -458,11 +1097,8 @@ void display(void)
 //reshape: Handle window resizing (reshaping) events
 void reshape(int w, int h) 
 {
- 	glViewport(0.0f, 0.0f, (GLfloat)w, (GLfloat)h);
-	glMatrixMode(GL_PROJECTION);  
-	glLoadIdentity();
-	gluOrtho2D(0.0, (GLdouble)w, 0.0, (GLdouble)h);
-	winWidth = w; winHeight = h;
+	screenWidth = w; screenHeight = h;
+	panel_layout();
 }
 
 //keyboard: Handle key presses
@@ -486,11 +1122,114 @@ void keyboard(unsigned char key, int x, int y)
 	  case 'G': vector_type = rotational_increment(vector_type, 2); printf("Vector type set to: %d \n", vector_type);  break;
 
 	  case 'o': vector_dim_x += 1; break;
-	  case 'O': vector_dim_x -= 1; break;
+	  case 'O': if (vector_dim_x > 1) vector_dim_x -= 1; break;
 
 	  case 'p': vector_dim_y += 1; break;
-	  case 'P': vector_dim_y -= 1; break;
-	  case 'q': exit(0);
+	  case 'P': if (vector_dim_y > 1) vector_dim_y -= 1; break;
+
+	  case 'l': draw_isolines = 1 - draw_isolines; break;
+	  case 'L': iso_field = rotational_increment(iso_field, 5); printf("Isoline field set to: %d \n", iso_field); break;
+	  case 'f': smoke_field = (smoke_field == 0) ? 2 : rotational_increment(smoke_field, 5);
+		    printf("Smoke field set to: %d \n", smoke_field); break;
+	  case 'k': if (iso_count > 1) iso_count--; break;
+	  case 'K': if (iso_count < ISO_MAX_VALUES) iso_count++; break;
+
+	  case 'r': draw_streamlines = 1 - draw_streamlines; break;
+	  case 'R': flow_tracer.order = 6 - flow_tracer.order; streamlines_frame = -1;
+		    printf("Tracing with RK%d\n", flow_tracer.order); break;
+	  case 'n': draw_particles = 1 - draw_particles; break;
+	  case 'd': draw_lic = 1 - draw_lic; break;
+	  case 'b': draw_ibfv = 1 - draw_ibfv; break;
+	  case 'e': draw_spectrum = 1 - draw_spectrum; break;
+	  case 'u': draw_ftle = 1 - draw_ftle; break;
+	  case 'U': ftle_set_resolution(&ftle, (ftle.res >= 256) ? 64 : 2 * ftle.res);
+		    printf("FTLE resolution set to: %d \n", ftle.res); break;
+	  case 'A': autoscale = 1 - autoscale; break;
+	  case 'z': draw_critical = 1 - draw_critical; break;
+	  case 'g': glyph_lod = 1 - glyph_lod; printf("Glyph level of detail: %s\n", glyph_lod ? "on" : "off"); break;
+	  case 'w': npanels = (npanels == 1) ? 2 : (npanels == 2) ? 4 : 1;
+		    if (active_panel >= npanels) { active_panel = 0; panel_load(panels); }
+		    panel_layout(); printf("Views: %d\n", npanels); break;
+	  case '\t': active_panel = (active_panel + 1) % npanels; panel_load(panels + active_panel);
+		    printf("Active view: %d\n", active_panel + 1); break;
+	  case '+':
+	  case '=': camera_zoom(&view, 1.25f); break;
+	  case '-': camera_zoom(&view, 0.8f); break;
+	  case '0': camera_reset(&view, winWidth, winHeight); break;
+	  case 'h': draw_pathlines = 1 - draw_pathlines; break;
+	  case 'i': draw_streaklines = 1 - draw_streaklines; break;
+	  case 'H': history_compact = 1 - history_compact;          //starts a new history: FTLE and streaklines restart
+		    history_free(&history); history_init(&history, DIM, 64, history_compact);
+		    ftle.frame = 0; pathlines_frame = -1;
+		    printf("Velocity history stored in %s\n", history_compact ? "16-bit fixed point" : "floats"); break;
+	  case 'j': ftle.backward = 1 - ftle.backward; ftle.frame = 0;
+		    printf("FTLE direction set to: %s \n", ftle.backward ? "backward" : "forward"); break;
+	  case 'E': if (exporter.header) shm_export_close(&exporter);
+		    else if (shm_export_open(&exporter, SHM_NAME, DIM, sizeof(fftw_real)) == 0)
+			    printf("Publishing frames in shared memory %s\n", SHM_NAME);
+		    break;
+	  case 'X': if (recorder.file) record_stop();
+		    else if (snapshot_record_open(&recorder, record_path, DIM, record_tolerance) == 0)
+			    printf("Recording the fields in %s\n", record_path);
+		    break;
+	  case 'W': checkpoint(); printf("Checkpoint of step %d in %s\n", frame_number, checkpoint_path); break;
+	  case 'Y': if (vtk.running) vtk_stop();
+		    else vtk_start();
+		    break;
+	  case 'D': draw_height = 1 - draw_height; break;
+	  case 'F': height_field = 1 - height_field;
+		    printf("Height plot field set to: %s\n", height_field ? "velocity magnitude" : "density"); break;
+	  case 'N': height_tilt = (height_tilt >= 60) ? 0 : height_tilt + 15; printf("Height plot tilt: %g degrees\n", height_tilt); break;
+	  case 'M': if (video.running) video_stop();
+		    else video_start();
+		    break;
+	  case 'q': finish_outputs(); exit(0);
+	}
+	panel_store(panels + active_panel);
+	if (!headless)
+		glutPostRedisplay();
+}
+
+//remote_command: Handle a command of a client of the frame server (see stream_frames.h)
+void remote_command(const char *command)
+{
+	float x, y, force_x, force_y, value;
+	char key;
+
+	if (sscanf(command, "force %f %f %f %f", &x, &y, &force_x, &force_y) == 4)
+	{
+		int X = (int)(x * DIM), Y = (int)(y * DIM);   //as a drag of the mouse: a force, and new matter
+		if (X > DIM - 1) X = DIM - 1; if (Y > DIM - 1) Y = DIM - 1;
+		if (X < 0) X = 0; if (Y < 0) Y = 0;
+		fx[Y * DIM + X] += force_x;
+		fy[Y * DIM + X] += force_y;
+		rho[Y * DIM + X] = 10.0f;
+	}
+	else if (sscanf(command, "set dt %f", &value) == 1)
+		dt = value;
+	else if (sscanf(command, "set visc %f", &value) == 1)
+		visc = value;
+	else if (strcmp(command, "pause") == 0)
+		frozen = 1;
+	else if (strcmp(command, "resume") == 0)
+		frozen = 0;
+	else if (sscanf(command, "key %c", &key) == 1)
+		keyboard((unsigned char)key, 0, 0);
+	else
+		fprintf(stderr, "Unknown command: %s\n", command);
+}
+
+
+
+//special: Handle the arrow keys, which pan the view by a tenth of the window
+void special(int key, int x, int y)
+{
+	switch (key)
+	{
+	  case GLUT_KEY_LEFT:  camera_pan(&view, -0.1f * winWidth, 0); break;
+	  case GLUT_KEY_RIGHT: camera_pan(&view,  0.1f * winWidth, 0); break;
+	  case GLUT_KEY_DOWN:  camera_pan(&view, 0, -0.1f * winHeight); break;
+	  case GLUT_KEY_UP:    camera_pan(&view, 0,  0.1f * winHeight); break;
 	}
 }
 
@@ -500,12 +1239,16 @@ void keyboard(unsigned char key, int x, int y)
 //       cursor movement. Also inject some new matter into the field at the mouse location.
 void drag(int mx, int my) 
 {
-	int xi,yi,X,Y; double  dx, dy, len;
+	int xi,yi,X,Y,p; double  dx, dy, len; float wx, wy;
 	static int lmx=0,lmy=0;				//remembers last mouse location
 
-	// Compute the array index that corresponds to the cursor location 
-	xi = (int)clamp((double)(DIM + 1) * ((double)mx / (double)winWidth));
-	yi = (int)clamp((double)(DIM + 1) * ((double)(winHeight - my) / (double)winHeight));
+	// Compute the array index that corresponds to the cursor location, in the view it is in
+	p = panel_at(mx, my, &mx, &my);
+	camera_to_world(&view, (float)mx, (float)(winHeight - my), &wx, &wy);
+	if (panels[p].draw_height)              //the point of the tilted ground plane under the cursor
+		wy = 0.5f * winHeight + (wy - 0.5f * winHeight) / (float)cos(height_tilt * PI / 180);
+	xi = (int)clamp((double)(DIM + 1) * ((double)wx / (double)winWidth));
+	yi = (int)clamp((double)(DIM + 1) * ((double)wy / (double)winHeight));
 
 	X = xi; Y = yi;
 
@@ -527,6 +1270,8 @@ void drag(int mx, int my)
 //main: The main program
 int main(int argc, char **argv) 
 {
+	int k, serve = 0;
+
 	printf("Fluid Flow Simulation and Visualization\n");
 	printf("=======================================\n");
 	printf("Click and drag the mouse to steer the flow!\n");
@@ -541,18 +1286,170 @@ int main(int argc, char **argv)
 	printf("G:   Cycle through scalar/vector options \n");
 	printf("p/P:   Increase / decrease dimension x");
 	printf("o/O:   Increase / decrease dimension y");
-	printf("q:     quit\n\n");
-
-	glutInit(&argc, argv);
-	glutInitDisplayMode(GLUT_RGB | GLUT_DOUBLE | GLUT_DEPTH);
-	glutInitWindowSize(900,900);
-	glutCreateWindow("Real-time smoke simulation and visualization");
-	glutDisplayFunc(display);
-	glutReshapeFunc(reshape);
-	glutIdleFunc(do_one_simulation_step);
-	glutKeyboardFunc(keyboard);
-	glutMotionFunc(drag);
+	printf("l:     toggle drawing isolines on/off\n");
+	printf("L:     cycle isoline field: density, velocity magnitude, vorticity, stream function, divergence\n");
+	printf("f:     cycle smoke field: density, vorticity, stream function, divergence\n");
+	printf("k/K:   decrease/increase number of isolines\n");
+	printf("r:     toggle drawing streamlines on/off\n");
+	printf("R:     toggle streamline/particle integration between RK2 and RK4\n");
+	printf("n:     toggle drawing particles on/off\n");
+	printf("d:     toggle drawing the LIC texture on/off\n");
+	printf("b:     toggle drawing the IBFV texture on/off\n");
+	printf("e:     toggle the energy spectrum and enstrophy plot on/off\n");
+	printf("u:     toggle drawing the finite-time Lyapunov exponent (FTLE) on/off\n");
+	printf("U:     cycle FTLE resolution: 64, 128, 256\n");
+	printf("j:     toggle FTLE direction: backward (attracting) or forward (repelling)\n");
+	printf("A:     toggle automatic colour ranges and hedgehog scaling on/off\n");
+	printf("z:     toggle drawing critical points (sources, sinks, saddles, centres) on/off\n");
+	printf("h:     toggle drawing pathlines over the last steps on/off\n");
+	printf("i:     toggle drawing streaklines on/off\n");
+	printf("H:     toggle storing the velocity history in 16-bit fixed point\n");
+	printf("g:     toggle hedgehog level of detail (skip short glyphs, lines or points when small) on/off\n");
+	printf("+/-:   zoom in/out\n");
+	printf("arrows: pan the zoomed view\n");
+	printf("0:     reset zoom and pan\n");
+	printf("w:     cycle the number of linked views: 1, 2, 4\n");
+	printf("Tab:   select the view the other keys act on\n");
+	printf("E:     toggle publishing vx, vy and rho in shared memory for other processes on/off\n");
+	printf("X:     toggle recording the fields in a compressed file on/off\n");
+	printf("W:     write a checkpoint of the solver\n");
+	printf("Y:     toggle exporting the fields as VTK image data on/off\n");
+	printf("M:     toggle streaming the smoke, rendered on the CPU, as video on/off\n");
+	printf("D:     toggle drawing a height plot (2.5D) instead of the smoke on/off\n");
+	printf("F:     toggle height plot field: density, velocity magnitude\n");
+	printf("N:     cycle the tilt of the views with a height plot: 0, 15, 30, 45, 60 degrees\n");
+	printf("q:     quit\n");
+	printf("Options: -serve [socket]  serve the steps to local clients (default %s)\n", STREAM_PATH);
+	printf("         -headless        serve without a window\n");
+	printf("         -record [file]   record the fields from the start (default %s)\n", record_path);
+	printf("         -tolerance vx=1e-5,vy=1e-5,fx=1e-5,fy=1e-5,rho=1e-4\n");
+	printf("                          largest error of each recorded field; 0 records it exactly, -1 leaves it out\n");
+	printf("         -checkpoint [file] [steps]  write checkpoints in file (default %s), every 'steps' steps\n", checkpoint_path);
+	printf("         -restart file    continue from a checkpoint\n");
+	printf("         -vtk [prefix] [steps]  export the fields as VTK image data every 'steps' steps (default %s, %d)\n",
+	       vtk_prefix, vtk_every);
+	printf("         -video [file] [WxH] [steps]  stream the smoke as video (default %s, %dx%d, every step); the file\n"
+	       "                          may be |command; .rgb or .raw for raw RGB, else YUV4MPEG2\n", video_path, video_width, video_height);
+	printf("         -steps n         run n steps without a window, then quit (with -record, -vtk or -video, and no\n"
+	       "                          frame server unless -serve or -headless is given)\n\n");
+
+	server.fd = -1;
+	snapshot_default_tolerances(record_tolerance);
+	for (k = 1; k < argc; k++)
+	{
+		if (strcmp(argv[k], "-tolerance") == 0 && k + 1 < argc && snapshot_parse_tolerances(argv[k + 1], record_tolerance) != 0)
+			printf("Cannot read the tolerances %s\n", argv[k + 1]);
+		if (strcmp(argv[k], "-record") == 0 && k + 1 < argc && argv[k + 1][0] != '-')
+			record_path = argv[k + 1];
+		if (strcmp(argv[k], "-checkpoint") == 0)
+		{
+			if (k + 1 < argc && argv[k + 1][0] != '-' && !isdigit((unsigned char)argv[k + 1][0]))
+				checkpoint_path = argv[++k];
+			if (k + 1 < argc && isdigit((unsigned char)argv[k + 1][0]))
+				checkpoint_every = atoi(argv[++k]);
+		}
+		if (strcmp(argv[k], "-vtk") == 0)
+		{
+			if (k + 1 < argc && argv[k + 1][0] != '-' && !isdigit((unsigned char)argv[k + 1][0]))
+				vtk_prefix = argv[++k];
+			if (k + 1 < argc && isdigit((unsigned char)argv[k + 1][0]))
+				vtk_every = atoi(argv[++k]);
+			vtk_start();
+		}
+		if (strcmp(argv[k], "-steps") == 0 && k + 1 < argc)
+		{
+			max_steps = atoi(argv[++k]);
+			headless = 1;
+		}
+		if (strcmp(argv[k], "-video") == 0)
+		{
+			if (k + 1 < argc && argv[k + 1][0] != '-' && !isdigit((unsigned char)argv[k + 1][0]))
+				video_path = argv[++k];
+			if (k + 1 < argc && sscanf(argv[k + 1], "%dx%d", &video_width, &video_height) == 2)
+				k++;
+			if (k + 1 < argc && isdigit((unsigned char)argv[k + 1][0]))
+				video_every = atoi(argv[++k]);
+			video_start();
+		}
+	}
+	for (k = 1; k < argc; k++)
+	{
+		if (strcmp(argv[k], "-record") == 0 && !recorder.file
+		 && snapshot_record_open(&recorder, record_path, DIM, record_tolerance) == 0)
+			printf("Recording the fields in %s\n", record_path);
+		if (strcmp(argv[k], "-serve") == 0 || strcmp(argv[k], "-headless") == 0)
+		{
+			const char *path = (k + 1 < argc && argv[k + 1][0] != '-') ? argv[k + 1] : STREAM_PATH;
+			headless |= strcmp(argv[k], "-headless") == 0;
+			serve = 1;
+			if (server.fd < 0 && server_open(&server, path) == 0)
+				printf("Serving frames on %s\n", path);
+		}
+	}
+	if (headless && server.fd < 0 && (serve || !max_steps))  //the server asked for, or nothing to stop the steps
+	{
+		finish_outputs();                   //-record, -vtk and -video may have started already
+		return 1;
+	}
+
+	if (!headless)
+	{
+		glutInit(&argc, argv);
+		glutInitDisplayMode(GLUT_RGB | GLUT_DOUBLE | GLUT_DEPTH);
+		glutInitWindowSize(900,900);
+		glutCreateWindow("Real-time smoke simulation and visualization");
+		glutDisplayFunc(display);
+		glutReshapeFunc(reshape);
+		glutIdleFunc(do_one_simulation_step);
+		glutKeyboardFunc(keyboard);
+		glutSpecialFunc(special);
+		glutMotionFunc(drag);
+	}
 	init_simulation(DIM);	//initialize the simulation data structures	
+	for (k = 1; k + 1 < argc; k++)
+		if (strcmp(argv[k], "-restart") == 0 && restart(argv[k + 1]) != 0)
+		{
+			finish_outputs();
+			return 1;
+		}
+	for (k = 0; k < 5; k++)
+	{
+		iso_init(isolines + k);
+		range_init(smoke_range + k, 0.02f, 0.98f, 0.1f);
+	}
+	tracer_init(&flow_tracer, 32, 32, 100, 4096);
+	lic_init(&lic, 10, 20);
+	ibfv_init(&ibfv, 512);
+	history_init(&history, DIM, 64, history_compact);
+	tracer_init_time_lines(&flow_tracer, 12, 12, 48);
+	critical_init(&critical);
+	range_init(&ftle_range, 0, 0.98f, 0.1f);
+	ftle_init(&ftle, 128, 8, 4);
+	camera_reset(&view, 900, 900);
+	for (k = 0; k < 2; k++)
+	{
+		range_init(glyph_range + k, 0, 0.95f, 0.1f);
+		glyph_init(&hedgehogs[k].glyphs);
+		hedgehogs[k].frame = -1;
+	}
+
+	panel_store(panels);                    //the other views start with the smoke, the force and the vorticity
+	for (k = 1; k < MAX_PANELS; k++)
+		panels[k] = panels[0];
+	panels[1].draw_smoke = 1; panels[1].draw_vecs = 0;
+	panels[2].vector_type = 1;
+	panels[3].draw_smoke = 1; panels[3].smoke_field = 2; panels[3].draw_vecs = 0;
+	if (headless)
+	{
+		while (!max_steps || frame_number < max_steps)  //the clients pause, steer and quit the simulation
+		{
+			if (frozen)
+				server_poll(&server, 20, remote_command);
+			do_one_simulation_step();
+		}
+		finish_outputs();
+		return 0;
+	}
 	glutMainLoop();			//calls do_one_simulation_step, keyboard, display, drag, reshape
 	return 0;
 }
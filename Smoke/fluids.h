@@ -0,0 +1,70 @@
+// fluids.h: State of the simulation and of the visualization that is shared between fluids.c and the
+//           visualization modules (isolines.c, ...). Everything declared here is defined in fluids.c.
+//--------------------------------------------------------------------------------------------------
+
+#ifndef FLUIDS_H
+#define FLUIDS_H
+
+#include <rfftw.h>              //the numerical simulation FFTW library
+#include "camera.h"             //zoom and pan of the view
+
+//--- SIMULATION PARAMETERS ------------------------------------------------------------------------
+extern const int DIM;			//size of simulation grid
+extern double dt;				//simulation time step
+extern float visc;				//fluid viscosity
+extern fftw_real *vx, *vy;      //(vx,vy)   = velocity field at the current moment
+extern fftw_real *vx0, *vy0;    //(vx0,vy0) = velocity field at the previous moment
+extern fftw_real *fx, *fy;	    //(fx,fy)   = user-controlled simulation forces, steered with the mouse 
+extern fftw_real *rho, *rho0;	//smoke density at the current (rho) and previous (rho0) moment 
+extern int frame_number;        //number of simulation steps done so far
+
+//Fields derived from the velocity in Fourier space by solve(), when requested in 'spectral_fields'
+#define SPECTRAL_VORTICITY  1       //vorticity dvy/dx - dvx/dy
+#define SPECTRAL_STREAM     2       //stream function psi, with (vx,vy) = (dpsi/dy, -dpsi/dx)
+#define SPECTRAL_DIVERGENCE 4       //divergence of the velocity before the projection step
+#define SPECTRAL_ENERGY     8       //energy spectrum and enstrophy, into 'spectrum' in fluids.c (see spectrum.h)
+extern int spectral_fields;     //derived fields solve() computes: a combination of the flags above
+extern fftw_real *vorticity, *stream, *divergence;
+
+
+//--- VISUALIZATION PARAMETERS ---------------------------------------------------------------------
+extern int winWidth, winHeight; //size of a view, in pixels (the window holds one, two or four)
+extern camera view;             //zoom and pan of the view
+extern int scalar_col;          //method for scalar coloring
+
+
+int clamp(float x);
+void rainbow(float value, float* R, float* G, float* B);
+void vector_color(float x, float y, int method, float *R, float *G, float *B);
+
+//backtrace: Grid coordinate the point at domain coordinate 'x' (in [0,1)) came from, when it moved with velocity 'u'
+//           during the last time step 'dt'. This is the first half of the semi-Lagrangian steps of the solver.
+static __inline fftw_real backtrace(int n, fftw_real x, fftw_real u, fftw_real dt)
+{
+	return n * (x - dt * u) - 0.5f;
+}
+
+//wrap: Split the grid coordinate 'x' into the two periodic grid indices (*i0,*i1) around it and the weight *s
+//      of *i1. This is the wrap-around of the semi-Lagrangian steps of the solver, shared with the tracers.
+static __inline void wrap(int n, fftw_real x, int *i0, int *i1, fftw_real *s)
+{
+	int i = clamp(x);
+	*s  = x - i;
+	*i0 = (n + (i % n)) % n;
+	*i1 = (*i0 + 1) % n;
+}
+
+//sample_field: Bilinear interpolation of the n x n field 'f' at grid coordinate (x,y), with the periodic wrap of the
+//              solver
+static __inline fftw_real sample_field(const fftw_real *f, int n, fftw_real x, fftw_real y)
+{
+	int i0, i1, j0, j1;
+	fftw_real s, t;
+
+	wrap(n, x, &i0, &i1, &s);
+	wrap(n, y, &j0, &j1, &t);
+	return (1 - t) * ((1 - s) * f[i0 + n * j0] + s * f[i1 + n * j0])
+	     +      t  * ((1 - s) * f[i0 + n * j1] + s * f[i1 + n * j1]);
+}
+
+#endif
@@ -0,0 +1,221 @@
+// ftle.c: Finite-time Lyapunov exponent from cached block flow maps (see ftle.h).
+//
+//         FTLE grid point p lies at grid coordinate (p+0.5)*n/res-0.5. The flow maps store, for every FTLE grid
+//         point, how far it moves over the time the map covers; they are interpolated periodically between the
+//         FTLE grid points. Forward, the map of the current block is advanced by moving every end point one step
+//         further. Backward, every grid point is first moved one step back, and the map of the block is then
+//         applied at the point it reached. Either way a step costs one RK2 step and at most one interpolation per
+//         point, independent of the length of the window. The FTLE is ln(sqrt(l))/T, with l the largest eigenvalue
+//         of the Cauchy-Green tensor J^T J of the flow map over the window of length T.
+//--------------------------------------------------------------------------------------------------
+
+#include "ftle.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+//ftle_map_at: Interpolate the displacement map (mx,my) of the res x res FTLE grid at grid coordinate (x,y)
+static void ftle_map_at(const float *mx, const float *my, int res, int n, float x, float y, float *dx, float *dy)
+{
+	float g = (float)res / n, s, t;
+	int i0, j0, i1, j1;
+
+	x = (x + 0.5f) * g - 0.5f;
+	y = (y + 0.5f) * g - 0.5f;
+	if (x < 0 || x >= res) x -= res * (float)floor(x / res);
+	if (y < 0 || y >= res) y -= res * (float)floor(y / res);
+	i0 = (int)x; if (i0 >= res) i0 = res - 1;
+	j0 = (int)y; if (j0 >= res) j0 = res - 1;
+	s = x - i0; t = y - j0;
+	i1 = (i0 + 1 == res) ? 0 : i0 + 1;
+	j1 = (j0 + 1 == res) ? 0 : j0 + 1;
+	j0 *= res; j1 *= res;
+	*dx = (1-s)*((1-t)*mx[i0+j0]+t*mx[i0+j1])+s*((1-t)*mx[i1+j0]+t*mx[i1+j1]);
+	*dy = (1-s)*((1-t)*my[i0+j0]+t*my[i0+j1])+s*((1-t)*my[i1+j0]+t*my[i1+j1]);
+}
+
+//ftle_rk2: Move the point (x,y) over time 'dir'*dt (dir is +1 or -1) through the velocity of history slot 'slot'
+static void ftle_rk2(const velocity_history *h, int slot, float dir, float *x, float *y)
+{
+	float d = dir * h->dt[slot], u, v;
+
+	history_velocity(h, slot, *x, *y, &u, &v);
+	history_velocity(h, slot, *x + 0.5f * d * u, *y + 0.5f * d * v, &u, &v);
+	*x += d * u;
+	*y += d * v;
+}
+
+void ftle_init(ftle_engine *e, int res, int blocks, int block_length)
+{
+	memset(e, 0, sizeof(*e));
+	e->blocks = blocks;
+	e->block_length = block_length;
+	e->backward = 1;
+	e->time = (float*) malloc((blocks + 1) * sizeof(float));
+	ftle_set_resolution(e, res);
+}
+
+void ftle_free(ftle_engine *e)
+{
+	free(e->map_x); free(e->map_y); free(e->time);
+	free(e->tmp_x); free(e->tmp_y); free(e->field);
+	memset(e, 0, sizeof(*e));
+}
+
+//ftle_set_resolution: use a res x res FTLE grid; the maps are rebuilt from the history at the next update
+void ftle_set_resolution(ftle_engine *e, int res)
+{
+	size_t size = (size_t)res * res;
+
+	e->res = res;
+	free(e->map_x); free(e->map_y); free(e->tmp_x); free(e->tmp_y); free(e->field);
+	e->map_x = (float*) malloc((e->blocks + 1) * size * sizeof(float));
+	e->map_y = (float*) malloc((e->blocks + 1) * size * sizeof(float));
+	e->tmp_x = (float*) malloc(size * sizeof(float));
+	e->tmp_y = (float*) malloc(size * sizeof(float));
+	e->field = (float*) malloc(size * sizeof(float));
+	e->valid = 0;
+	e->frame = 0;
+}
+
+//ftle_advance: advance the map of the current block by the step of history slot 'slot'. Returns 1 when that
+//              completes the block, which is then cached.
+static int ftle_advance(ftle_engine *e, const velocity_history *h, int slot)
+{
+	int res = e->res, n = h->n, ntiles = (res + FTLE_TILE - 1) / FTLE_TILE, t;
+	size_t size = (size_t)res * res;
+	float *ox = e->map_x + e->blocks * size, *oy = e->map_y + e->blocks * size;
+	float g = (float)n / res;
+
+#pragma omp parallel for schedule(dynamic)
+	for (t = 0; t < ntiles * ntiles; t++)
+	{
+		int i0 = (t % ntiles) * FTLE_TILE, j0 = (t / ntiles) * FTLE_TILE;
+		int i1 = (i0 + FTLE_TILE < res) ? i0 + FTLE_TILE : res;
+		int j1 = (j0 + FTLE_TILE < res) ? j0 + FTLE_TILE : res;
+		int i, j;
+
+		for (j = j0; j < j1; j++)
+			for (i = i0; i < i1; i++)
+			{
+				int p = i + res * j;
+				float gx = (i + 0.5f) * g - 0.5f, gy = (j + 0.5f) * g - 0.5f, x, y, dx, dy;
+
+				if (!e->backward)
+				{
+					x = gx; y = gy;
+					if (e->steps) { x += ox[p]; y += oy[p]; }
+					ftle_rk2(h, slot, 1, &x, &y);
+					e->tmp_x[p] = x - gx;
+					e->tmp_y[p] = y - gy;
+				}
+				else
+				{
+					x = gx; y = gy;
+					ftle_rk2(h, slot, -1, &x, &y);
+					if (e->steps)
+					{
+						ftle_map_at(ox, oy, res, n, x, y, &dx, &dy);
+						x += dx; y += dy;
+					}
+					e->tmp_x[p] = x - gx;
+					e->tmp_y[p] = y - gy;
+				}
+			}
+	}
+	memcpy(ox, e->tmp_x, size * sizeof(float));
+	memcpy(oy, e->tmp_y, size * sizeof(float));
+	e->time[e->blocks] = (e->steps ? e->time[e->blocks] : 0) + h->dt[slot];
+
+	if (++e->steps < e->block_length) return 0;
+
+	e->newest = (e->newest + 1) % e->blocks;                    //cache the complete block
+	memcpy(e->map_x + e->newest * size, ox, size * sizeof(float));
+	memcpy(e->map_y + e->newest * size, oy, size * sizeof(float));
+	e->time[e->newest] = e->time[e->blocks];
+	if (e->nclosed < e->blocks) e->nclosed++;
+	e->steps = 0;
+	return 1;
+}
+
+//ftle_compute: compose the cached block maps into the flow map of the window (into tmp_x, tmp_y) and compute the
+//              FTLE field from its gradient
+static void ftle_compute(ftle_engine *e, int n)
+{
+	int res = e->res, ntiles = (res + FTLE_TILE - 1) / FTLE_TILE, t, c, p;
+	size_t size = (size_t)res * res;
+	float g = (float)n / res, T = 0;
+
+	for (c = 0; c < e->nclosed; c++)
+		T += e->time[(e->newest - c + e->blocks) % e->blocks];
+
+#pragma omp parallel for schedule(dynamic)
+	for (t = 0; t < ntiles * ntiles; t++)
+	{
+		int i0 = (t % ntiles) * FTLE_TILE, j0 = (t / ntiles) * FTLE_TILE;
+		int i1 = (i0 + FTLE_TILE < res) ? i0 + FTLE_TILE : res;
+		int j1 = (j0 + FTLE_TILE < res) ? j0 + FTLE_TILE : res;
+		int i, j, k;
+
+		for (j = j0; j < j1; j++)
+			for (i = i0; i < i1; i++)
+			{
+				float gx = (i + 0.5f) * g - 0.5f, gy = (j + 0.5f) * g - 0.5f, x = gx, y = gy, dx, dy;
+
+				for (k = 0; k < e->nclosed; k++)     //backward: newest block first; forward: oldest first
+				{
+					int b = e->backward ? e->newest - k : e->newest - (e->nclosed - 1) + k;
+					b = (b + e->blocks) % e->blocks;
+					ftle_map_at(e->map_x + b * size, e->map_y + b * size, res, n, x, y, &dx, &dy);
+					x += dx; y += dy;
+				}
+				e->tmp_x[i + res * j] = x - gx;
+				e->tmp_y[i + res * j] = y - gy;
+			}
+	}
+
+#pragma omp parallel for
+	for (t = 0; t < res; t++)                                  //rows of the FTLE grid
+	{
+		int j = t, jm = (j == 0) ? res - 1 : j - 1, jp = (j == res - 1) ? 0 : j + 1, i;
+		const float *dx = e->tmp_x, *dy = e->tmp_y;
+		float f = 0.5f / g;
+
+		for (i = 0; i < res; i++)
+		{
+			int im = (i == 0) ? res - 1 : i - 1, ip = (i == res - 1) ? 0 : i + 1;
+			float a = 1 + f * (dx[ip + res * j] - dx[im + res * j]), b = f * (dx[i + res * jp] - dx[i + res * jm]);
+			float c = f * (dy[ip + res * j] - dy[im + res * j]), d = 1 + f * (dy[i + res * jp] - dy[i + res * jm]);
+			float c11 = a * a + c * c, c12 = a * b + c * d, c22 = b * b + d * d;
+			float l = 0.5f * (c11 + c22) + (float)sqrt(0.25f * (c11 - c22) * (c11 - c22) + c12 * c12);
+			e->field[i + res * j] = (l > 0 && T > 0) ? (float)log(l) / (2 * T) : 0;
+		}
+	}
+
+	e->max = 0;
+	for (p = 0; p < res * res; p++)
+		if (e->field[p] > e->max) e->max = e->field[p];
+	e->valid = 1;
+}
+
+//ftle_update: advance the maps through the frames pushed to 'h' since the last update, or rebuild them from the
+//             frames in 'h' after a change of the settings. Returns 1 when the FTLE field was recomputed.
+int ftle_update(ftle_engine *e, const velocity_history *h)
+{
+	int frames = h->pushed - e->frame, closed = 0, age;
+
+	if (h->count == 0 || frames == 0) return 0;
+	if (e->frame == 0 || frames > h->count)
+	{
+		frames = (h->count < e->blocks * e->block_length) ? h->count : e->blocks * e->block_length;
+		e->nclosed = e->steps = 0;
+		e->valid = 0;
+	}
+	for (age = frames - 1; age >= 0; age--)
+		closed |= ftle_advance(e, h, history_slot(h, age));
+	e->frame = h->pushed;
+
+	if (!closed) return 0;
+	ftle_compute(e, h->n);
+	return 1;
+}
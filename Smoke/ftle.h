@@ -0,0 +1,40 @@
+// ftle.h: Finite-time Lyapunov exponent of the flow over the last steps, on a grid of configurable resolution.
+//         The flow map over the whole time window is not integrated from scratch every time: the window is split
+//         into blocks of a few steps, the flow map of every block is cached, and the map of the window is the
+//         composition of the block maps. The map of the current block is advanced by one step per simulation
+//         step; when it is complete, it replaces the oldest cached map and the FTLE field is recomputed.
+//--------------------------------------------------------------------------------------------------
+
+#ifndef FTLE_H
+#define FTLE_H
+
+#include "history.h"
+
+#define FTLE_TILE 32            //size of the tiles of the FTLE grid that are computed by different threads
+
+typedef struct
+{
+	int res;                    //the FTLE grid has res x res points, spread evenly over the simulation grid
+	int blocks;                 //number of block maps composed into the flow map of the window
+	int block_length;           //number of simulation steps per block
+	int backward;               //1: backward FTLE at the newest step (attracting structures), 0: forward FTLE
+	                            //at the oldest step of the window (repelling structures)
+	float *map_x, *map_y;       //blocks+1 flow maps, stored as displacements in grid cells: the cached maps of the
+	                            //complete blocks (a ring buffer) followed by the map of the current block
+	float *time;                //time covered by each map
+	int nclosed;                //number of complete block maps cached
+	int newest;                 //ring slot of the newest complete block map
+	int steps;                  //number of steps in the map of the current block
+	float *tmp_x, *tmp_y;       //scratch: flow map of the window
+	float *field;               //res x res FTLE values
+	float max;                  //largest FTLE value in 'field'
+	int valid;                  //'field' holds a computed FTLE field
+	int frame;                  //number of history frames the maps were advanced through, 0 to rebuild them
+} ftle_engine;
+
+void ftle_init(ftle_engine *e, int res, int blocks, int block_length);
+void ftle_free(ftle_engine *e);
+void ftle_set_resolution(ftle_engine *e, int res);
+int  ftle_update(ftle_engine *e, const velocity_history *h);
+
+#endif
@@ -0,0 +1,180 @@
+// glyphs.c: Hedgehogs with level of detail (see glyphs.h).
+//--------------------------------------------------------------------------------------------------
+
+#include "glyphs.h"
+#include "fluids.h"
+#include "parallel.h"
+#include <GL/glut.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+void glyph_init(glyph_set *g)
+{
+	int k;
+
+	memset(g, 0, sizeof(*g));
+	g->lod = 1;
+	g->min_length = 0.5f;
+	g->min_spacing = 2;
+	g->point_spacing = 3;
+	g->line_spacing = 10;
+	for (k = 0; k <= GLYPH_SEGMENTS; k++)
+	{
+		g->base[k][0] = (float)cos(6.2831853 * k / GLYPH_SEGMENTS);
+		g->base[k][1] = (float)sin(6.2831853 * k / GLYPH_SEGMENTS);
+	}
+}
+
+void glyph_free(glyph_set *g)
+{
+	int t;
+	for (t = 0; t < g->capacity; t++)
+	{
+		free(g->tiles[t].cones.v);
+		free(g->tiles[t].lines.v);
+		free(g->tiles[t].points.v);
+	}
+	free(g->tiles);
+	memset(g, 0, sizeof(*g));
+}
+
+//glyph_add: append 'count' vertices of colour 'rgba' to 'b', and return the first of them
+static glyph_vertex *glyph_add(glyph_buffer *b, int count, const unsigned char *rgba)
+{
+	glyph_vertex *v;
+	int k;
+
+	if (b->count + count > b->capacity)
+	{
+		b->capacity = (b->capacity) ? 2 * b->capacity : 64 * count;
+		if (b->capacity < b->count + count) b->capacity = b->count + count;
+		b->v = (glyph_vertex*) realloc(b->v, b->capacity * sizeof(glyph_vertex));
+	}
+	v = b->v + b->count;
+	b->count += count;
+	for (k = 0; k < count; k++)
+		memcpy(v[k].rgba, rgba, 4);
+	return v;
+}
+
+//glyph_build: build the glyphs of the n x n field (vx,vy), drawn with grid point (i,j) at (wn+i*wn, hn+j*hn), for
+//             the part of it in 'view', with nx x ny glyphs over the window. A glyph is 'scale' pixels long per
+//             unit of speed and coloured with vector_color(method). When 'range' is given, the speeds of all
+//             glyphs (also the skipped ones) are added to it; the caller brackets the build with range_begin/end.
+void glyph_build(glyph_set *g, int n, const fftw_real *vx, const fftw_real *vy, float wn, float hn,
+                 const camera *view, int nx, int ny, float scale, int method, auto_range *range)
+{
+	float gw, gh, spacing, x0, y0, x1, y1, length = scale / view->zoom, r = GLYPH_RADIUS / view->zoom;
+	int k0, k1, l0, l1, ntx, nty, t;
+
+	if (g->lod)                                         //thin out a lattice denser than the points can show
+	{
+		if (view->width < nx * g->min_spacing) nx = (int)(view->width / g->min_spacing);
+		if (view->height < ny * g->min_spacing) ny = (int)(view->height / g->min_spacing);
+		if (nx < 1) nx = 1;
+		if (ny < 1) ny = 1;
+	}
+	gw = view->width / (nx * view->zoom);               //lattice spacing
+	gh = view->height / (ny * view->zoom);
+	spacing = (view->width * ny < view->height * nx) ? (float)view->width / nx : (float)view->height / ny;
+
+	camera_visible(view, &x0, &y0, &x1, &y1);           //the glyphs k0..k1 x l0..l1 have their centre in the view
+	k0 = clamp(x0 / gw - 0.5f) + 1; k1 = clamp(x1 / gw - 0.5f);
+	l0 = clamp(y0 / gh - 0.5f) + 1; l1 = clamp(y1 / gh - 0.5f);
+	ntx = k1 / GLYPH_TILE - k0 / GLYPH_TILE + 1;
+	nty = l1 / GLYPH_TILE - l0 / GLYPH_TILE + 1;
+
+	g->ntiles = ntx * nty;
+	if (g->ntiles > g->capacity)
+	{
+		g->tiles = (glyph_tile*) realloc(g->tiles, g->ntiles * sizeof(glyph_tile));
+		memset(g->tiles + g->capacity, 0, (g->ntiles - g->capacity) * sizeof(glyph_tile));
+		g->capacity = g->ntiles;
+	}
+
+#pragma omp parallel for schedule(dynamic)
+	for (t = 0; t < g->ntiles; t++)
+	{
+		glyph_tile *tile = g->tiles + t;
+		field_stats *stats = range ? range_stats(range, omp_get_thread_num()) : 0;
+		int ka = (k0 / GLYPH_TILE + t % ntx) * GLYPH_TILE, la = (l0 / GLYPH_TILE + t / ntx) * GLYPH_TILE;
+		int kb = (ka + GLYPH_TILE - 1 < k1) ? ka + GLYPH_TILE - 1 : k1, lb = (la + GLYPH_TILE - 1 < l1) ? la + GLYPH_TILE - 1 : l1;
+		int k, l, s;
+
+		if (ka < k0) ka = k0;
+		if (la < l0) la = l0;
+		tile->cones.count = tile->lines.count = tile->points.count = tile->culled = 0;
+		for (l = la; l <= lb; l++)
+			for (k = ka; k <= kb; k++)
+			{
+				float x = (k + 0.5f) * gw, y = (l + 0.5f) * gh, R, G, B, speed, pixels;
+				float u = (float)sample_field(vx, n, x / wn - 1, y / hn - 1);
+				float v = (float)sample_field(vy, n, x / wn - 1, y / hn - 1);
+				unsigned char rgba[4];
+				glyph_vertex *p;
+
+				speed = (float)sqrt(u * u + v * v);
+				pixels = scale * speed;
+				if (range) range_add(range, stats, speed);
+				if (g->lod && pixels < g->min_length)
+				{
+					tile->culled++;
+					continue;
+				}
+				vector_color(u, v, method, &R, &G, &B);
+				rgba[0] = (unsigned char)(255 * R); rgba[1] = (unsigned char)(255 * G);
+				rgba[2] = (unsigned char)(255 * B); rgba[3] = 255;
+
+				if (g->lod && (spacing < g->point_spacing || pixels < 2))
+				{
+					p = glyph_add(&tile->points, 1, rgba);
+					p->x = x; p->y = y;
+				}
+				else if (g->lod && (spacing < g->line_spacing || pixels < GLYPH_RADIUS))
+				{
+					p = glyph_add(&tile->lines, 2, rgba);
+					p[0].x = x; p[0].y = y;
+					p[1].x = x + length * u; p[1].y = y + length * v;
+				}
+				else                                    //a fan of triangles from the tip to the base
+				{
+					p = glyph_add(&tile->cones, 3 * GLYPH_SEGMENTS, rgba);
+					for (s = 0; s < GLYPH_SEGMENTS; s++, p += 3)
+					{
+						p[0].x = x + length * u;            p[0].y = y + length * v;
+						p[1].x = x + r * g->base[s][0];     p[1].y = y + r * g->base[s][1];
+						p[2].x = x + r * g->base[s + 1][0]; p[2].y = y + r * g->base[s + 1][1];
+					}
+				}
+			}
+	}
+}
+
+//glyph_buffer_draw: draw the vertices of 'b' as primitives of type 'mode'
+static void glyph_buffer_draw(const glyph_buffer *b, GLenum mode)
+{
+	if (b->count == 0) return;
+	glVertexPointer(2, GL_FLOAT, sizeof(glyph_vertex), &b->v[0].x);
+	glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(glyph_vertex), b->v[0].rgba);
+	glDrawArrays(mode, 0, b->count);
+}
+
+//glyph_draw: draw the glyphs of the last build
+void glyph_draw(const glyph_set *g)
+{
+	int t;
+
+	glPointSize(2);
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_COLOR_ARRAY);
+	for (t = 0; t < g->ntiles; t++)
+	{
+		glyph_buffer_draw(&g->tiles[t].cones, GL_TRIANGLES);
+		glyph_buffer_draw(&g->tiles[t].lines, GL_LINES);
+		glyph_buffer_draw(&g->tiles[t].points, GL_POINTS);
+	}
+	glDisableClientState(GL_COLOR_ARRAY);
+	glDisableClientState(GL_VERTEX_ARRAY);
+	glPointSize(1);
+}
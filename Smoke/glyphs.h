@@ -0,0 +1,57 @@
+// glyphs.h: Hedgehogs of a vector field, with level of detail. The glyphs sit on a lattice that is fixed in the
+//           domain, with a spacing on the screen of window size / (nx,ny) pixels at any zoom, so only the lattice
+//           points in the visible part of the view are generated and a pan does not move them. The lattice is
+//           cut into tiles of GLYPH_TILE x GLYPH_TILE glyphs, which are built in parallel (one tile per thread at a
+//           time) into vertex arrays of their own. Glyphs shorter than min_length pixels are skipped; the others
+//           are drawn as points, lines or cones, depending on their length and spacing on the screen, and a
+//           lattice denser than min_spacing pixels is thinned, so the work is bounded by the window size.
+//--------------------------------------------------------------------------------------------------
+
+#ifndef GLYPHS_H
+#define GLYPHS_H
+
+#include <rfftw.h>
+#include "camera.h"
+#include "stats.h"
+
+#define GLYPH_TILE 16           //glyphs per side of a tile
+#define GLYPH_SEGMENTS 12       //segments of the base of a cone
+#define GLYPH_RADIUS 4          //radius of the base of a cone, in pixels
+
+typedef struct
+{
+	float x, y;
+	unsigned char rgba[4];
+} glyph_vertex;
+
+typedef struct
+{
+	glyph_vertex *v;
+	int count, capacity;
+} glyph_buffer;
+
+typedef struct
+{
+	glyph_buffer cones, lines, points;  //vertices of triangles, line segments and points
+	int culled;                 //glyphs of the tile skipped for their length
+} glyph_tile;
+
+typedef struct
+{
+	int lod;                    //use level of detail and culling, or draw every glyph as a cone
+	float min_length;           //glyphs shorter than this are skipped, in pixels
+	float min_spacing;          //denser lattices are thinned to this spacing, in pixels
+	float point_spacing;        //glyphs closer together than this are drawn as points, in pixels
+	float line_spacing;         //glyphs closer together than this are drawn as lines, in pixels
+	float base[GLYPH_SEGMENTS + 1][2];  //unit circle of the cone bases
+	int ntiles, capacity;
+	glyph_tile *tiles;
+} glyph_set;
+
+void glyph_init(glyph_set *g);
+void glyph_free(glyph_set *g);
+void glyph_build(glyph_set *g, int n, const fftw_real *vx, const fftw_real *vy, float wn, float hn,
+                 const camera *view, int nx, int ny, float scale, int method, auto_range *range);
+void glyph_draw(const glyph_set *g);
+
+#endif
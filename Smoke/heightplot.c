@@ -0,0 +1,192 @@
+// heightplot.c: Height plots (see heightplot.h).
+//--------------------------------------------------------------------------------------------------
+
+#include "heightplot.h"
+#include "parallel.h"
+#include <GL/glut.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HEIGHT_SSE2
+#include <emmintrin.h>
+#endif
+
+//allocate: (re)allocate the arrays for an n x n grid, and generate its triangles
+static void allocate(height_surface *s, int n)
+{
+	int i, j;
+
+	height_free(s);
+	s->n = n;
+	s->vertices  = (float*) malloc(3 * (size_t)n * n * sizeof(float));
+	s->normals   = (float*) malloc(3 * (size_t)n * n * sizeof(float));
+	s->heights   = (float*) malloc((size_t)n * n * sizeof(float));
+	s->colors    = (unsigned char*) malloc(4 * (size_t)n * n);
+	s->triangles = (unsigned int*) malloc(6 * (size_t)(n - 1) * (n - 1) * sizeof(unsigned int));
+	s->row_max   = (float*) malloc(n * sizeof(float));
+	for (j = 0; j < n - 1; j++)
+		for (i = 0; i < n - 1; i++)
+		{
+			unsigned int *t = s->triangles + 6 * (j * (n - 1) + i), idx0 = j * n + i;
+			t[0] = idx0; t[1] = idx0 + n; t[2] = idx0 + n + 1;
+			t[3] = idx0; t[4] = idx0 + n + 1; t[5] = idx0 + 1;
+		}
+	s->wn = s->hn = 0;
+}
+
+//normal: the unit normal (-gx,-gy,1)/|(-gx,-gy,1)| of the surface with gradient (gx,gy), into n[0..2]
+static __inline void normal(float gx, float gy, float *n)
+{
+	float length = sqrtf(gx * gx + gy * gy + 1);
+	n[0] = -gx / length;
+	n[1] = -gy / length;
+	n[2] = 1 / length;
+}
+
+#ifdef HEIGHT_SSE2
+//store_xyz4: store the 4 points with coordinates x, y and z as x0 y0 z0 x1 y1 z1 ... at 'out'
+static __inline void store_xyz4(float *out, __m128 x, __m128 y, __m128 z)
+{
+	__m128 xy01 = _mm_unpacklo_ps(x, y), xy23 = _mm_unpackhi_ps(x, y);                 //x0 y0 x1 y1, x2 y2 x3 y3
+	__m128 zx = _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0));                       //z0 z0 x1 x1
+	__m128 yz = _mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1));                       //y1 y1 z1 z1
+	__m128 xyz = _mm_shuffle_ps(xy23, z, _MM_SHUFFLE(3, 2, 3, 2));                   //x3 y3 z2 z3
+
+	_mm_storeu_ps(out, _mm_shuffle_ps(xy01, zx, _MM_SHUFFLE(2, 0, 1, 0)));           //x0 y0 z0 x1
+	_mm_storeu_ps(out + 4, _mm_shuffle_ps(yz, xy23, _MM_SHUFFLE(1, 0, 2, 0)));       //y1 z1 x2 y2
+	_mm_storeu_ps(out + 8, _mm_shuffle_ps(xyz, xyz, _MM_SHUFFLE(3, 1, 0, 2)));       //z2 x3 y3 z3
+}
+#endif
+
+//height_normals: the unit normals of the n x n surface 'heights' on cells of wn x hn, into 'normals' (3 floats per
+//                grid point). The gradient is taken with central differences, across the periodic boundary of the
+//                solver at the edges. The vectorized and the scalar loop give the same normals.
+void height_normals(const float *heights, int n, float wn, float hn, float *normals)
+{
+	float rx = 0.5f / wn, ry = 0.5f / hn;
+	int j;
+
+#pragma omp parallel for
+	for (j = 0; j < n; j++)
+	{
+		const float *h = heights + (size_t)n * j;
+		const float *below = heights + (size_t)n * ((j + n - 1) % n), *above = heights + (size_t)n * ((j + 1) % n);
+		float *out = normals + 3 * (size_t)n * j;
+		int i = 1;
+
+		normal(rx * (h[1 % n] - h[n - 1]), ry * (above[0] - below[0]), out);
+#ifdef HEIGHT_SSE2
+		{
+			const __m128 vrx = _mm_set1_ps(rx), vry = _mm_set1_ps(ry), one = _mm_set1_ps(1), sign = _mm_set1_ps(-0.0f);
+
+			for (; i + 4 <= n - 1; i += 4)
+			{
+				__m128 gx = _mm_mul_ps(vrx, _mm_sub_ps(_mm_loadu_ps(h + i + 1), _mm_loadu_ps(h + i - 1)));
+				__m128 gy = _mm_mul_ps(vry, _mm_sub_ps(_mm_loadu_ps(above + i), _mm_loadu_ps(below + i)));
+				__m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(gx, gx), _mm_mul_ps(gy, gy)), one));
+
+				store_xyz4(out + 3 * i, _mm_div_ps(_mm_xor_ps(gx, sign), length), _mm_div_ps(_mm_xor_ps(gy, sign), length),
+				           _mm_div_ps(one, length));
+			}
+		}
+#endif
+		for (; i < n - 1; i++)
+			normal(rx * (h[i + 1] - h[i - 1]), ry * (above[i] - below[i]), out + 3 * i);
+		if (n > 1)
+			normal(rx * (h[0] - h[n - 2]), ry * (above[n - 1] - below[n - 1]), out + 3 * (n - 1));
+	}
+}
+
+//height_update: Bring the surface up to date with the n x n field 'f': grid point (i,j) at (wn+i*wn, hn+j*hn), with
+//               t = offset + scale * value clamped to [0,1], raised by height * t and coloured with palette entry 255 * t
+void height_update(height_surface *s, int n, const fftw_real *f, float wn, float hn, float offset, float scale,
+                   float height, const unsigned char (*palette)[4])
+{
+	int i, j;
+
+	if (s->n != n)
+		allocate(s, n);
+	if (wn != s->wn || hn != s->hn)                 //the x and y only change with the size of the view
+	{
+		for (j = 0; j < n; j++)
+			for (i = 0; i < n; i++)
+			{
+				s->vertices[3 * (j * n + i)] = wn + (float)i * wn;
+				s->vertices[3 * (j * n + i) + 1] = hn + (float)j * hn;
+			}
+		s->wn = wn; s->hn = hn;
+	}
+
+#pragma omp parallel for private(i)
+	for (j = 0; j < n; j++)
+	{
+		float largest = 0;
+		for (i = 0; i < n; i++)
+		{
+			int idx = j * n + i;
+			float t = offset + scale * (float)f[idx];
+			float magnitude = (float)fabs(f[idx]);
+
+			if (magnitude > largest) largest = magnitude;
+			t = (t <= 0) ? 0 : (t >= 1) ? 1 : t;
+			memcpy(s->colors + 4 * idx, palette[(int)(255 * t + 0.5f)], 4);
+			s->heights[idx] = height * t;
+			s->vertices[3 * idx + 2] = s->heights[idx];
+		}
+		s->row_max[j] = largest;
+	}
+	s->max = 0;
+	for (j = 0; j < n; j++)
+		if (s->row_max[j] > s->max) s->max = s->row_max[j];
+
+	height_normals(s->heights, n, wn, hn, s->normals);
+}
+
+//height_draw: Draw the surface, lit by a light from the viewer's upper left, with the depth test on
+void height_draw(const height_surface *s)
+{
+	static const GLfloat direction[4] = { -0.3f, 0.5f, 1.0f, 0.0f }, ambient[4] = { 0.35f, 0.35f, 0.35f, 1.0f };
+	GLfloat white[4] = { 1, 1, 1, 1 };
+
+	if (s->n < 2) return;
+	glPushAttrib(GL_ENABLE_BIT | GL_LIGHTING_BIT | GL_POLYGON_BIT);
+	glPushMatrix();
+	glLoadIdentity();                               //the light stays put while the surface is tilted
+	glLightfv(GL_LIGHT0, GL_POSITION, direction);
+	glPopMatrix();
+	glLightfv(GL_LIGHT0, GL_DIFFUSE, white);
+	glLightModelfv(GL_LIGHT_MODEL_AMBIENT, ambient);
+	glLightModeli(GL_LIGHT_MODEL_TWO_SIDE, GL_TRUE);
+	glColorMaterial(GL_FRONT_AND_BACK, GL_AMBIENT_AND_DIFFUSE);
+	glEnable(GL_COLOR_MATERIAL);
+	glEnable(GL_LIGHTING);
+	glEnable(GL_LIGHT0);
+	glEnable(GL_DEPTH_TEST);
+	glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_NORMAL_ARRAY);
+	glEnableClientState(GL_COLOR_ARRAY);
+	glVertexPointer(3, GL_FLOAT, 0, s->vertices);
+	glNormalPointer(GL_FLOAT, 0, s->normals);
+	glColorPointer(4, GL_UNSIGNED_BYTE, 0, s->colors);
+	glDrawElements(GL_TRIANGLES, 6 * (s->n - 1) * (s->n - 1), GL_UNSIGNED_INT, s->triangles);
+	glDisableClientState(GL_COLOR_ARRAY);
+	glDisableClientState(GL_NORMAL_ARRAY);
+	glDisableClientState(GL_VERTEX_ARRAY);
+	glPopAttrib();
+}
+
+//height_free: Release the arrays of the surface
+void height_free(height_surface *s)
+{
+	free(s->vertices);
+	free(s->normals);
+	free(s->heights);
+	free(s->colors);
+	free(s->triangles);
+	free(s->row_max);
+	memset(s, 0, sizeof(*s));
+}
@@ -0,0 +1,33 @@
+// heightplot.h: Height plots (2.5D): a scalar field drawn as a shaded surface over the grid, each grid point raised
+//               by its value. The surface lives in vertex arrays that are kept from frame to frame: the triangles
+//               are generated once per grid size and the x and y of the vertices once per cell size, so an update
+//               only rewrites the heights, the colours and the normals. It does so in two parallel passes over the
+//               rows: the heights and colours from the field, then the normals from the central differences of the
+//               heights (four grid points at a time with SSE2 where available).
+//--------------------------------------------------------------------------------------------------
+
+#ifndef HEIGHTPLOT_H
+#define HEIGHTPLOT_H
+
+#include <rfftw.h>
+
+typedef struct
+{
+	int n;                      //grid size the arrays are for
+	float wn, hn;               //cell size the x and y of the vertices are for
+	float *vertices;            //x, y and height of every grid point
+	float *normals;             //unit normal of every grid point
+	float *heights;             //the heights again, contiguous, for the stencil of the normals
+	unsigned char *colors;      //RGBA of every grid point
+	unsigned int *triangles;    //two per cell
+	float *row_max;             //largest |value| of every row in the last update
+	float max;                  //largest |value| of the field in the last update
+} height_surface;
+
+void height_update(height_surface *s, int n, const fftw_real *f, float wn, float hn, float offset, float scale,
+                   float height, const unsigned char (*palette)[4]);
+void height_normals(const float *heights, int n, float wn, float hn, float *normals);
+void height_draw(const height_surface *s);
+void height_free(height_surface *s);
+
+#endif
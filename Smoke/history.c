@@ -0,0 +1,93 @@
+// history.c: Ring buffer of past velocity fields (see history.h).
+//--------------------------------------------------------------------------------------------------
+
+#include "history.h"
+#include <stdlib.h>
+#include <string.h>
+
+//history_init: keep the last 'capacity' n x n velocity fields, in 16-bit fixed point if 'compact' is set
+void history_init(velocity_history *h, int n, int capacity, int compact)
+{
+	size_t frame = (size_t)(n + 1) * (n + 1);
+
+	memset(h, 0, sizeof(*h));
+	h->n = n;
+	h->capacity = capacity;
+	h->compact = compact;
+	if (compact)
+	{
+		h->cx = (short*) malloc(capacity * frame * sizeof(short));
+		h->cy = (short*) malloc(capacity * frame * sizeof(short));
+		h->scale = (float*) malloc(capacity * sizeof(float));
+	}
+	else
+	{
+		h->vx = (float*) malloc(capacity * frame * sizeof(float));
+		h->vy = (float*) malloc(capacity * frame * sizeof(float));
+	}
+	h->dt = (float*) malloc(capacity * sizeof(float));
+}
+
+void history_free(velocity_history *h)
+{
+	free(h->vx); free(h->vy);
+	free(h->cx); free(h->cy); free(h->scale);
+	free(h->dt);
+	memset(h, 0, sizeof(*h));
+}
+
+//history_pack: store the n x n field 'f', times n, at 'out' ((n+1)^2, in fixed point if 'c' is set, with the
+//              scale 'scale'), with the periodic border
+static void history_pack(int n, const fftw_real *f, float *out, short *c, float scale)
+{
+	int m = n + 1, i, j;
+
+	for (j = 0; j < n; j++)
+	{
+		if (c)
+		{
+			float g = n / scale;
+			for (i = 0; i < n; i++)
+				c[i + m * j] = (short)floor(g * f[i + n * j] + 0.5f);
+			c[n + m * j] = c[m * j];
+		}
+		else
+		{
+			for (i = 0; i < n; i++)
+				out[i + m * j] = (float)(n * f[i + n * j]);
+			out[n + m * j] = out[m * j];
+		}
+	}
+	if (c) memcpy(c + m * n, c, m * sizeof(short));
+	else   memcpy(out + m * n, out, m * sizeof(float));
+}
+
+//history_push: store the n x n velocity field (vx,vy) of a step of length 'dt' as the newest frame, replacing the
+//              oldest one when the buffer is full
+void history_push(velocity_history *h, const fftw_real *vx, const fftw_real *vy, fftw_real dt)
+{
+	int n = h->n, slot = h->pushed % h->capacity, i;
+	size_t p = (size_t)slot * (n + 1) * (n + 1);
+
+	if (h->compact)
+	{
+		float big = 0;                          //the largest component is stored as 32767
+		for (i = 0; i < n * n; i++)
+		{
+			if (fabs(vx[i]) > big) big = (float)fabs(vx[i]);
+			if (fabs(vy[i]) > big) big = (float)fabs(vy[i]);
+		}
+		h->scale[slot] = (big > 0) ? n * big / 32767 : 1;
+		history_pack(n, vx, 0, h->cx + p, h->scale[slot]);
+		history_pack(n, vy, 0, h->cy + p, h->scale[slot]);
+	}
+	else
+	{
+		history_pack(n, vx, h->vx + p, 0, 0);
+		history_pack(n, vy, h->vy + p, 0, 0);
+	}
+
+	h->dt[slot] = (float)dt;
+	h->pushed++;
+	if (h->count < h->capacity) h->count++;
+}
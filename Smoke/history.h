@@ -0,0 +1,89 @@
+// history.h: Ring buffer of the velocity fields of the last simulation steps, for the visualizations that integrate
+//            through time (FTLE, pathlines). A frame is stored in grid units, with a periodic border, so that it
+//            can be interpolated at any grid coordinate without wrapping the indices. Optionally the frames are
+//            stored as 16-bit fixed point, with a scale per frame, which halves the memory of the buffer.
+//--------------------------------------------------------------------------------------------------
+
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include <rfftw.h>
+#include <math.h>
+
+typedef struct
+{
+	int n;                      //size of the grid
+	int capacity;               //number of frames kept
+	int count;                  //number of frames stored, at most 'capacity'
+	int pushed;                 //number of frames pushed since the start
+	int compact;                //frames are stored in (cx,cy) instead of (vx,vy)
+	float *vx, *vy;             //'capacity' frames of (n+1)^2 velocities, in grid cells per unit of time; column and
+	                            //row n repeat column and row 0
+	short *cx, *cy;             //the same, in 16-bit fixed point: velocity = scale * value
+	float *scale;               //scale of each compact frame
+	float *dt;                  //time step of each frame
+} velocity_history;
+
+void history_init(velocity_history *h, int n, int capacity, int compact);
+void history_free(velocity_history *h);
+void history_push(velocity_history *h, const fftw_real *vx, const fftw_real *vy, fftw_real dt);
+
+//history_slot: The slot of the frame pushed 'age' frames ago (0 is the newest); 'age' must be below 'count'
+static __inline int history_slot(const velocity_history *h, int age)
+{
+	return (h->pushed - 1 - age) % h->capacity;
+}
+
+//history_velocity: Bilinear interpolation of the velocity of slot 'slot' at grid coordinate (x,y), which may lie
+//                  outside [0,n): the domain is periodic
+static __inline void history_velocity(const velocity_history *h, int slot, float x, float y, float *u, float *v)
+{
+	int n = h->n, m = n + 1, i, j;
+	size_t p;
+	float s, t;
+
+	if (x < 0 || x >= n) x -= n * (float)floor(x / n);
+	if (y < 0 || y >= n) y -= n * (float)floor(y / n);
+	i = (int)x; if (i >= n) i = n - 1;          //x can round to n
+	j = (int)y; if (j >= n) j = n - 1;
+	s = x - i;
+	t = y - j;
+	p = (size_t)slot * m * m + i + m * j;
+	if (h->compact)
+	{
+		const short *pu = h->cx + p, *pv = h->cy + p;
+		float f = h->scale[slot];
+		*u = f * ((1-s)*((1-t)*pu[0]+t*pu[m])+s*((1-t)*pu[1]+t*pu[m+1]));
+		*v = f * ((1-s)*((1-t)*pv[0]+t*pv[m])+s*((1-t)*pv[1]+t*pv[m+1]));
+	}
+	else
+	{
+		const float *pu = h->vx + p, *pv = h->vy + p;
+		*u = (1-s)*((1-t)*pu[0]+t*pu[m])+s*((1-t)*pu[1]+t*pu[m+1]);
+		*v = (1-s)*((1-t)*pv[0]+t*pv[m])+s*((1-t)*pv[1]+t*pv[m+1]);
+	}
+}
+
+//history_velocity_at: The velocity at grid coordinate (x,y) at 'age' frames ago, which need not be a whole number:
+//                     linear interpolation in time between the two frames around it. Ages beyond the oldest frame
+//                     get the oldest frame.
+static __inline void history_velocity_at(const velocity_history *h, float age, float x, float y, float *u, float *v)
+{
+	int a = (int)age;
+	float f = age - a, u1, v1;
+
+	if (a >= h->count - 1)
+	{
+		history_velocity(h, history_slot(h, h->count - 1), x, y, u, v);
+		return;
+	}
+	history_velocity(h, history_slot(h, a), x, y, u, v);
+	if (f > 0)
+	{
+		history_velocity(h, history_slot(h, a + 1), x, y, &u1, &v1);
+		*u += f * (u1 - *u);
+		*v += f * (v1 - *v);
+	}
+}
+
+#endif
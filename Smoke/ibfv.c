@@ -0,0 +1,157 @@
+// ibfv.c: Image-based flow visualization in software (see ibfv.h).
+//
+//         Image pixel p lies at grid coordinate (p+0.5)*n/size-0.5, so grid point i is at pixel (i+0.5)*size/n-0.5.
+//         ibfv_warp runs the backtrace of the solver on every grid point and stores how far back, in pixels,
+//         the image must be sampled there; ibfv_step interpolates that displacement for every pixel, samples
+//         the previous image there and blends in the noise.
+//--------------------------------------------------------------------------------------------------
+
+#include "ibfv.h"
+#include "fluids.h"
+#include <GL/glut.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+//ibfv_warp: fill the mesh with the displacement of each grid point over the time 'dt', from the backtrace of the
+//           solver. The loop over a row has no dependencies and no wrapping; the periodic border is copied after.
+static void ibfv_warp(ibfv_image *b, int n, const fftw_real *vx, const fftw_real *vy, fftw_real dt)
+{
+	int m = n + 2, i, j;
+	float scale = (float)b->size / n;
+
+	if (b->n != n)
+	{
+		b->n = n;
+		free(b->warp_x); free(b->warp_y);
+		b->warp_x = (float*) malloc(m * m * sizeof(float));
+		b->warp_y = (float*) malloc(m * m * sizeof(float));
+	}
+
+#pragma omp parallel for private(i)
+	for (j = 0; j < n; j++)
+	{
+		float *wx = b->warp_x + 1 + m * (j + 1), *wy = b->warp_y + 1 + m * (j + 1);
+		const fftw_real *u = vx + n * j, *v = vy + n * j;
+		fftw_real y = (j + 0.5f) / n;
+
+		for (i = 0; i < n; i++)
+		{
+			fftw_real x = (i + 0.5f) / n;
+			wx[i] = (float)(backtrace(n, x, u[i], dt) - i) * scale;
+			wy[i] = (float)(backtrace(n, y, v[i], dt) - j) * scale;
+		}
+	}
+
+	for (j = 1; j <= n; j++)                    //periodic border: columns 0 and n+1, then rows 0 and n+1
+	{
+		b->warp_x[m * j] = b->warp_x[m * j + n];  b->warp_x[m * j + n + 1] = b->warp_x[m * j + 1];
+		b->warp_y[m * j] = b->warp_y[m * j + n];  b->warp_y[m * j + n + 1] = b->warp_y[m * j + 1];
+	}
+	memcpy(b->warp_x, b->warp_x + m * n, m * sizeof(float));
+	memcpy(b->warp_y, b->warp_y + m * n, m * sizeof(float));
+	memcpy(b->warp_x + m * (n + 1), b->warp_x + m, m * sizeof(float));
+	memcpy(b->warp_y + m * (n + 1), b->warp_y + m, m * sizeof(float));
+}
+
+//ibfv_noise: set the fresh noise of frame 'time': every noise cell switches between black and white with a
+//            period of 32 frames, starting at its own random phase
+static void ibfv_noise(ibfv_image *b, int time)
+{
+	int c;
+	for (c = 0; c < IBFV_NOISE_SIZE * IBFV_NOISE_SIZE; c++)
+		b->noise[c] = (fmod(time / 32.0 + b->phase[c], 1.0) < 0.5) ? 1.0f : 0.0f;
+}
+
+//ibfv_noise_at: the fresh noise at pixel (i,j)
+static float ibfv_noise_at(const ibfv_image *b, int i, int j)
+{
+	const int mask = IBFV_NOISE_SIZE - 1;
+	return b->noise[((j / IBFV_NOISE_CELL) & mask) * IBFV_NOISE_SIZE + ((i / IBFV_NOISE_CELL) & mask)];
+}
+
+void ibfv_init(ibfv_image *b, int size)
+{
+	int i;
+
+	memset(b, 0, sizeof(*b));
+	b->size = size;
+	b->alpha = 0.12f;
+	b->speed = 1;
+	b->image  = (float*) malloc(size * size * sizeof(float));
+	b->next   = (float*) malloc(size * size * sizeof(float));
+	b->pixels = (unsigned char*) malloc(size * size);
+	b->phase  = (float*) malloc(IBFV_NOISE_SIZE * IBFV_NOISE_SIZE * sizeof(float));
+	b->noise  = (float*) malloc(IBFV_NOISE_SIZE * IBFV_NOISE_SIZE * sizeof(float));
+	srand(2);
+	for (i = 0; i < IBFV_NOISE_SIZE * IBFV_NOISE_SIZE; i++)
+		b->phase[i] = rand() / (RAND_MAX + 1.0f);
+	ibfv_noise(b, 0);
+	for (i = 0; i < size * size; i++)
+		b->image[i] = ibfv_noise_at(b, i % size, i / size);
+}
+
+void ibfv_free(ibfv_image *b)
+{
+	free(b->image); free(b->next); free(b->pixels);
+	free(b->warp_x); free(b->warp_y);
+	free(b->phase); free(b->noise);
+	memset(b, 0, sizeof(*b));
+}
+
+//ibfv_step: advect the image over speed * dt with the flow (vx,vy) and blend in the noise of the next frame
+void ibfv_step(ibfv_image *b, int n, const fftw_real *vx, const fftw_real *vy, fftw_real dt)
+{
+	int size = b->size, mask = b->size - 1, m = n + 2, j;
+	float g = (float)n / size, a = b->alpha;
+	float *swap;
+
+	ibfv_warp(b, n, vx, vy, b->speed * dt);
+	ibfv_noise(b, ++b->time);
+
+#pragma omp parallel for
+	for (j = 0; j < size; j++)
+	{
+		float gy = (j + 0.5f) * g + 0.5f;       //grid coordinate of the row, +1 for the border of the mesh
+		int mj = (int)gy;
+		float t = gy - mj;
+		const float *wx = b->warp_x + m * mj, *wy = b->warp_y + m * mj;
+		float *out = b->next + size * j;
+		int i;
+
+		for (i = 0; i < size; i++)
+		{
+			float gx = (i + 0.5f) * g + 0.5f, s, dx, dy, x, y, fx, fy;
+			int mi = (int)gx, x0, y0, x1, y1;
+			const float *img = b->image;
+
+			s = gx - mi;
+			dx = (1-s)*((1-t)*wx[mi]+t*wx[mi+m])+s*((1-t)*wx[mi+1]+t*wx[mi+1+m]);
+			dy = (1-s)*((1-t)*wy[mi]+t*wy[mi+m])+s*((1-t)*wy[mi+1]+t*wy[mi+1+m]);
+
+			x = i + dx + size;                  //+size keeps the coordinate positive for the periodic mask
+			y = j + dy + size;
+			x0 = (int)x; fx = x - x0;
+			y0 = (int)y; fy = y - y0;
+			x1 = (x0 + 1) & mask; x0 &= mask;
+			y1 = (y0 + 1) & mask; y0 &= mask;
+
+			out[i] = (1 - a) * ((1-fx)*((1-fy)*img[x0+size*y0]+fy*img[x0+size*y1])+fx*((1-fy)*img[x1+size*y0]+fy*img[x1+size*y1]))
+			       + a * ibfv_noise_at(b, i, j);
+		}
+		for (i = 0; i < size; i++)
+			b->pixels[size * j + i] = (unsigned char)(255 * out[i]);
+	}
+
+	swap = b->image; b->image = b->next; b->next = swap;
+}
+
+//ibfv_draw: draw the image over the grid, which is drawn with grid point (i,j) at (wn+i*wn, hn+j*hn)
+void ibfv_draw(const ibfv_image *b, float wn, float hn)
+{
+	float zoom = camera_raster_pos(&view, 0.5f * wn, 0.5f * hn);
+	glPixelZoom(zoom * b->n * wn / b->size, zoom * b->n * hn / b->size);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glDrawPixels(b->size, b->size, GL_LUMINANCE, GL_UNSIGNED_BYTE, b->pixels);
+	glPixelZoom(1, 1);
+}
@@ -0,0 +1,36 @@
+// ibfv.h: Image-based flow visualization (van Wijk): a noise image is advected with the flow every frame and
+//         blended with a little fresh, time-varying noise, so that streaks appear along the flow.
+//         Done in software: the warp is computed on a mesh at grid resolution with the backtrace of the
+//         solver, and the image is then advected and blended row by row. The cost depends only on the image
+//         size and the grid size, not on the glyph settings.
+//--------------------------------------------------------------------------------------------------
+
+#ifndef IBFV_H
+#define IBFV_H
+
+#include <rfftw.h>
+
+#define IBFV_NOISE_SIZE 64      //size of the noise pattern, in noise cells (a power of two)
+#define IBFV_NOISE_CELL 2       //size of a noise cell, in image pixels
+
+typedef struct
+{
+	int size;                   //the image is size x size pixels (a power of two) and covers the whole grid
+	float *image, *next;        //current and next image, intensities in [0,1]
+	unsigned char *pixels;      //the current image, for drawing
+	int n;                      //size of the grid the mesh was set up for
+	float *warp_x, *warp_y;     //(n+2)^2 mesh: displacement of the image at each grid point, in pixels,
+	                            //with a periodic border
+	float *phase;               //random phase of each noise cell, generated once
+	float *noise;               //noise of the current frame, per noise cell
+	float alpha;                //weight of the fresh noise in the blend
+	float speed;                //the image is advected over speed * dt per frame
+	int time;                   //frames done, for the noise animation
+} ibfv_image;
+
+void ibfv_init(ibfv_image *b, int size);
+void ibfv_free(ibfv_image *b);
+void ibfv_step(ibfv_image *b, int n, const fftw_real *vx, const fftw_real *vy, fftw_real dt);
+void ibfv_draw(const ibfv_image *b, float wn, float hn);
+
+#endif
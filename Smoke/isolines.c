@@ -0,0 +1,298 @@
+// isolines.c: Marching-squares isoline extraction, split over threads by tiles of the grid.
+//
+//             Every grid vertex is first given a 'band': the number of iso-values that are <= its value.
+//             A cell is crossed by iso-value k exactly when some of its corners have band > k and others
+//             have band <= k, so the iso-values to march a cell for are found without testing all of them,
+//             and many iso-values cost little more than one. A tile whose min and max fall in the same band
+//             contains no isoline at all; it is skipped after the (cheap) min/max pass, which also compares the
+//             tile with its copy from the last sweep to find whether its segments can be kept.
+//--------------------------------------------------------------------------------------------------
+
+#include "isolines.h"
+#include "fluids.h"
+#include "parallel.h"
+#include <GL/glut.h>
+#include <stdlib.h>
+#include <string.h>
+
+//Edges of a cell, as pairs of corners. Corners are numbered counter-clockwise from (i,j):
+//0 = (i,j), 1 = (i+1,j), 2 = (i+1,j+1), 3 = (i,j+1); edge e runs from corner e to corner (e+1)%4.
+static const int iso_corner_dx[4] = { 0, 1, 1, 0 };
+static const int iso_corner_dy[4] = { 0, 0, 1, 1 };
+
+//Case table: for each combination of corners above the iso-value (bit c set for corner c), the edges
+//the segments connect; -1 ends the list. The saddles (5 and 10) are listed for a centre below the
+//iso-value and are flipped in iso_march_cell when the centre is above it.
+static const signed char iso_cases[16][5] =
+{
+	{ -1 },
+	{ 3, 0, -1 },
+	{ 0, 1, -1 },
+	{ 3, 1, -1 },
+	{ 1, 2, -1 },
+	{ 3, 0, 1, 2, -1 },
+	{ 0, 2, -1 },
+	{ 3, 2, -1 },
+	{ 2, 3, -1 },
+	{ 0, 2, -1 },
+	{ 0, 1, 2, 3, -1 },
+	{ 1, 2, -1 },
+	{ 1, 3, -1 },
+	{ 0, 1, -1 },
+	{ 3, 0, -1 },
+	{ -1 }
+};
+static const signed char iso_saddle_5[5]  = { 0, 1, 2, 3, -1 };
+static const signed char iso_saddle_10[5] = { 3, 0, 1, 2, -1 };
+
+
+//iso_band: number of iso-values <= v (binary search)
+static int iso_band(const float *values, int count, float v)
+{
+	int lo = 0, hi = count;
+	while (lo < hi)
+	{
+		int mid = (lo + hi) / 2;
+		if (values[mid] <= v) lo = mid + 1; else hi = mid;
+	}
+	return lo;
+}
+
+//iso_grow: make room for at least 'extra' more vertices in buffer 'b'. Buffers keep their capacity
+//          from frame to frame, so after the first few frames this never allocates.
+static void iso_grow(iso_buffer *b, int extra)
+{
+	if (b->count + extra <= b->capacity) return;
+	b->capacity = 2 * b->capacity + extra + 64;
+	b->v = (iso_vertex*) realloc(b->v, b->capacity * sizeof(iso_vertex));
+}
+
+//iso_march_cell: append the segments of iso-value 'k' in the cell with lower-left vertex (i,j).
+//                'f' holds the corner values and 'bits' which corners are above the iso-value.
+static void iso_march_cell(const iso_extractor *e, iso_buffer *b, int k, int i, int j, const float f[4], int bits)
+{
+	const signed char *edges = iso_cases[bits];
+	float iso = e->values[k];
+	int s;
+
+	if (bits == 5 || bits == 10)                //saddle: decide by the value at the centre of the cell
+	{
+		float centre = 0.25f * (f[0] + f[1] + f[2] + f[3]);
+		if (centre >= iso) edges = (bits == 5) ? iso_saddle_5 : iso_saddle_10;
+	}
+
+	iso_grow(b, 4);
+	for (s = 0; edges[s] >= 0; s++)
+	{
+		int c0 = edges[s], c1 = (c0 + 1) & 3;
+		float t = (iso - f[c0]) / (f[c1] - f[c0]);
+		iso_vertex *v = b->v + b->count++;
+
+		v->x = i + iso_corner_dx[c0] + t * (iso_corner_dx[c1] - iso_corner_dx[c0]);
+		v->y = j + iso_corner_dy[c0] + t * (iso_corner_dy[c1] - iso_corner_dy[c0]);
+		memcpy(v->rgba, e->colors[k], 4);
+	}
+}
+
+//iso_march_tile: compute the range of tile (tx,ty) and compare it with its copy from the last sweep. If it changed
+//                (or 'all' is set) and contains iso-values, march its cells into its buffer. Returns 0 if the tile
+//                contains no iso-value, 1 if it was marched, 2 if it kept the segments of the last sweep.
+static int iso_march_tile(iso_extractor *e, int n, const fftw_real *field, int tx, int ty, int all)
+{
+	unsigned char band[(ISO_TILE + 1) * (ISO_TILE + 1)];
+	int i0 = tx * ISO_TILE, j0 = ty * ISO_TILE;
+	int i1 = (i0 + ISO_TILE < n - 1) ? i0 + ISO_TILE : n - 1;      //last vertex of the tile
+	int j1 = (j0 + ISO_TILE < n - 1) ? j0 + ISO_TILE : n - 1;
+	int w = i1 - i0 + 1, h = j1 - j0 + 1;
+	int tile = ty * e->ntiles_x + tx, changed = all;
+	iso_buffer *b = e->tiles + tile;
+	float *copy = e->copies + (size_t)tile * (ISO_TILE + 1) * (ISO_TILE + 1);
+	float lo = (float)field[i0 + n * j0], hi = lo;
+	int i, j, k;
+
+	for (j = 0; j < h; j++)
+	{
+		const fftw_real *row = field + i0 + n * (j0 + j);
+		float *c = copy + w * j;
+		for (i = 0; i < w; i++)
+		{
+			float v = (float)row[i];
+			changed |= (c[i] != v);
+			c[i] = v;
+			lo = (v < lo) ? v : lo;
+			hi = (v > hi) ? v : hi;
+		}
+	}
+	e->tile_min[tile] = lo;
+	e->tile_max[tile] = hi;
+
+	if (!changed)
+		return b->count ? 2 : 0;
+	b->count = 0;
+	if (iso_band(e->values, e->nvalues, lo) == iso_band(e->values, e->nvalues, hi))
+		return 0;                               //no iso-value within the tile
+
+	for (k = 0; k < w * h; k++)
+		band[k] = (unsigned char)iso_band(e->values, e->nvalues, copy[k]);
+
+	for (j = 0; j < h - 1; j++)
+		for (i = 0; i < w - 1; i++)
+		{
+			const unsigned char *b0 = band + j * w + i;
+			const float *v0 = copy + j * w + i;
+			int c[4], blo, bhi;
+			float f[4];
+
+			c[0] = b0[0]; c[1] = b0[1]; c[2] = b0[w + 1]; c[3] = b0[w];
+			blo = c[0]; bhi = c[0];
+			for (k = 1; k < 4; k++)
+			{
+				if (c[k] < blo) blo = c[k];
+				if (c[k] > bhi) bhi = c[k];
+			}
+			if (blo == bhi) continue;
+
+			f[0] = v0[0]; f[1] = v0[1]; f[2] = v0[w + 1]; f[3] = v0[w];
+			for (k = blo; k < bhi; k++)
+			{
+				int bits = (c[0] > k) | (c[1] > k) << 1 | (c[2] > k) << 2 | (c[3] > k) << 3;
+				iso_march_cell(e, b, k, i0 + i, j0 + j, f, bits);
+			}
+		}
+	return 1;
+}
+
+//iso_init: set up an extractor with no iso-values; the per-tile data is allocated by the first iso_extract
+void iso_init(iso_extractor *e)
+{
+	memset(e, 0, sizeof(*e));
+	e->frame = -1;
+	e->dirty = 1;
+}
+
+void iso_free(iso_extractor *e)
+{
+	int t;
+	for (t = 0; t < e->ntiles_x * e->ntiles_y; t++) free(e->tiles[t].v);
+	free(e->tiles);
+	free(e->copies);
+	free(e->tile_min);
+	free(e->tile_max);
+	memset(e, 0, sizeof(*e));
+}
+
+//iso_set_values: use the given iso-values (at most ISO_MAX_VALUES, in increasing order). Setting the same values
+//                again keeps the segments of the tiles that do not change.
+void iso_set_values(iso_extractor *e, const float *values, int count)
+{
+	int k;
+	float R, G, B;
+
+	if (count > ISO_MAX_VALUES) count = ISO_MAX_VALUES;
+	if (count == e->nvalues && memcmp(values, e->values, count * sizeof(float)) == 0)
+		return;
+	e->nvalues = count;
+	for (k = 0; k < count; k++)
+	{
+		e->values[k] = values[k];
+		rainbow((count > 1) ? (float)k / (count - 1) : 0.5f, &R, &G, &B);
+		e->colors[k][0] = (unsigned char)(255 * R);
+		e->colors[k][1] = (unsigned char)(255 * G);
+		e->colors[k][2] = (unsigned char)(255 * B);
+		e->colors[k][3] = 255;
+	}
+	e->dirty = 1;
+}
+
+//iso_set_range: use 'count' iso-values evenly spaced strictly inside [lo,hi]
+void iso_set_range(iso_extractor *e, float lo, float hi, int count)
+{
+	float values[ISO_MAX_VALUES];
+	int k;
+
+	if (count > ISO_MAX_VALUES) count = ISO_MAX_VALUES;
+	for (k = 0; k < count; k++)
+		values[k] = lo + (hi - lo) * (k + 1) / (count + 1);
+	iso_set_values(e, values, count);
+}
+
+//iso_extract: extract the isolines of all iso-values from the n x n 'field' of simulation step 'frame'. Only the
+//             tiles whose values changed since the last sweep are marched again, unless the grid size or the
+//             iso-values changed. Calling it again for the same field and frame (e.g. when the animation is frozen)
+//             keeps the previous segments without looking at the field.
+void iso_extract(iso_extractor *e, int n, const fftw_real *field, int frame)
+{
+	int ntiles, t, all = e->dirty, marched = 0, kept = 0;
+
+	if (!e->dirty && e->n == n && e->field == field && e->frame == frame)
+		return;
+
+	if (e->n != n)
+	{
+		for (t = 0; t < e->ntiles_x * e->ntiles_y; t++) free(e->tiles[t].v);
+		free(e->tiles); free(e->copies);
+		free(e->tile_min); free(e->tile_max);
+		e->n = n;
+		e->ntiles_x = e->ntiles_y = (n - 1 + ISO_TILE - 1) / ISO_TILE;
+		ntiles = e->ntiles_x * e->ntiles_y;
+		e->tiles = (iso_buffer*) calloc(ntiles, sizeof(iso_buffer));
+		e->copies = (float*) malloc((size_t)ntiles * (ISO_TILE + 1) * (ISO_TILE + 1) * sizeof(float));
+		e->tile_min = (float*) malloc(ntiles * sizeof(float));
+		e->tile_max = (float*) malloc(ntiles * sizeof(float));
+		all = 1;                                //the copies are not filled yet
+	}
+
+	ntiles = e->ntiles_x * e->ntiles_y;
+#pragma omp parallel for schedule(dynamic) reduction(+:marched,kept)
+	for (t = 0; t < ntiles; t++)
+	{
+		int result = iso_march_tile(e, n, field, t % e->ntiles_x, t / e->ntiles_x, all);
+		marched += (result == 1);
+		kept += (result == 2);
+	}
+
+	e->field_min = e->tile_min[0];
+	e->field_max = e->tile_max[0];
+	for (t = 1; t < ntiles; t++)
+	{
+		if (e->tile_min[t] < e->field_min) e->field_min = e->tile_min[t];
+		if (e->tile_max[t] > e->field_max) e->field_max = e->tile_max[t];
+	}
+
+	e->tiles_marched = marched;
+	e->tiles_kept = kept;
+	e->field = field;
+	e->frame = frame;
+	e->dirty = 0;
+}
+
+int iso_segment_count(const iso_extractor *e)
+{
+	int t, count = 0;
+	for (t = 0; t < e->ntiles_x * e->ntiles_y; t++) count += e->tiles[t].count / 2;
+	return count;
+}
+
+//iso_draw: draw the segments of the last sweep, with grid vertex (i,j) at window position (wn+i*wn, hn+j*hn)
+//          like the smoke. The tile buffers are drawn straight from memory as vertex arrays.
+void iso_draw(const iso_extractor *e, float wn, float hn)
+{
+	int t;
+
+	glPushMatrix();
+	glTranslatef(wn, hn, 0);
+	glScalef(wn, hn, 1);
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_COLOR_ARRAY);
+	for (t = 0; t < e->ntiles_x * e->ntiles_y; t++)
+	{
+		const iso_buffer *b = e->tiles + t;
+		if (b->count == 0) continue;
+		glVertexPointer(2, GL_FLOAT, sizeof(iso_vertex), &b->v[0].x);
+		glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(iso_vertex), b->v[0].rgba);
+		glDrawArrays(GL_LINES, 0, b->count);
+	}
+	glDisableClientState(GL_COLOR_ARRAY);
+	glDisableClientState(GL_VERTEX_ARRAY);
+	glPopMatrix();
+}
@@ -0,0 +1,55 @@
+// isolines.h: Marching-squares isoline extraction for the scalar fields of the simulation.
+//             The grid is cut into square tiles that are handed out to the threads; each tile keeps its
+//             segments in its own buffer, so no locking is needed. All iso-values are extracted in the same
+//             sweep over the field. The segments and a copy of the values of every tile are kept from sweep to
+//             sweep: a tile whose values did not change keeps its segments, so a sweep only marches the tiles
+//             that changed (all of them when the iso-values change).
+//--------------------------------------------------------------------------------------------------
+
+#ifndef ISOLINES_H
+#define ISOLINES_H
+
+#include <rfftw.h>
+
+#define ISO_MAX_VALUES 64       //maximum number of iso-values extracted at once
+#define ISO_TILE       32       //size of a tile (the unit of work of a thread), in cells
+
+typedef struct
+{
+	float x, y;                 //position, in grid coordinates
+	unsigned char rgba[4];      //colour of the iso-value this vertex lies on
+} iso_vertex;
+
+typedef struct
+{
+	iso_vertex *v;              //segments, as pairs of vertices
+	int count, capacity;        //number of vertices used and allocated
+} iso_buffer;
+
+typedef struct
+{
+	int n;                      //size of the grid the tile data was set up for
+	int ntiles_x, ntiles_y;     //number of tiles in each direction
+	float *tile_min, *tile_max; //value range of each tile in the last sweep
+	int nvalues;                //number of iso-values
+	float values[ISO_MAX_VALUES];           //the iso-values, in increasing order
+	unsigned char colors[ISO_MAX_VALUES][4];//colour of each iso-value
+	float field_min, field_max; //value range of the whole field in the last sweep
+	iso_buffer *tiles;          //segments of each tile
+	float *copies;              //values of each tile in the last sweep, (ISO_TILE+1)^2 per tile
+	const fftw_real *field;     //field and frame of the last sweep, to detect a rerun on the same data
+	int frame;
+	int dirty;                  //iso-values changed since the last sweep
+	int tiles_marched;          //statistics of the last sweep: tiles that contained an iso-value and were marched,
+	int tiles_kept;             //and that kept their segments
+} iso_extractor;
+
+void iso_init(iso_extractor *e);
+void iso_free(iso_extractor *e);
+void iso_set_values(iso_extractor *e, const float *values, int count);
+void iso_set_range(iso_extractor *e, float lo, float hi, int count);
+void iso_extract(iso_extractor *e, int n, const fftw_real *field, int frame);
+int  iso_segment_count(const iso_extractor *e);
+void iso_draw(const iso_extractor *e, float wn, float hn);
+
+#endif
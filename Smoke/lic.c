@@ -0,0 +1,244 @@
+// lic.c: Fast Line Integral Convolution (see lic.h).
+//
+//        For a pixel that is not yet hit often enough, a streamline of 2*(L+M)+1 points, one pixel apart, is
+//        traced through its centre. The box filter of half length L is then evaluated at the central 2*M+1
+//        points at once from the prefix sums of the noise along the line (a difference of two prefix sums per
+//        point, a loop without dependencies), and each value is added to the pixel its point falls in.
+//        Threads own tiles of the image; a streamline only writes to pixels of its own tile, so the tiles
+//        can be computed in parallel without locking.
+//--------------------------------------------------------------------------------------------------
+
+#include "lic.h"
+#include "fluids.h"
+#include "parallel.h"
+#include <GL/glut.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+//lic_velocity: direction of the flow at pixel position (x,y), as a unit vector in pixels. Grid point (i,j) is at
+//              pixel (wn+i*wn, hn+j*hn), i.e. at (i+1,j+1) in the padded copy of the velocity, whose border
+//              already holds the periodic wrap of the solver; so the bilinear interpolation needs no wrapping.
+static int lic_velocity(const lic_image *l, float wn, float hn, float x, float y, float *u, float *v)
+{
+	int m = l->n + 2, i, j;
+	float gx = x / wn, gy = y / hn, s, t, a, b, len;
+	const float *pu, *pv;
+
+	if (gx >= m - 1) gx = m - 1.001f;           //only when the grid is drawn smaller than the window
+	if (gy >= m - 1) gy = m - 1.001f;
+	i = (int)gx; s = gx - i;
+	j = (int)gy; t = gy - j;
+	pu = l->pu + i + m * j;
+	pv = l->pv + i + m * j;
+	a = (1-s)*((1-t)*pu[0]+t*pu[m])+s*((1-t)*pu[1]+t*pu[m+1]);
+	b = (1-s)*((1-t)*pv[0]+t*pv[m])+s*((1-t)*pv[1]+t*pv[m+1]);
+	len = a * a + b * b;
+	if (len < 1e-30f) return 0;
+	len = 1.0f / (float)sqrt(len);
+	*u = a * len;
+	*v = b * len;
+	return 1;
+}
+
+//lic_pad: copy the n x n velocity into the padded (n+2)^2 arrays, scaled to pixels
+static void lic_pad(lic_image *l, int n, const fftw_real *vx, const fftw_real *vy, float wn, float hn)
+{
+	int m = n + 2, i, j;
+
+	if (l->n != n)
+	{
+		l->n = n;
+		free(l->pu); free(l->pv);
+		l->pu = (float*) malloc(m * m * sizeof(float));
+		l->pv = (float*) malloc(m * m * sizeof(float));
+	}
+#pragma omp parallel for private(i)
+	for (j = 0; j < m; j++)
+	{
+		int j0, j1;
+		fftw_real t;
+		wrap(n, (fftw_real)(j - 1), &j0, &j1, &t);
+		for (i = 0; i < m; i++)
+		{
+			int i0, i1;
+			fftw_real s;
+			wrap(n, (fftw_real)(i - 1), &i0, &i1, &s);
+			l->pu[i + m * j] = (float)vx[i0 + n * j0] * wn;
+			l->pv[i + m * j] = (float)vy[i0 + n * j0] * hn;
+		}
+	}
+}
+
+//lic_trace: trace 'steps' one-pixel steps (RK2) from position (x[0],y[0]) in direction 'dir' (+1 or -1),
+//           storing the points at x[dir*k], y[dir*k]. Returns the number of steps made before leaving the
+//           image or reaching a point where the flow stands still.
+static int lic_trace(const lic_image *l, float wn, float hn, float *x, float *y, int dir, int steps)
+{
+	int k;
+	for (k = 1; k <= steps; k++)
+	{
+		float px = x[dir * (k - 1)], py = y[dir * (k - 1)], u, v, mx, my;
+
+		if (!lic_velocity(l, wn, hn, px, py, &u, &v)) break;
+		mx = px + 0.5f * dir * u;
+		my = py + 0.5f * dir * v;
+		if (!lic_velocity(l, wn, hn, mx, my, &u, &v)) break;
+		px += dir * u;
+		py += dir * v;
+		if (px < 0 || py < 0 || px >= l->width || py >= l->height) break;
+		x[dir * k] = px;
+		y[dir * k] = py;
+	}
+	return k - 1;
+}
+
+//lic_streamline: trace the streamline through the centre of pixel (i,j) and splat the convolution along it
+//                into the pixels of the tile [ti0,ti1) x [tj0,tj1)
+static void lic_streamline(lic_image *l, lic_scratch *sc, float wn, float hn,
+                           int i, int j, int ti0, int ti1, int tj0, int tj1)
+{
+	int N = l->length + l->extra, L = l->length;
+	float *x = sc->x + N, *y = sc->y + N;     //indexed from -N to N
+	float *prefix = sc->prefix, *value = sc->value;
+	int back, fwd, lo, hi, k;
+	const int mask = LIC_NOISE_SIZE - 1;
+
+	x[0] = i + 0.5f;
+	y[0] = j + 0.5f;
+	fwd  = lic_trace(l, wn, hn, x, y,  1, N);
+	back = lic_trace(l, wn, hn, x, y, -1, N);
+
+	//prefix[k+back] = sum of the noise over the points -back .. k-1
+	prefix[0] = 0;
+	for (k = -back; k <= fwd; k++)
+		prefix[k + back + 1] = prefix[k + back] + l->noise[((int)y[k] & mask) * LIC_NOISE_SIZE + ((int)x[k] & mask)];
+
+	//box filter at the central points; near the ends of a truncated streamline, the filter is shortened
+	lo = (-back > -l->extra) ? -back : -l->extra;
+	hi = (fwd < l->extra) ? fwd : l->extra;
+	for (k = lo; k <= hi; k++)
+	{
+		int a = (k - L > -back) ? k - L : -back;
+		int b = (k + L < fwd) ? k + L : fwd;
+		value[k - lo] = (prefix[b + back + 1] - prefix[a + back]) / (b - a + 1);
+	}
+
+	for (k = lo; k <= hi; k++)
+	{
+		int pi = (int)x[k], pj = (int)y[k], p;
+		if (pi < ti0 || pi >= ti1 || pj < tj0 || pj >= tj1) continue;
+		p = pj * l->width + pi;
+		l->accum[p] += value[k - lo];
+		l->hits[p]++;
+	}
+}
+
+//lic_grow_scratch: make sure there is a scratch buffer for every thread
+static void lic_grow_scratch(lic_image *l)
+{
+	int t, N = l->length + l->extra, nthreads = omp_get_max_threads();
+
+	if (nthreads <= l->nscratch) return;
+	l->scratch = (lic_scratch*) realloc(l->scratch, nthreads * sizeof(lic_scratch));
+	for (t = l->nscratch; t < nthreads; t++)
+	{
+		l->scratch[t].x = (float*) malloc((2 * N + 1) * sizeof(float));
+		l->scratch[t].y = (float*) malloc((2 * N + 1) * sizeof(float));
+		l->scratch[t].prefix = (float*) malloc((2 * N + 2) * sizeof(float));
+		l->scratch[t].value = (float*) malloc((2 * N + 1) * sizeof(float));
+	}
+	l->nscratch = nthreads;
+}
+
+void lic_init(lic_image *l, int length, int extra)
+{
+	int i;
+
+	memset(l, 0, sizeof(*l));
+	l->length = length;
+	l->extra = extra;
+	l->min_hits = 1;
+	l->noise = (float*) malloc(LIC_NOISE_SIZE * LIC_NOISE_SIZE * sizeof(float));
+	srand(1);
+	for (i = 0; i < LIC_NOISE_SIZE * LIC_NOISE_SIZE; i++)
+		l->noise[i] = (rand() & 1) ? 1.0f : 0.0f;
+
+	lic_grow_scratch(l);
+}
+
+void lic_free(lic_image *l)
+{
+	int t;
+	for (t = 0; t < l->nscratch; t++)
+	{
+		free(l->scratch[t].x); free(l->scratch[t].y);
+		free(l->scratch[t].prefix); free(l->scratch[t].value);
+	}
+	free(l->scratch);
+	free(l->noise);
+	free(l->pu); free(l->pv);
+	free(l->image); free(l->accum); free(l->hits);
+	memset(l, 0, sizeof(*l));
+}
+
+//lic_compute: compute the width x height LIC image of the n x n field (vx,vy), drawn with grid cells of
+//             wn x hn pixels
+void lic_compute(lic_image *l, int width, int height, float wn, float hn,
+                 int n, const fftw_real *vx, const fftw_real *vy)
+{
+	int ntx = (width + LIC_TILE - 1) / LIC_TILE, nty = (height + LIC_TILE - 1) / LIC_TILE;
+	float gain = (float)sqrt(2.0 * l->length + 1) / 3;   //stretch the contrast the filter averages away
+	int t;
+
+	if (width != l->width || height != l->height)
+	{
+		l->width = width;
+		l->height = height;
+		free(l->image); free(l->accum); free(l->hits);
+		l->image = (unsigned char*) malloc(width * height);
+		l->accum = (float*) malloc(width * height * sizeof(float));
+		l->hits = (unsigned short*) malloc(width * height * sizeof(unsigned short));
+	}
+	lic_grow_scratch(l);
+	lic_pad(l, n, vx, vy, wn, hn);
+
+#pragma omp parallel for schedule(dynamic)
+	for (t = 0; t < ntx * nty; t++)
+	{
+		lic_scratch *sc = l->scratch + omp_get_thread_num();
+		int i0 = (t % ntx) * LIC_TILE, j0 = (t / ntx) * LIC_TILE;
+		int i1 = (i0 + LIC_TILE < width) ? i0 + LIC_TILE : width;
+		int j1 = (j0 + LIC_TILE < height) ? j0 + LIC_TILE : height;
+		int i, j;
+
+		for (j = j0; j < j1; j++)
+		{
+			memset(l->accum + j * width + i0, 0, (i1 - i0) * sizeof(float));
+			memset(l->hits + j * width + i0, 0, (i1 - i0) * sizeof(unsigned short));
+		}
+		for (j = j0; j < j1; j++)
+			for (i = i0; i < i1; i++)
+				if (l->hits[j * width + i] < l->min_hits)
+					lic_streamline(l, sc, wn, hn, i, j, i0, i1, j0, j1);
+
+		for (j = j0; j < j1; j++)
+			for (i = i0; i < i1; i++)
+			{
+				int p = j * width + i;
+				float v = l->hits[p] ? l->accum[p] / l->hits[p] : 0.5f;
+				v = 0.5f + (v - 0.5f) * gain;
+				l->image[p] = (unsigned char)(v <= 0 ? 0 : v >= 1 ? 255 : 255 * v);
+			}
+	}
+}
+
+//lic_draw: draw the image over the whole window, magnified by the zoom of the view
+void lic_draw(const lic_image *l)
+{
+	float zoom = camera_raster_pos(&view, 0, 0);
+	glPixelZoom(zoom, zoom);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glDrawPixels(l->width, l->height, GL_LUMINANCE, GL_UNSIGNED_BYTE, l->image);
+	glPixelZoom(1, 1);
+}
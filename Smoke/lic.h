@@ -0,0 +1,44 @@
+// lic.h: Line Integral Convolution of the velocity field, computed on the CPU at window resolution.
+//        Uses fast LIC: every streamline traced is longer than the convolution filter, and the convolution
+//        is evaluated at all its points, so one streamline colours many pixels. The image is split into tiles
+//        that are computed by different threads.
+//--------------------------------------------------------------------------------------------------
+
+#ifndef LIC_H
+#define LIC_H
+
+#include <rfftw.h>
+
+#define LIC_NOISE_SIZE 256      //size of the (periodically repeated) white noise texture, a power of two
+#define LIC_TILE       64       //size of a tile, in pixels
+
+typedef struct
+{
+	float *x, *y;               //positions along the streamline
+	float *prefix;              //prefix sums of the noise along the streamline
+	float *value;               //convolved value at each point of the streamline
+} lic_scratch;
+
+typedef struct
+{
+	int width, height;          //size of the image, in pixels
+	unsigned char *image;       //the LIC image, one luminance byte per pixel, bottom row first
+	float *accum;               //sum of the convolved values that hit each pixel
+	unsigned short *hits;       //number of convolved values that hit each pixel
+	float *noise;               //LIC_NOISE_SIZE^2 white noise, generated once
+	int n;                      //size of the grid the padded velocity was set up for
+	float *pu, *pv;             //(n+2)^2 copy of the velocity (in pixels per unit time) with a periodic border
+	int length;                 //half length L of the box filter, in pixels
+	int extra;                  //streamlines extend 'extra' pixels beyond the filter in both directions
+	int min_hits;               //pixels hit this often are not used as streamline seeds any more
+	int nscratch;               //one scratch buffer per thread
+	lic_scratch *scratch;
+} lic_image;
+
+void lic_init(lic_image *l, int length, int extra);
+void lic_free(lic_image *l);
+void lic_compute(lic_image *l, int width, int height, float wn, float hn,
+                 int n, const fftw_real *vx, const fftw_real *vy);
+void lic_draw(const lic_image *l);
+
+#endif
@@ -0,0 +1,15 @@
+// parallel.h: OpenMP helpers for the visualization modules. Without OpenMP, the parallel loops simply
+//             run on one thread, and the per-thread buffers reduce to a single buffer.
+//--------------------------------------------------------------------------------------------------
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#ifdef _OPENMP
+#include <omp.h>
+#else
+#define omp_get_max_threads() 1
+#define omp_get_thread_num()  0
+#endif
+
+#endif
@@ -0,0 +1,227 @@
+// checkpoint_test.c: Test of the checkpoints of the solver (key W, or -checkpoint, in the simulation).
+//
+//                    checkpoint_test <file>      describe a checkpoint and check that it restores
+//                    checkpoint_test -self [n]   save the state of an n x n solver (512 by default) through the
+//                                                writer thread, restore it and compare every byte, then check that
+//                                                damaged, truncated and foreign files are rejected and leave the
+//                                                state alone
+//
+//                    Build: gcc -O2 -pthread -I.. -I../fftw-2.1.3/fftw -I../fftw-2.1.3/rfftw checkpoint_test.c
+//                           ../checkpoint.c -o checkpoint_test
+//--------------------------------------------------------------------------------------------------
+
+#include "../checkpoint.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *field_names[CHECKPOINT_FIELDS] = { "vx", "vy", "vx0", "vy0", "fx", "fy", "rho", "rho0" };
+
+//allocate: a state for an n x n grid, with the layout of the simulation (the velocities padded for the FFT)
+static void allocate(checkpoint_state *s, int n)
+{
+	int f;
+
+	memset(s, 0, sizeof(*s));
+	s->n = n;
+	for (f = 0; f < CHECKPOINT_FIELDS; f++)
+	{
+		s->count[f] = (f <= CHECKPOINT_VY0) ? (size_t)n * 2 * (n / 2 + 1) : (size_t)n * n;
+		s->fields[f] = (fftw_real*) calloc(s->count[f], sizeof(fftw_real));
+	}
+}
+
+static void release(checkpoint_state *s)
+{
+	int f;
+
+	for (f = 0; f < CHECKPOINT_FIELDS; f++)
+		free(s->fields[f]);
+}
+
+//fill: a different value in every position of every field, plus the parameters
+static void fill(checkpoint_state *s, fftw_real base)
+{
+	size_t i;
+	int f;
+
+	for (f = 0; f < CHECKPOINT_FIELDS; f++)
+		for (i = 0; i < s->count[f]; i++)
+			s->fields[f][i] = base + (fftw_real)(f + 1) / (fftw_real)(i + 3);
+	s->frame = 1234;
+	s->dt = 0.037;
+	s->visc = 0.0011;
+}
+
+//same: whether the fields and parameters of 'a' and 'b' are identical, to the bit
+static int same(const checkpoint_state *a, const checkpoint_state *b)
+{
+	int f;
+
+	if (a->frame != b->frame || a->dt != b->dt || a->visc != b->visc) return 0;
+	for (f = 0; f < CHECKPOINT_FIELDS; f++)
+		if (memcmp(a->fields[f], b->fields[f], a->count[f] * sizeof(fftw_real)) != 0)
+			return 0;
+	return 1;
+}
+
+static int write_file(const char *path, const unsigned char *data, size_t size)
+{
+	FILE *file = fopen(path, "wb");
+	int ok = file && fwrite(data, 1, size, file) == size;
+
+	if (file) ok = (fclose(file) == 0) && ok;
+	return ok ? 0 : -1;
+}
+
+static unsigned char *read_file(const char *path, size_t *size)
+{
+	FILE *file = fopen(path, "rb");
+	unsigned char *data;
+
+	if (!file) return 0;
+	fseek(file, 0, SEEK_END);
+	*size = (size_t)ftell(file);
+	fseek(file, 0, SEEK_SET);
+	data = (unsigned char*) malloc(*size);
+	if (fread(data, 1, *size, file) != *size)
+	{
+		free(data);
+		data = 0;
+	}
+	fclose(file);
+	return data;
+}
+
+//rejected: whether loading 'path' into 's' fails and leaves 's' as 'original'
+static int rejected(const char *what, const char *path, checkpoint_state *s, const checkpoint_state *original)
+{
+	int ok = checkpoint_load(path, s) != 0 && same(s, original);
+
+	printf("  %-28s %s\n", what, ok ? "rejected" : "FAILED");
+	return ok;
+}
+
+//describe: print the header of a checkpoint and restore it
+static int describe(const char *path)
+{
+	checkpoint_header h;
+	checkpoint_state s;
+	FILE *file = fopen(path, "rb");
+	int f, ok;
+
+	if (!file || fread(&h, sizeof(h), 1, file) != 1 || h.magic != CHECKPOINT_MAGIC)
+	{
+		fprintf(stderr, "%s is not a checkpoint\n", path);
+		return 1;
+	}
+	fclose(file);
+	printf("%s: version %u, %ux%u grid, %u-byte values, step %u, time step %g, viscosity %g, %llu bytes\n",
+	       path, h.version, h.n, h.n, h.precision, h.frame, h.dt, h.visc, h.size);
+	for (f = 0; f < CHECKPOINT_FIELDS && f < (int)h.fields; f++)
+		printf("  %-4s %llu values at %llu\n", field_names[f], h.count[f], h.offset[f]);
+	allocate(&s, (int)h.n);
+	ok = checkpoint_load(path, &s) == 0;
+	printf("restore: %s\n", ok ? "ok" : "FAILED");
+	release(&s);
+	return !ok;
+}
+
+//self_test: save, restore and compare; then damage the file in several ways and check that it is rejected
+static int self_test(int n)
+{
+	const char *path = "checkpoint_test.ckpt", *damaged = "checkpoint_test_damaged.ckpt";
+	checkpoint_writer writer;
+	checkpoint_state saved, restored, original, other;
+	unsigned char *image;
+	size_t size;
+	FILE *file;
+	int bad = 0;
+
+	allocate(&saved, n);
+	allocate(&restored, n);
+	allocate(&original, n);
+	fill(&saved, 1);
+
+	if (checkpoint_start(&writer, path) != 0 || checkpoint_save(&writer, &saved) != 0)
+	{
+		printf("FAILED: cannot write %s\n", path);
+		return 1;
+	}
+	checkpoint_stop(&writer);                   //waits for the checkpoint
+	file = fopen("checkpoint_test.ckpt.tmp", "rb");
+	if (file) fclose(file);
+	if (writer.written != 1 || writer.failed || file)
+	{
+		printf("FAILED: the checkpoint was not written and renamed\n");
+		bad++;
+	}
+	if (checkpoint_load(path, &restored) != 0 || !same(&saved, &restored))
+	{
+		printf("FAILED: the restored state differs from the saved one\n");
+		bad++;
+	}
+	else
+		printf("%dx%d: saved and restored, identical to the bit\n", n, n);
+
+	image = read_file(path, &size);
+	if (!image)
+	{
+		printf("FAILED: cannot read %s back\n", path);
+		return 1;
+	}
+	fill(&restored, 7);                         //a state the rejected loads must not touch
+	fill(&original, 7);
+
+	image[size - 1] ^= 0x10;                    //a flipped bit in the last field
+	write_file(damaged, image, size);
+	bad += !rejected("a flipped bit", damaged, &restored, &original);
+	image[size - 1] ^= 0x10;
+
+	write_file(damaged, image, size - 1);
+	bad += !rejected("a truncated file", damaged, &restored, &original);
+
+	write_file(damaged, image, CHECKPOINT_HEADER / 2);
+	bad += !rejected("a truncated header", damaged, &restored, &original);
+
+	image[0] ^= 0xFF;
+	write_file(damaged, image, size);
+	bad += !rejected("another magic number", damaged, &restored, &original);
+	image[0] ^= 0xFF;
+
+	allocate(&other, n + 2);                    //the state of another grid size
+	fill(&other, 7);
+	if (checkpoint_load(path, &other) == 0)
+	{
+		printf("  %-28s FAILED\n", "another grid size");
+		bad++;
+	}
+	else
+		printf("  %-28s rejected\n", "another grid size");
+	release(&other);
+
+	bad += !rejected("a missing file", "checkpoint_test_missing.ckpt", &restored, &original);
+
+	write_file(damaged, image, size);           //the undamaged copy restores again
+	if (checkpoint_load(damaged, &restored) != 0 || !same(&saved, &restored))
+		bad++;
+
+	printf("%s\n", bad ? "FAILED" : "ok");
+	free(image);
+	release(&saved);
+	release(&restored);
+	release(&original);
+	remove(path);
+	remove(damaged);
+	return bad != 0;
+}
+
+int main(int argc, char **argv)
+{
+	if (argc > 1 && strcmp(argv[1], "-self") == 0)
+		return self_test(argc > 2 ? atoi(argv[2]) : 512);
+	if (argc > 1)
+		return describe(argv[1]);
+	fprintf(stderr, "usage: checkpoint_test <file> | -self [n]\n");
+	return 1;
+}
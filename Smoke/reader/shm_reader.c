@@ -0,0 +1,138 @@
+// shm_reader.c: Reading frames from shared memory (see shm_reader.h).
+//--------------------------------------------------------------------------------------------------
+
+#include "shm_reader.h"
+#include <string.h>
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+//shm_reader_open: map the segment 'name' (SHM_NAME for the simulation) read-only. Returns 0 on success, -1 when there
+//                 is no segment (the simulation does not publish) or it has another layout version.
+int shm_reader_open(shm_reader *r, const char *name)
+{
+	const shm_header *h;
+
+	memset(r, 0, sizeof(*r));
+#ifdef _WIN32
+	r->mapping = OpenFileMappingA(FILE_MAP_READ, FALSE, name);
+	if (!r->mapping) return -1;
+	h = (const shm_header*) MapViewOfFile(r->mapping, FILE_MAP_READ, 0, 0, 0);
+	if (!h) { CloseHandle(r->mapping); return -1; }
+	{
+		MEMORY_BASIC_INFORMATION info;
+		VirtualQuery(h, &info, sizeof(info));
+		r->size = info.RegionSize;
+	}
+#else
+	{
+		struct stat st;
+		int fd = shm_open(name, O_RDONLY, 0);
+		void *p;
+
+		if (fd < 0) return -1;
+		if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(shm_header)) { close(fd); return -1; }
+		p = mmap(0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+		close(fd);
+		if (p == MAP_FAILED) return -1;
+		h = (const shm_header*) p;
+		r->size = st.st_size;
+	}
+#endif
+	r->header = h;
+	if (h->magic != SHM_MAGIC || h->version != SHM_VERSION
+	    || sizeof(shm_header) + (size_t)h->nslots * h->slot_size > r->size)
+	{
+		shm_reader_close(r);
+		return -1;
+	}
+	shm_barrier();
+	return 0;
+}
+
+void shm_reader_close(shm_reader *r)
+{
+	if (!r->header) return;
+#ifdef _WIN32
+	UnmapViewOfFile(r->header);
+	CloseHandle(r->mapping);
+#else
+	munmap((void*)r->header, r->size);
+#endif
+	r->header = 0;
+}
+
+//shm_reader_closed: whether the simulation stopped publishing into the segment (it may have started a new one, which
+//                   a new shm_reader_open maps)
+int shm_reader_closed(const shm_reader *r)
+{
+	return !r->header || r->header->closed;
+}
+
+//shm_reader_latest: point 'f' to the newest complete frame. Returns 0 when there is none yet.
+int shm_reader_latest(const shm_reader *r, shm_frame *f)
+{
+	const shm_header *h = r->header;
+	int attempt;
+
+	if (!h) return 0;
+	for (attempt = 0; attempt < 100; attempt++)
+	{
+		unsigned int s = h->latest;
+		const shm_slot *slot;
+
+		if (s == SHM_NONE) return 0;
+		slot = shm_slot_at(h, s);
+		f->seq = slot->seq;
+		if (f->seq & 1) continue;                       //being written: the simulation has moved on
+		shm_barrier();
+		f->slot = s;
+		f->frame = slot->frame;
+		f->dt = slot->dt;
+		f->dim = h->dim;
+		f->precision = h->precision;
+		f->vx = shm_field_at(h, s, 0);
+		f->vy = shm_field_at(h, s, 1);
+		f->rho = shm_field_at(h, s, 2);
+		if (shm_reader_valid(r, f)) return 1;
+	}
+	return 0;
+}
+
+//shm_reader_valid: whether the frame 'f' still held what shm_reader_latest found, i.e. everything read from it since
+//                  then is consistent
+int shm_reader_valid(const shm_reader *r, const shm_frame *f)
+{
+	shm_barrier();
+	return shm_slot_at(r->header, f->slot)->seq == f->seq;
+}
+
+//shm_reader_copy: copy the newest complete frame into the dim x dim arrays vx, vy and rho (any may be 0), as floats,
+//                 retrying when it is overwritten during the copy. Returns 0 when there is no frame yet.
+int shm_reader_copy(const shm_reader *r, shm_frame *f, float *vx, float *vy, float *rho)
+{
+	float *dst[SHM_FIELDS];
+	int attempt, k, i;
+
+	dst[0] = vx; dst[1] = vy; dst[2] = rho;
+	for (attempt = 0; attempt < 100; attempt++)
+	{
+		if (!shm_reader_latest(r, f)) return 0;
+		for (k = 0; k < SHM_FIELDS; k++)
+		{
+			const void *src = (k == 0) ? f->vx : (k == 1) ? f->vy : f->rho;
+			int count = f->dim * f->dim;
+			if (!dst[k]) continue;
+			if (f->precision == sizeof(float))
+				memcpy(dst[k], src, count * sizeof(float));
+			else
+				for (i = 0; i < count; i++)
+					dst[k][i] = (float)((const double*)src)[i];
+		}
+		if (shm_reader_valid(r, f)) return 1;
+	}
+	return 0;
+}
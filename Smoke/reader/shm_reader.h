@@ -0,0 +1,43 @@
+// shm_reader.h: Reading the frames the simulation publishes in shared memory (layout in ../shm_frames.h), from
+//               another process. The fields are used in place, without copies; the reader never blocks the
+//               simulation, it only retries when the simulation overwrote what it was reading.
+//
+//               shm_frame f;
+//               if (shm_reader_latest(&r, &f))
+//               {
+//                   ... use f.vx, f.vy, f.rho (f.precision bytes per value) ...
+//                   if (!shm_reader_valid(&r, &f)) ... the frame was overwritten meanwhile: discard the results ...
+//               }
+//--------------------------------------------------------------------------------------------------
+
+#ifndef SHM_READER_H
+#define SHM_READER_H
+
+#include "../shm_frames.h"
+
+typedef struct
+{
+	const shm_header *header;   //the mapped segment, or 0 when closed
+	size_t size;
+#ifdef _WIN32
+	HANDLE mapping;
+#endif
+} shm_reader;
+
+typedef struct
+{
+	unsigned int frame;         //simulation step
+	double dt;                  //time step that led to it
+	int dim, precision;         //the fields are dim x dim values of 'precision' bytes (4 float, 8 double)
+	const void *vx, *vy, *rho;  //the fields, in the shared memory
+	unsigned int slot, seq;     //where the frame is and the sequence number it had, for shm_reader_valid
+} shm_frame;
+
+int  shm_reader_open(shm_reader *r, const char *name);
+void shm_reader_close(shm_reader *r);
+int  shm_reader_closed(const shm_reader *r);
+int  shm_reader_latest(const shm_reader *r, shm_frame *f);
+int  shm_reader_valid(const shm_reader *r, const shm_frame *f);
+int  shm_reader_copy(const shm_reader *r, shm_frame *f, float *vx, float *vy, float *rho);
+
+#endif
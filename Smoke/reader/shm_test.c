@@ -0,0 +1,133 @@
+// shm_test.c: Test reader for the frames the simulation publishes in shared memory (key E in the simulation).
+//
+//             shm_test [seconds]  follow the running simulation: print every frame read, with the range of rho and
+//                                 the largest speed, and how often a frame was overwritten while it was read
+//             shm_test -self      publish frames in a segment of its own from one thread while another reads
+//                                 them, and check that every frame read is consistent (no mix of two frames)
+//
+//             Build: gcc -O2 -fopenmp -I.. -I../fftw-2.1.3/fftw -I../fftw-2.1.3/rfftw shm_test.c shm_reader.c
+//                    ../shm_export.c -o shm_test        (add -lrt on older glibc)
+//--------------------------------------------------------------------------------------------------
+
+#include "shm_reader.h"
+#include "../shm_export.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <omp.h>
+
+#ifdef _WIN32
+#define pause_ms(ms) Sleep(ms)
+#else
+#include <unistd.h>
+#define pause_ms(ms) usleep(1000 * (ms))
+#endif
+
+//value: value i of a field of 'precision' bytes per value
+static double value(const void *field, int precision, int i)
+{
+	return (precision == sizeof(float)) ? ((const float*)field)[i] : ((const double*)field)[i];
+}
+
+//follow: print the frames of the running simulation for 'seconds'
+static int follow(int seconds)
+{
+	shm_reader r;
+	shm_frame f;
+	unsigned int last = 0;
+	int polls, frames = 0, torn = 0;
+
+	if (shm_reader_open(&r, SHM_NAME) != 0)
+	{
+		fprintf(stderr, "no frames published under %s: start the simulation and press E\n", SHM_NAME);
+		return 1;
+	}
+	for (polls = 0; polls < 100 * seconds && !shm_reader_closed(&r); polls++, pause_ms(10))
+	{
+		double lo = 1e30, hi = -1e30, vmax = 0;
+		int i;
+
+		if (!shm_reader_latest(&r, &f) || (frames && f.frame == last)) continue;
+		for (i = 0; i < f.dim * f.dim; i++)
+		{
+			double rho = value(f.rho, f.precision, i), u = value(f.vx, f.precision, i), v = value(f.vy, f.precision, i);
+			if (rho < lo) lo = rho;
+			if (rho > hi) hi = rho;
+			if (u * u + v * v > vmax) vmax = u * u + v * v;
+		}
+		if (!shm_reader_valid(&r, &f)) { torn++; continue; }
+		printf("frame %u: %dx%d, %d bytes per value, rho in [%g, %g], largest speed %g\n",
+		       f.frame, f.dim, f.dim, f.precision, lo, hi, sqrt(vmax));
+		last = f.frame;
+		frames++;
+	}
+	printf("%d frames read, %d overwritten while reading%s\n", frames, torn,
+	       shm_reader_closed(&r) ? ", the simulation stopped publishing" : "");
+	shm_reader_close(&r);
+	return 0;
+}
+
+//self_test: one thread publishes frames whose values all equal their frame number, the other reads them in place
+//           and checks that every frame that shm_reader_valid accepts holds only its own frame number
+static int self_test(void)
+{
+	const char *name = SHM_NAME "_test";
+	const int n = 128, frames = 2000;
+	fftw_real *field = (fftw_real*) malloc(n * n * sizeof(fftw_real));
+	shm_export e;
+	int bad = 0, read = 0, torn = 0;
+
+	if (shm_export_open(&e, name, n, sizeof(fftw_real)) != 0)
+		return 1;
+	omp_set_num_threads(2);
+#pragma omp parallel sections
+	{
+#pragma omp section
+		{
+			int k, i;
+			for (k = 1; k <= frames; k++)
+			{
+				for (i = 0; i < n * n; i++)
+					field[i] = k;
+				shm_export_publish(&e, k, 0.4, field, field, field);
+			}
+			e.header->closed = 1;
+		}
+#pragma omp section
+		{
+			shm_reader r;
+			shm_frame f;
+			int i;
+
+			if (shm_reader_open(&r, name) == 0)
+			{
+				while (!shm_reader_closed(&r))
+				{
+					int mixed = 0;
+					if (!shm_reader_latest(&r, &f)) continue;
+					for (i = 0; i < n * n; i++)
+						mixed |= value(f.vx, f.precision, i) != f.frame || value(f.rho, f.precision, i) != f.frame;
+					if (!shm_reader_valid(&r, &f)) { torn++; continue; }
+					bad += mixed;
+					read++;
+				}
+				shm_reader_close(&r);
+			}
+			else
+				bad = -1;
+		}
+	}
+	shm_export_close(&e);
+	free(field);
+	printf("self test: %d frames published, %d read, %d overwritten while reading, %d inconsistent\n",
+	       frames, read, torn, bad);
+	return bad != 0;
+}
+
+int main(int argc, char **argv)
+{
+	if (argc > 1 && strcmp(argv[1], "-self") == 0)
+		return self_test();
+	return follow((argc > 1) ? atoi(argv[1]) : 10);
+}
@@ -0,0 +1,168 @@
+// snapshot_test.c: Test reader for the recordings of the simulation (key X, or -record, in the simulation).
+//
+//                  snapshot_test <file>        describe the recording, read all frames in order and 100 frames
+//                                              in random order, and print the reading speed
+//                  snapshot_test -self [n]     record 100 frames of moving n x n fields (512 by default), read
+//                                              them back in random order, and check the error bound of every value
+//
+//                  Build: gcc -O2 -fopenmp -I.. -I../fftw-2.1.3/fftw -I../fftw-2.1.3/rfftw snapshot_test.c
+//                         ../snapshot.c -o snapshot_test -lm
+//--------------------------------------------------------------------------------------------------
+
+#include "../snapshot.h"
+#include "../parallel.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#ifndef _OPENMP
+#include <time.h>
+#define omp_get_wtime() ((double)clock() / CLOCKS_PER_SEC)
+#endif
+
+static const char *field_names[SNAPSHOT_FIELDS] = { "vx", "vy", "fx", "fy", "rho" };
+
+static fftw_real *fields[SNAPSHOT_FIELDS];
+
+static void allocate(int n)
+{
+	int f;
+
+	for (f = 0; f < SNAPSHOT_FIELDS; f++)
+		fields[f] = (fftw_real*) calloc((size_t)n * n, sizeof(fftw_real));
+}
+
+//describe: read a recording
+static int describe(const char *path)
+{
+	snapshot_reader r;
+	snapshot_frame frame;
+	double start, sequential, random;
+	int f, k, n;
+
+	if (snapshot_reader_open(&r, path) != 0)
+	{
+		fprintf(stderr, "%s is not a recording\n", path);
+		return 1;
+	}
+	n = r.codec.header.n;
+	printf("%s: %d frames of %dx%d, a key frame every %u\n", path, r.count, n, n, r.codec.header.key_interval);
+	for (f = 0; f < SNAPSHOT_FIELDS; f++)
+		if (r.codec.header.tolerance[f] < 0)      printf("  %-3s not recorded\n", field_names[f]);
+		else if (r.codec.header.tolerance[f] == 0) printf("  %-3s exact\n", field_names[f]);
+		else                                        printf("  %-3s within %g\n", field_names[f], r.codec.header.tolerance[f]);
+	if (!r.count) return 0;
+
+	allocate(n);
+	start = omp_get_wtime();
+	for (k = 0; k < r.count; k++)
+		if (snapshot_read(&r, k, &frame, fields) != 0)
+		{
+			printf("frame %d is damaged\n", k);
+			return 1;
+		}
+	sequential = omp_get_wtime() - start;
+	printf("last step %u, time step %g\n", frame.frame, frame.dt);
+	start = omp_get_wtime();
+	for (k = 0; k < 100; k++)
+		if (snapshot_read(&r, rand() % r.count, &frame, fields) != 0)
+			return 1;
+	random = omp_get_wtime() - start;
+	printf("read in order: %.2f ms per frame; at random: %.2f ms per frame\n",
+	       1000 * sequential / r.count, 1000 * random / 100);
+	snapshot_reader_close(&r);
+	return 0;
+}
+
+//fill: the fields of frame t, into 'fields': a pattern of vortices that drifts and grows, and a force in one corner
+static void fill(int n, int t, fftw_real *const fields[SNAPSHOT_FIELDS])
+{
+	int i, j;
+
+	for (j = 0; j < n; j++)
+		for (i = 0; i < n; i++)
+		{
+			double x = (double)i / n, y = (double)j / n, a = 0.02 * t, k = 2 * 3.14159265358979;
+			double s = sin(k * (x + a)), c = cos(k * (2 * y - a));
+			fields[SNAPSHOT_VX][i + n * j] = (fftw_real)(0.05 * s * c);
+			fields[SNAPSHOT_VY][i + n * j] = (fftw_real)(-0.05 * cos(k * (x + a)) * sin(k * (2 * y - a)));
+			fields[SNAPSHOT_FX][i + n * j] = (fftw_real)((i < n / 8 && j < n / 8) ? 0.1 * sin(0.1 * t) : 0);
+			fields[SNAPSHOT_FY][i + n * j] = 0;
+			fields[SNAPSHOT_RHO][i + n * j] = (fftw_real)(5 + 5 * s * s * (1 + 0.01 * t) * exp(-4 * (y - 0.5) * (y - 0.5)));
+		}
+}
+
+//self_test: record, then read back at random and check every value against its tolerance
+static int self_test(int n)
+{
+	const char *path = "snapshot_test.snap";
+	const int frames = 100;
+	double tolerance[SNAPSHOT_FIELDS], worst[SNAPSHOT_FIELDS] = { 0 }, coding = 0, decoding = 0, start;
+	fftw_real *decoded[SNAPSHOT_FIELDS];
+	snapshot_recorder recorder;
+	snapshot_reader r;
+	snapshot_frame frame;
+	int f, k, i, bad = 0;
+
+	snapshot_default_tolerances(tolerance);
+	tolerance[SNAPSHOT_FY] = 0;                 //exact
+	allocate(n);
+	for (f = 0; f < SNAPSHOT_FIELDS; f++)
+		decoded[f] = (fftw_real*) malloc((size_t)n * n * sizeof(fftw_real));
+	if (snapshot_record_open(&recorder, path, n, tolerance) != 0)
+		return 1;
+	for (k = 0; k < frames; k++)
+	{
+		fill(n, k, fields);
+		start = omp_get_wtime();
+		snapshot_record(&recorder, k, 0.4, (const fftw_real *const *)fields);
+		coding += omp_get_wtime() - start;
+	}
+	printf("%d frames of %dx%d: %.1f MB of doubles in %.1f MB, %.1f times smaller; coding %.1f ms per frame (%d threads)\n",
+	       frames, n, n, recorder.raw / 1048576, recorder.written / 1048576, recorder.raw / recorder.written,
+	       1000 * coding / frames, omp_get_max_threads());
+	snapshot_record_close(&recorder);
+
+	if (snapshot_reader_open(&r, path) != 0 || r.count != frames)
+	{
+		printf("FAILED: the recording does not read back\n");
+		return 1;
+	}
+	for (k = 0; k < 3 * frames; k++)
+	{
+		int index = (k < frames) ? rand() % frames : (k < 2 * frames) ? k - frames : frames - 1 - (k - 2 * frames);
+		start = omp_get_wtime();
+		if (snapshot_read(&r, index, &frame, decoded) != 0 || frame.frame != (unsigned int)index)
+			bad++;
+		decoding += omp_get_wtime() - start;
+		fill(n, index, fields);
+		for (f = 0; f < SNAPSHOT_FIELDS; f++)
+			for (i = 0; i < n * n; i++)
+			{
+				double error = fabs(decoded[f][i] - fields[f][i]);
+				if (error > worst[f]) worst[f] = error;
+			}
+	}
+	for (f = 0; f < SNAPSHOT_FIELDS; f++)
+	{
+		printf("  %-3s largest error %.3g, tolerance %g\n", field_names[f], worst[f], tolerance[f]);
+		if (worst[f] > tolerance[f] * (1 + 1e-6))
+			bad++;
+	}
+	printf("reading: %.1f ms per frame, in random order, in order and backwards: %s\n",
+	       1000 * decoding / (3 * frames), bad ? "FAILED" : "ok");
+	snapshot_reader_close(&r);
+	remove(path);
+	return bad != 0;
+}
+
+int main(int argc, char **argv)
+{
+	if (argc > 1 && strcmp(argv[1], "-self") == 0)
+		return self_test(argc > 2 ? atoi(argv[2]) : 512);
+	if (argc > 1)
+		return describe(argv[1]);
+	fprintf(stderr, "usage: snapshot_test <file> | -self [n]\n");
+	return 1;
+}
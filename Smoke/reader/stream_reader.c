@@ -0,0 +1,137 @@
+// stream_reader.c: Client of the frame server (see stream_reader.h).
+//--------------------------------------------------------------------------------------------------
+
+#include "stream_reader.h"
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <errno.h>
+
+//stream_connect: connect to the server on socket 'path'. Returns 0 on success, -1 on failure.
+int stream_connect(stream_reader *r, const char *path)
+{
+	struct sockaddr_un addr;
+
+	memset(r, 0, sizeof(*r));
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	strncpy(addr.sun_path, path, sizeof(addr.sun_path) - 1);
+	r->fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (r->fd < 0) return -1;
+	if (connect(r->fd, (struct sockaddr*)&addr, sizeof(addr)) != 0)
+	{
+		close(r->fd);
+		r->fd = -1;
+		return -1;
+	}
+	return 0;
+}
+
+void stream_disconnect(stream_reader *r)
+{
+	int f;
+
+	if (r->fd >= 0) close(r->fd);
+	for (f = 0; f < STREAM_FIELDS; f++)
+		free(r->reference[f]);
+	free(r->payload);
+	memset(r, 0, sizeof(*r));
+	r->fd = -1;
+}
+
+//stream_command: send 'command' (a line of the protocol, without the newline). Returns 0 on success.
+int stream_command(stream_reader *r, const char *command)
+{
+	size_t length = strlen(command);
+	return (send(r->fd, command, length, 0) == (ssize_t)length && send(r->fd, "\n", 1, 0) == 1) ? 0 : -1;
+}
+
+//stream_read: read exactly 'size' bytes. Returns 0 when the connection closed first.
+static int stream_read(stream_reader *r, void *data, unsigned int size)
+{
+	unsigned int done = 0;
+
+	while (done < size)
+	{
+		ssize_t got = recv(r->fd, (char*)data + done, size - done, 0);
+		if (got < 0 && errno == EINTR) continue;
+		if (got <= 0) return 0;
+		done += (unsigned int)got;
+	}
+	r->received += size;
+	return 1;
+}
+
+//stream_receive: receive the next message into 'm' and decode its values into 'values', which has room for
+//                'capacity' floats. Returns 1 on success, 0 when the server closed the connection, -1 on a message
+//                that cannot be decoded (too large, or a difference without the key frame it refers to).
+int stream_receive(stream_reader *r, stream_message *m, float *values, unsigned int capacity)
+{
+	unsigned int count, bytes, i, o, f;
+	unsigned char *ref, *diff;
+
+	if (!stream_read(r, m, sizeof(*m))) return 0;
+	if (m->size > r->capacity)
+	{
+		r->capacity = m->size;
+		r->payload = (unsigned char*) realloc(r->payload, r->capacity);
+	}
+	if (!stream_read(r, r->payload, m->size)) return 0;
+	count = m->dim * m->dim;
+	f = m->field;
+	if (m->magic != STREAM_MAGIC || f >= STREAM_FIELDS || count > capacity) return -1;
+
+	if (m->encoding == STREAM_F32)
+	{
+		if (m->size != count * sizeof(float)) return -1;
+		memcpy(values, r->payload, m->size);
+		return 1;
+	}
+
+	bytes = ((m->encoding & 0xf) == STREAM_U16) ? 2 : 1;
+	if (!(m->encoding & STREAM_DELTA))                  //a key frame: the new reference
+	{
+		if (m->size != count * bytes) return -1;
+		r->reference[f] = (unsigned char*) realloc(r->reference[f], m->size);
+		memcpy(r->reference[f], r->payload, m->size);
+		r->ref_dim[f] = m->dim;
+		r->ref_bytes[f] = bytes;
+	}
+	else                                                //differences, with runs of zero bytes
+	{
+		if (!r->reference[f] || r->ref_dim[f] != m->dim || r->ref_bytes[f] != bytes) return -1;
+		if (r->capacity < m->size + count * bytes)
+		{
+			r->capacity = m->size + count * bytes;
+			r->payload = (unsigned char*) realloc(r->payload, r->capacity);
+		}
+		diff = r->payload + m->size;                    //expand the runs behind the payload
+		memset(diff, 0, count * bytes);
+		for (i = 0, o = 0; i < m->size; )
+		{
+			unsigned char b = r->payload[i++];
+			if (b)
+			{
+				if (o >= count * bytes) return -1;
+				diff[o++] = b;
+			}
+			else if (i < m->size)
+				o += r->payload[i++];
+		}
+		if (o != count * bytes) return -1;
+		ref = r->reference[f];
+		if (bytes == 2)
+			for (o = 0; o < count; o++)
+				((unsigned short*)ref)[o] += ((unsigned short*)diff)[o];
+		else
+			for (o = 0; o < count; o++)
+				ref[o] += diff[o];
+	}
+
+	ref = r->reference[f];
+	for (o = 0; o < count; o++)
+		values[o] = m->offset + m->scale * ((bytes == 2) ? ((unsigned short*)ref)[o] : ref[o]);
+	return 1;
+}
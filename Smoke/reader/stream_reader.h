@@ -0,0 +1,32 @@
+// stream_reader.h: Client of the frame server of the simulation (protocol in ../stream_frames.h): connects to its
+//                  socket, sends commands, and receives and decodes the fields. Receiving blocks; the server does
+//                  not wait for the client, it drops steps the client is too slow for.
+//
+//                  stream_reader r;
+//                  stream_connect(&r, STREAM_PATH);
+//                  stream_command(&r, "subscribe vx,vy,rho 2 u8d");
+//                  while (stream_receive(&r, &m, values, capacity) == 1)
+//                      ... m.field of step m.frame is in values[0 .. m.dim * m.dim - 1] ...
+//--------------------------------------------------------------------------------------------------
+
+#ifndef STREAM_READER_H
+#define STREAM_READER_H
+
+#include "../stream_frames.h"
+
+typedef struct
+{
+	int fd;                     //socket, or -1
+	unsigned char *reference[STREAM_FIELDS];   //quantized values of the last message of each field
+	unsigned int ref_dim[STREAM_FIELDS], ref_bytes[STREAM_FIELDS];
+	unsigned char *payload;
+	unsigned int capacity;
+	double received;            //bytes received so far
+} stream_reader;
+
+int  stream_connect(stream_reader *r, const char *path);
+void stream_disconnect(stream_reader *r);
+int  stream_command(stream_reader *r, const char *command);
+int  stream_receive(stream_reader *r, stream_message *m, float *values, unsigned int capacity);
+
+#endif
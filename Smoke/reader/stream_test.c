@@ -0,0 +1,137 @@
+// stream_test.c: Test client of the frame server of the simulation (start it with -serve, or -headless).
+//
+//                stream_test [path] [fields decimation encoding [every]]
+//                          subscribe (vx,vy,rho 1 u8d by default), print every message received with the bytes
+//                          it took, and stir the fluid with a force command now and then
+//                stream_test -check [path]
+//                          subscribe to rho twice, as f32 and as u8d, and check that the decoded differences
+//                          stay within half a quantization step of the exact values of the same step
+//
+//                Build: gcc -O2 -I.. stream_test.c stream_reader.c -o stream_test
+//--------------------------------------------------------------------------------------------------
+
+#include "stream_reader.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+static const char *field_names[STREAM_FIELDS] = { "vx", "vy", "rho" };
+
+//follow: print what the subscription 'fields decimation encoding [every]' delivers
+static int follow(const char *path, const char *subscription)
+{
+	stream_reader r;
+	stream_message m;
+	unsigned int capacity = 1024 * 1024;
+	float *values = (float*) malloc(capacity * sizeof(float));
+	char command[256];
+	int messages = 0, status;
+
+	if (stream_connect(&r, path) != 0)
+	{
+		fprintf(stderr, "no server on %s: start the simulation with -serve or -headless\n", path);
+		return 1;
+	}
+	sprintf(command, "subscribe %.200s", subscription);
+	stream_command(&r, command);
+	while ((status = stream_receive(&r, &m, values, capacity)) == 1)
+	{
+		float lo = values[0], hi = values[0];
+		unsigned int i;
+
+		for (i = 1; i < m.dim * m.dim; i++)
+		{
+			if (values[i] < lo) lo = values[i];
+			if (values[i] > hi) hi = values[i];
+		}
+		printf("frame %u %-3s %ux%u %s%s: %u bytes, in [%g, %g]\n", m.frame, field_names[m.field], m.dim, m.dim,
+		       (m.encoding & 0xf) == STREAM_F32 ? "f32" : (m.encoding & 0xf) == STREAM_U16 ? "u16" : "u8",
+		       (m.encoding & STREAM_DELTA) ? " delta" : "", m.size, lo, hi);
+		if (++messages % 100 == 0)                      //stir: a force that turns with the messages
+		{
+			double a = messages * 0.01;
+			sprintf(command, "force 0.5 0.5 %g %g", 5 * cos(a), 5 * sin(a));
+			stream_command(&r, command);
+		}
+	}
+	if (status < 0) fprintf(stderr, "message %d cannot be decoded\n", messages);
+	printf("%d messages, %.0f bytes received\n", messages, r.received);
+	stream_disconnect(&r);
+	free(values);
+	return status < 0;
+}
+
+//check: compare the u8d stream of rho with the f32 stream of rho, on the steps both received
+static int check(const char *path)
+{
+	stream_reader exact, coded;
+	stream_message me, mc;
+	unsigned int capacity = 1024 * 1024, i;
+	float *ve = (float*) malloc(capacity * sizeof(float)), *vc = (float*) malloc(capacity * sizeof(float));
+	int compared = 0, bad = 0, keys = 0, deltas = 0;
+	double worst = 0;
+
+	if (stream_connect(&exact, path) != 0 || stream_connect(&coded, path) != 0)
+	{
+		fprintf(stderr, "no server on %s: start the simulation with -serve or -headless\n", path);
+		return 1;
+	}
+	stream_command(&exact, "subscribe rho 1 f32");
+	stream_command(&coded, "subscribe rho 1 u8d");
+	if (stream_receive(&exact, &me, ve, capacity) != 1 || stream_receive(&coded, &mc, vc, capacity) != 1)
+		return 1;
+	while (compared < 500)
+	{
+		if (me.frame < mc.frame)                        //either side may have lost steps: catch up
+		{
+			if (stream_receive(&exact, &me, ve, capacity) != 1) break;
+			continue;
+		}
+		if (mc.frame < me.frame)
+		{
+			if (stream_receive(&coded, &mc, vc, capacity) != 1) { bad++; break; }
+			continue;
+		}
+		for (i = 0; i < me.dim * me.dim; i++)
+		{
+			double error = fabs(ve[i] - vc[i]) / mc.scale;
+			if (error > worst) worst = error;
+		}
+		if (worst > 0.5 + 1e-3) bad++;
+		if (mc.encoding & STREAM_DELTA) deltas++; else keys++;
+		if (++compared % 50 == 1)                       //stir, so that there is something to quantize
+			stream_command(&exact, "force 0.5 0.5 20 10");
+		if (stream_receive(&exact, &me, ve, capacity) != 1 || stream_receive(&coded, &mc, vc, capacity) != 1)
+			break;
+	}
+	printf("%d steps compared (%d key frames, %d differences), largest error %.3f of a step: %s\n",
+	       compared, keys, deltas, worst, (bad || !compared) ? "FAILED" : "ok");
+	stream_disconnect(&exact);
+	stream_disconnect(&coded);
+	free(ve);
+	free(vc);
+	return bad || !compared;
+}
+
+int main(int argc, char **argv)
+{
+	char subscription[256] = "vx,vy,rho 1 u8d";
+	const char *path = STREAM_PATH;
+	int a = 1;
+
+	if (argc > 1 && strcmp(argv[1], "-check") == 0)
+		return check(argc > 2 ? argv[2] : STREAM_PATH);
+	if (a < argc && argv[a][0] == '/')
+		path = argv[a++];
+	if (a < argc)
+	{
+		subscription[0] = 0;
+		for (; a < argc; a++)
+		{
+			strncat(subscription, argv[a], sizeof(subscription) - strlen(subscription) - 2);
+			strcat(subscription, " ");
+		}
+	}
+	return follow(path, subscription);
+}
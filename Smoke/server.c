@@ -0,0 +1,368 @@
+// server.c: Frame server on a UNIX domain socket (see server.h and stream_frames.h).
+//--------------------------------------------------------------------------------------------------
+
+#include "server.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <errno.h>
+
+//server_drop: disconnect client 'c' and free what it holds
+static void server_drop(server_client *c)
+{
+	int k;
+
+	close(c->fd);
+	for (k = 0; k < SERVER_QUEUE; k++)
+		free(c->queue[k].data);
+	for (k = 0; k < STREAM_FIELDS; k++)
+		free(c->reference[k]);
+	free(c->block);
+	free(c->quantized);
+	memset(c, 0, sizeof(*c));
+	c->fd = -1;
+}
+
+int server_open(frame_server *s, const char *path)
+{
+	struct sockaddr_un addr;
+	int k;
+
+	memset(s, 0, sizeof(*s));
+	s->fd = -1;
+	for (k = 0; k < SERVER_CLIENTS; k++)
+		s->clients[k].fd = -1;
+	if (strlen(path) >= sizeof(addr.sun_path))
+	{
+		fprintf(stderr, "server: socket path too long: %s\n", path);
+		return -1;
+	}
+	signal(SIGPIPE, SIG_IGN);                       //a client that went away is seen as a failed send
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	strcpy(addr.sun_path, path);
+	s->fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	unlink(path);                                   //a socket left by an earlier run
+	if (s->fd < 0 || bind(s->fd, (struct sockaddr*)&addr, sizeof(addr)) != 0 || listen(s->fd, 8) != 0)
+	{
+		perror("server");
+		if (s->fd >= 0) close(s->fd);
+		s->fd = -1;
+		return -1;
+	}
+	fcntl(s->fd, F_SETFL, fcntl(s->fd, F_GETFL) | O_NONBLOCK);
+	strcpy(s->path, path);
+	return 0;
+}
+
+void server_close(frame_server *s)
+{
+	int k;
+
+	if (s->fd < 0) return;
+	for (k = 0; k < SERVER_CLIENTS; k++)
+		if (s->clients[k].fd >= 0)
+			server_drop(s->clients + k);
+	close(s->fd);
+	unlink(s->path);
+	s->fd = -1;
+}
+
+//server_subscribe: handle "subscribe <fields> <decimation> <encoding> [every]" from client 'c'. Returns 0 when the
+//                  line is not understood.
+static int server_subscribe(server_client *c, const char *line)
+{
+	char fields[64], encoding[8];
+	int decimation, every = 1, mask = 0;
+
+	if (sscanf(line, "subscribe %63s %d %7s %d", fields, &decimation, encoding, &every) < 3) return 0;
+	if (strstr(fields, "vx"))  mask |= 1 << STREAM_VX;
+	if (strstr(fields, "vy"))  mask |= 1 << STREAM_VY;
+	if (strstr(fields, "rho")) mask |= 1 << STREAM_RHO;
+	if (!mask || decimation < 1 || every < 1) return 0;
+
+	if      (strcmp(encoding, "f32") == 0) c->encoding = STREAM_F32;
+	else if (strcmp(encoding, "u16") == 0) c->encoding = STREAM_U16;
+	else if (strcmp(encoding, "u8") == 0)  c->encoding = STREAM_U8;
+	else if (strcmp(encoding, "u16d") == 0) c->encoding = STREAM_U16 | STREAM_DELTA;
+	else if (strcmp(encoding, "u8d") == 0)  c->encoding = STREAM_U8 | STREAM_DELTA;
+	else return 0;
+	c->fields = mask;
+	c->decimation = decimation;
+	c->every = every;
+	c->need_key = 1;
+	return 1;
+}
+
+//server_read: read what client 'c' sent and handle its complete lines. Returns 0 when the client is gone.
+static int server_read(server_client *c, server_handler handler)
+{
+	char buffer[1024];
+	int received, k;
+
+	while ((received = (int)recv(c->fd, buffer, sizeof(buffer), 0)) > 0)
+		for (k = 0; k < received; k++)
+		{
+			if (buffer[k] != '\n')
+			{
+				if (c->line_length < SERVER_LINE - 1)   //longer lines are cut, and then not understood
+					c->line[c->line_length++] = buffer[k];
+				continue;
+			}
+			c->line[c->line_length] = 0;
+			if (c->line_length > 0 && c->line[c->line_length - 1] == '\r')
+				c->line[c->line_length - 1] = 0;
+			c->line_length = 0;
+			if (strncmp(c->line, "subscribe", 9) == 0)
+			{
+				if (!server_subscribe(c, c->line))
+					fprintf(stderr, "server: bad subscription: %s\n", c->line);
+			}
+			else if (strcmp(c->line, "unsubscribe") == 0)
+				c->fields = 0;
+			else if (c->line[0] && handler)
+				handler(c->line);
+		}
+	return received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR);
+}
+
+//server_write: send what client 'c' has queued, until the socket would block. Returns 0 when the client is gone.
+static int server_write(server_client *c)
+{
+	while (c->count > 0)
+	{
+		server_packet *p = c->queue + c->head;
+		int sent = (int)send(c->fd, p->data + p->sent, p->size - p->sent, 0);
+
+		if (sent < 0)
+			return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+		p->sent += sent;
+		if (p->sent < p->size) return 1;
+		c->head = (c->head + 1) % SERVER_QUEUE;
+		c->count--;
+	}
+	return 1;
+}
+
+//server_poll: accept new clients, handle their commands (subscriptions here, the rest by 'handler') and send what
+//             they have queued, waiting at most 'timeout_ms' for something to happen. Returns the number of clients.
+int server_poll(frame_server *s, int timeout_ms, server_handler handler)
+{
+	struct pollfd fds[SERVER_CLIENTS + 1];
+	int slot[SERVER_CLIENTS + 1], nfds = 0, nclients = 0, k, fd;
+
+	if (s->fd < 0) return 0;
+	fds[nfds].fd = s->fd; fds[nfds].events = POLLIN; slot[nfds++] = -1;
+	for (k = 0; k < SERVER_CLIENTS; k++)
+		if (s->clients[k].fd >= 0)
+		{
+			fds[nfds].fd = s->clients[k].fd;
+			fds[nfds].events = POLLIN | (s->clients[k].count ? POLLOUT : 0);
+			slot[nfds++] = k;
+		}
+	if (poll(fds, nfds, timeout_ms) <= 0) return nfds - 1;
+
+	for (k = 1; k < nfds; k++)
+	{
+		server_client *c = s->clients + slot[k];
+		int alive = 1;
+
+		if (fds[k].revents & (POLLIN | POLLHUP | POLLERR))
+			alive = server_read(c, handler);
+		if (alive && (fds[k].revents & POLLOUT))
+			alive = server_write(c);
+		if (!alive)
+			server_drop(c);
+	}
+
+	if (fds[0].revents & POLLIN)
+		while ((fd = accept(s->fd, 0, 0)) >= 0)
+		{
+			for (k = 0; k < SERVER_CLIENTS && s->clients[k].fd >= 0; k++);
+			if (k == SERVER_CLIENTS) { close(fd); continue; }
+			fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+			memset(s->clients + k, 0, sizeof(server_client));
+			s->clients[k].fd = fd;
+		}
+
+	for (k = 0; k < SERVER_CLIENTS; k++)
+		nclients += s->clients[k].fd >= 0;
+	return nclients;
+}
+
+//packet_reserve: make room for 'bytes' more bytes at the end of packet 'p', and return where they go
+static char *packet_reserve(server_packet *p, int bytes)
+{
+	if (p->size + bytes > p->capacity)
+	{
+		p->capacity = 2 * (p->size + bytes);
+		p->data = (char*) realloc(p->data, p->capacity);
+	}
+	return p->data + p->size;
+}
+
+//server_encode: append the message of field 'f', the n x n 'src', of step 'frame' to packet 'p' of client 'c'
+static void server_encode(server_client *c, server_packet *p, int frame, int f, const fftw_real *src, int n)
+{
+	int d = c->decimation, dim = c->dim, count = dim * dim, base = c->encoding & 0xf;
+	int bytes = (base == STREAM_U16) ? 2 : 1, levels = (base == STREAM_U16) ? 65535 : 255;
+	float lo = 1e30f, hi = -1e30f;
+	stream_message m;
+	int i, j, key;
+
+	for (j = 0; j < dim; j++)                       //averages over blocks of d x d cells
+		for (i = 0; i < dim; i++)
+		{
+			const fftw_real *b = src + d * i + n * d * j;
+			double sum = 0;
+			int a, e;
+			float v;
+			for (e = 0; e < d; e++)
+				for (a = 0; a < d; a++)
+					sum += b[a + n * e];
+			v = (float)(sum / (d * d));
+			c->block[i + dim * j] = v;
+			if (v < lo) lo = v;
+			if (v > hi) hi = v;
+		}
+
+	memset(&m, 0, sizeof(m));
+	m.magic = STREAM_MAGIC;
+	m.frame = frame;
+	m.field = (unsigned short)f;
+	m.dim = dim;
+	if (base == STREAM_F32)
+	{
+		m.encoding = STREAM_F32;
+		m.size = count * sizeof(float);
+		memcpy(packet_reserve(p, sizeof(m) + m.size), &m, sizeof(m));
+		memcpy(p->data + p->size + sizeof(m), c->block, m.size);
+		p->size += sizeof(m) + m.size;
+		return;
+	}
+
+	key = !(c->encoding & STREAM_DELTA) || c->need_key || c->since_key[f] >= STREAM_KEY_INTERVAL
+	   || lo < c->ref_offset[f] || hi > c->ref_offset[f] + c->ref_scale[f] * levels;
+	if (key)
+	{
+		c->ref_offset[f] = lo;
+		c->ref_scale[f] = (hi > lo) ? (hi - lo) / levels : 1;
+		c->since_key[f] = 0;
+	}
+	c->since_key[f]++;
+	m.offset = c->ref_offset[f];
+	m.scale = c->ref_scale[f];
+	m.encoding = (unsigned short)(key ? base : base | STREAM_DELTA);
+
+	for (i = 0; i < count; i++)                     //quantize; for a difference, keep q as the new reference
+	{
+		int q = (int)((c->block[i] - m.offset) / m.scale + 0.5f);
+		q = (q < 0) ? 0 : (q > levels) ? levels : q;
+		if (bytes == 2)
+		{
+			unsigned short *r = (unsigned short*)c->reference[f] + i;
+			((unsigned short*)c->quantized)[i] = (unsigned short)(key ? q : q - *r);
+			*r = (unsigned short)q;
+		}
+		else
+		{
+			unsigned char *r = c->reference[f] + i;
+			c->quantized[i] = (unsigned char)(key ? q : q - *r);
+			*r = (unsigned char)q;
+		}
+	}
+
+	if (key)
+		m.size = count * bytes;
+	else                                            //runs of zero bytes become a zero and a count
+	{
+		const unsigned char *in = c->quantized;
+		unsigned char *out = (unsigned char*) packet_reserve(p, sizeof(m) + 2 * count * bytes) + sizeof(m);
+		int length = count * bytes, o = 0, run;
+
+		for (i = 0; i < length; )
+			if (in[i])
+				out[o++] = in[i++];
+			else
+			{
+				for (run = 0; i < length && !in[i] && run < 255; i++, run++);
+				out[o++] = 0;
+				out[o++] = (unsigned char)run;
+			}
+		m.size = o;
+	}
+	if (key)
+		memcpy(packet_reserve(p, sizeof(m) + m.size) + sizeof(m), c->quantized, m.size);
+	memcpy(p->data + p->size, &m, sizeof(m));
+	p->size += sizeof(m) + m.size;
+}
+
+//server_publish: queue step 'frame' for every client subscribed to it. A client with a full queue loses the steps it
+//                did not start to receive, and gets key frames.
+void server_publish(frame_server *s, int frame, int n, const fftw_real *vx, const fftw_real *vy, const fftw_real *rho)
+{
+	const fftw_real *fields[STREAM_FIELDS];
+	int k, f;
+
+	fields[STREAM_VX] = vx; fields[STREAM_VY] = vy; fields[STREAM_RHO] = rho;
+	for (k = 0; k < SERVER_CLIENTS; k++)
+	{
+		server_client *c = s->clients + k;
+		server_packet *p;
+		int dim;
+
+		if (c->fd < 0 || !c->fields || frame % c->every != 0) continue;
+
+		if (c->count == SERVER_QUEUE)
+		{
+			c->count = (c->queue[c->head].sent > 0) ? 1 : 0;    //a packet in part must be finished
+			c->dropped += SERVER_QUEUE - c->count;
+			c->need_key = 1;
+		}
+		dim = n / c->decimation;
+		if (dim < 1) dim = 1, c->decimation = n;
+		if (dim != c->dim)
+		{
+			c->dim = dim;
+			c->block = (float*) realloc(c->block, dim * dim * sizeof(float));
+			c->quantized = (unsigned char*) realloc(c->quantized, 2 * dim * dim);
+			for (f = 0; f < STREAM_FIELDS; f++)
+				c->reference[f] = (unsigned char*) realloc(c->reference[f], 2 * dim * dim);
+			c->need_key = 1;
+		}
+
+		p = c->queue + (c->head + c->count) % SERVER_QUEUE;
+		p->size = p->sent = 0;
+		for (f = 0; f < STREAM_FIELDS; f++)
+			if (c->fields & (1 << f))
+				server_encode(c, p, frame, f, fields[f], n);
+		c->need_key = 0;
+		c->count++;
+	}
+}
+
+#else
+
+int server_open(frame_server *s, const char *path)
+{
+	memset(s, 0, sizeof(*s));
+	s->fd = -1;
+	fprintf(stderr, "server: UNIX domain sockets are not supported on this platform\n");
+	return -1;
+}
+
+void server_close(frame_server *s) { }
+int server_poll(frame_server *s, int timeout_ms, server_handler handler) { return 0; }
+void server_publish(frame_server *s, int frame, int n, const fftw_real *vx, const fftw_real *vy, const fftw_real *rho) { }
+
+#endif
@@ -0,0 +1,60 @@
+// server.h: Serving the frames of the simulation to local clients over a UNIX domain socket, and taking their
+//           commands (protocol in stream_frames.h). One event loop with non-blocking sockets: server_poll accepts
+//           clients, reads their commands and writes what they have queued, without ever waiting for a client.
+//           Every client has its own subscription and a queue of at most SERVER_QUEUE steps; when a step comes
+//           for a full queue, the queued steps that were not started yet are dropped and the new one is encoded as
+//           a key frame. A stalled client therefore costs the encoding of its subscription and a bounded amount of
+//           memory, and never blocks the solver. Not available on Windows (server_open fails).
+//--------------------------------------------------------------------------------------------------
+
+#ifndef SERVER_H
+#define SERVER_H
+
+#include <rfftw.h>
+#include "stream_frames.h"
+
+#define SERVER_CLIENTS 16       //clients served at once
+#define SERVER_QUEUE 4          //steps queued per client
+#define SERVER_LINE 256         //longest command line
+
+typedef struct
+{
+	char *data;                 //stream_messages of all subscribed fields of a step, with their payload
+	int size, capacity, sent;
+} server_packet;
+
+typedef struct
+{
+	int fd;                     //socket, or -1 when the slot is free
+	char line[SERVER_LINE];     //command being received
+	int line_length;
+
+	int fields;                 //subscription: bit f for field f
+	int decimation, encoding, every;
+	int dim;                    //size of the decimated fields
+	server_packet queue[SERVER_QUEUE];  //ring of packets to send, the first one possibly in part
+	int head, count;
+	int need_key;               //the next delta-encoded message of every field must be a key frame
+	unsigned char *reference[STREAM_FIELDS];    //last quantized values sent of each field, for the differences
+	float ref_offset[STREAM_FIELDS], ref_scale[STREAM_FIELDS];
+	int since_key[STREAM_FIELDS];
+	float *block;               //decimated field
+	unsigned char *quantized;
+	int dropped;                //steps dropped because the client did not keep up
+} server_client;
+
+typedef void (*server_handler)(const char *command);
+
+typedef struct
+{
+	int fd;                     //listening socket, or -1
+	char path[108];
+	server_client clients[SERVER_CLIENTS];
+} frame_server;
+
+int  server_open(frame_server *s, const char *path);
+void server_close(frame_server *s);
+int  server_poll(frame_server *s, int timeout_ms, server_handler handler);
+void server_publish(frame_server *s, int frame, int n, const fftw_real *vx, const fftw_real *vy, const fftw_real *rho);
+
+#endif
@@ -0,0 +1,137 @@
+// shm_export.c: Publishing frames in shared memory (see shm_export.h and shm_frames.h).
+//--------------------------------------------------------------------------------------------------
+
+#include "shm_export.h"
+#include <stdio.h>
+#include <string.h>
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+//shm_export_open: create the segment 'name' for n x n fields of 'precision' bytes (4 or 8) per value, replacing a
+//                 segment of that name left by an earlier run. Returns 0 on success, -1 on failure.
+int shm_export_open(shm_export *e, const char *name, int n, int precision)
+{
+	size_t field = (size_t)n * n * precision;
+	size_t slot = (sizeof(shm_slot) + SHM_FIELDS * field + 63) & ~(size_t)63;
+	shm_header *h;
+	unsigned int s;
+
+	memset(e, 0, sizeof(*e));
+	e->size = sizeof(shm_header) + SHM_SLOTS * slot;
+	strncpy(e->name, name, sizeof(e->name) - 1);
+#ifdef _WIN32
+	e->mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE,
+	                                (DWORD)((unsigned long long)e->size >> 32), (DWORD)e->size, name);
+	if (!e->mapping)
+	{
+		fprintf(stderr, "shm_export: cannot create the file mapping %s (error %lu)\n", name, GetLastError());
+		return -1;
+	}
+	h = (shm_header*) MapViewOfFile(e->mapping, FILE_MAP_ALL_ACCESS, 0, 0, e->size);
+	if (!h)
+	{
+		fprintf(stderr, "shm_export: cannot map %s (error %lu)\n", name, GetLastError());
+		CloseHandle(e->mapping);
+		return -1;
+	}
+#else
+	{
+		int fd;
+		void *p;
+
+		shm_unlink(name);                           //readers of an old segment keep their mapping
+		fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0644);
+		if (fd < 0 || ftruncate(fd, (off_t)e->size) != 0)
+		{
+			perror("shm_export");
+			if (fd >= 0) { close(fd); shm_unlink(name); }
+			return -1;
+		}
+		p = mmap(0, e->size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		close(fd);
+		if (p == MAP_FAILED)
+		{
+			perror("shm_export");
+			shm_unlink(name);
+			return -1;
+		}
+		h = (shm_header*) p;
+	}
+#endif
+
+	memset(h, 0, sizeof(shm_header));
+	h->version = SHM_VERSION;
+	h->dim = n;
+	h->precision = precision;
+	h->nfields = SHM_FIELDS;
+	h->nslots = SHM_SLOTS;
+	h->slot_size = (unsigned int)slot;
+	h->latest = SHM_NONE;
+	for (s = 0; s < SHM_SLOTS; s++)
+		memset(shm_slot_at(h, s), 0, sizeof(shm_slot));
+	shm_barrier();
+	h->magic = SHM_MAGIC;                           //readers may use the header from now on
+	e->header = h;
+	return 0;
+}
+
+//shm_export_close: tell the readers that no more frames come, and remove the segment
+void shm_export_close(shm_export *e)
+{
+	if (!e->header) return;
+	e->header->closed = 1;
+	shm_barrier();
+#ifdef _WIN32
+	UnmapViewOfFile(e->header);
+	CloseHandle(e->mapping);
+#else
+	munmap(e->header, e->size);
+	shm_unlink(e->name);
+#endif
+	e->header = 0;
+}
+
+//shm_copy: copy the n x n field 'src' to 'dst', converting to 'precision' bytes per value
+static void shm_copy(void *dst, const fftw_real *src, int n, unsigned int precision)
+{
+	int i;
+
+	if (precision == sizeof(fftw_real))
+		memcpy(dst, src, (size_t)n * n * sizeof(fftw_real));
+	else if (precision == sizeof(float))
+		for (i = 0; i < n * n; i++)
+			((float*)dst)[i] = (float)src[i];
+	else
+		for (i = 0; i < n * n; i++)
+			((double*)dst)[i] = src[i];
+}
+
+//shm_export_publish: write the frame of simulation step 'frame' into the next slot of the ring. Readers of that slot
+//                    see an odd sequence number, or a changed one, and retry with a newer slot.
+void shm_export_publish(shm_export *e, int frame, double dt,
+                        const fftw_real *vx, const fftw_real *vy, const fftw_real *rho)
+{
+	shm_header *h = e->header;
+	unsigned int s;
+	shm_slot *slot;
+
+	if (!h) return;
+	s = (unsigned int)frame % h->nslots;
+	slot = shm_slot_at(h, s);
+
+	slot->seq++;                                    //odd: being written
+	shm_barrier();
+	slot->frame = frame;
+	slot->dt = dt;
+	shm_copy(shm_field_at(h, s, 0), vx, h->dim, h->precision);
+	shm_copy(shm_field_at(h, s, 1), vy, h->dim, h->precision);
+	shm_copy(shm_field_at(h, s, 2), rho, h->dim, h->precision);
+	shm_barrier();
+	slot->seq++;                                    //even: complete
+	shm_barrier();
+	h->latest = s;
+}
@@ -0,0 +1,26 @@
+// shm_export.h: Publishing the frames of the simulation in shared memory (layout in shm_frames.h): a POSIX shared
+//               memory object, or a named file mapping on Windows.
+//--------------------------------------------------------------------------------------------------
+
+#ifndef SHM_EXPORT_H
+#define SHM_EXPORT_H
+
+#include <rfftw.h>
+#include "shm_frames.h"
+
+typedef struct
+{
+	shm_header *header;         //the mapped segment, or 0 when closed
+	size_t size;
+	char name[64];
+#ifdef _WIN32
+	HANDLE mapping;
+#endif
+} shm_export;
+
+int  shm_export_open(shm_export *e, const char *name, int n, int precision);
+void shm_export_close(shm_export *e);
+void shm_export_publish(shm_export *e, int frame, double dt,
+                        const fftw_real *vx, const fftw_real *vy, const fftw_real *rho);
+
+#endif
@@ -0,0 +1,67 @@
+// shm_frames.h: Layout of the shared memory the simulation publishes its frames in, for other processes on the same
+//               host (see shm_export.h for the simulation side and reader/shm_reader.h for the readers).
+//
+//               The segment is a header followed by a ring of nslots slots. Every slot holds one frame: a slot
+//               header and the fields vx, vy and rho, each dim x dim values of 'precision' bytes, row after row.
+//               The simulation writes frame k into slot k % nslots and never waits for readers. Each slot is a
+//               seqlock: its sequence number is odd while the slot is written and is incremented again when the
+//               frame is complete. A reader takes the newest slot, reads its sequence number, uses the fields in
+//               place, and reads the sequence number again: the frame was consistent if both are the same even
+//               number. The ring gives a reader nslots - 1 frames of time before the slot it reads is reused.
+//--------------------------------------------------------------------------------------------------
+
+#ifndef SHM_FRAMES_H
+#define SHM_FRAMES_H
+
+#include <stddef.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#define SHM_NAME "Local\\smoke_frames"  //name of the file mapping
+#define shm_barrier() MemoryBarrier()
+#else
+#define SHM_NAME "/smoke_frames"        //name of the POSIX shared memory object
+#define shm_barrier() __sync_synchronize()
+#endif
+
+#define SHM_MAGIC 0x464b4d53            //"SMKF"
+#define SHM_VERSION 1
+#define SHM_SLOTS 4                     //slots in the ring
+#define SHM_NONE 0xffffffffu            //'latest' before the first frame
+#define SHM_FIELDS 3                    //vx, vy, rho
+
+typedef struct
+{
+	unsigned int magic;             //SHM_MAGIC, written last when the segment is set up
+	unsigned int version;           //SHM_VERSION
+	unsigned int dim;               //the fields are dim x dim, value (i,j) at index i + dim * j
+	unsigned int precision;         //bytes per value: 4 (float) or 8 (double)
+	unsigned int nfields;           //fields per slot: SHM_FIELDS
+	unsigned int nslots;            //slots in the ring
+	unsigned int slot_size;         //bytes per slot, with its header
+	volatile unsigned int latest;   //slot of the newest complete frame, or SHM_NONE
+	volatile unsigned int closed;   //set when the simulation stops publishing into this segment
+	unsigned int pad[7];
+} shm_header;                       //64 bytes
+
+typedef struct
+{
+	volatile unsigned int seq;      //odd while the slot is written
+	unsigned int frame;             //simulation step of the frame
+	double dt;                      //time step that led to it
+	unsigned int pad[12];
+} shm_slot;                         //64 bytes
+
+//shm_slot_at: slot 's' of the segment that starts with header 'h'
+static __inline shm_slot *shm_slot_at(const shm_header *h, unsigned int s)
+{
+	return (shm_slot*)((char*)h + sizeof(shm_header) + (size_t)s * h->slot_size);
+}
+
+//shm_field_at: field 'f' (0 vx, 1 vy, 2 rho) of slot 's'
+static __inline void *shm_field_at(const shm_header *h, unsigned int s, int f)
+{
+	return (char*)shm_slot_at(h, s) + sizeof(shm_slot) + (size_t)f * h->dim * h->dim * h->precision;
+}
+
+#endif
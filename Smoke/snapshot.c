@@ -0,0 +1,513 @@
+// snapshot.c: Compressed recording of the fields (see snapshot.h).
+//--------------------------------------------------------------------------------------------------
+
+#include "snapshot.h"
+#include "parallel.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#ifdef _WIN32
+#define file_seek _fseeki64
+#define file_tell _ftelli64
+#else
+#define file_seek fseeko
+#define file_tell ftello
+#endif
+
+#if defined(__GNUC__)
+#define count_trailing_zeros(x) __builtin_ctzll(x)
+#else
+static __inline int count_trailing_zeros(unsigned long long x)     //x is not 0
+{
+	int n = 0;
+	while (!(x & 1)) { x >>= 1; n++; }
+	return n;
+}
+#endif
+
+#define RICE_ESCAPE 24          //a quotient of RICE_ESCAPE or more is sent as RICE_ESCAPE ones and the raw 32 bits
+#define TILE_UNCHANGED 0xff     //first byte of a tile whose differences are all 0
+#define QUANTIZED_MAX 1073741823
+
+static const char *field_names[SNAPSHOT_FIELDS] = { "vx", "vy", "fx", "fy", "rho" };
+
+typedef struct
+{
+	unsigned char *p;
+	unsigned long long bits;
+	int count;
+} bit_writer;
+
+typedef struct
+{
+	const unsigned char *p, *end;
+	unsigned long long bits;
+	int count;
+	int past;                   //zero bytes read beyond the end
+} bit_reader;
+
+//put_bits: append the low 'n' (at most 32) bits of 'value'
+static __inline void put_bits(bit_writer *w, unsigned int value, int n)
+{
+	w->bits |= (unsigned long long)value << w->count;
+	w->count += n;
+	while (w->count >= 8)
+	{
+		*w->p++ = (unsigned char)w->bits;
+		w->bits >>= 8;
+		w->count -= 8;
+	}
+}
+
+//put_rice: append u as the quotient u >> k in unary (ones closed by a zero) and the k low bits
+static __inline void put_rice(bit_writer *w, unsigned int u, int k)
+{
+	unsigned int q = u >> k;
+
+	if (q < RICE_ESCAPE)
+	{
+		put_bits(w, (1u << q) - 1, q + 1);
+		put_bits(w, u & ((1u << k) - 1), k);
+	}
+	else
+	{
+		put_bits(w, (1u << RICE_ESCAPE) - 1, RICE_ESCAPE);
+		put_bits(w, u, 32);
+	}
+}
+
+static __inline void refill(bit_reader *r)
+{
+	while (r->count <= 56)
+	{
+		if (r->p < r->end)
+			r->bits |= (unsigned long long)*r->p++ << r->count;
+		else
+			r->past++;
+		r->count += 8;
+	}
+}
+
+static __inline unsigned int get_bits(bit_reader *r, int n)
+{
+	unsigned int value;
+
+	refill(r);
+	value = (unsigned int)(r->bits & ((1ull << n) - 1));
+	r->bits >>= n;
+	r->count -= n;
+	return value;
+}
+
+static __inline unsigned int get_rice(bit_reader *r, int k)
+{
+	int q;
+
+	refill(r);
+	q = count_trailing_zeros(~r->bits | (1ull << RICE_ESCAPE));
+	if (q == RICE_ESCAPE)
+	{
+		r->bits >>= RICE_ESCAPE;
+		r->count -= RICE_ESCAPE;
+		return get_bits(r, 32);
+	}
+	r->bits >>= q + 1;
+	r->count -= q + 1;
+	return ((unsigned int)q << k) | get_bits(r, k);
+}
+
+static __inline int quantize(fftw_real value, double step)
+{
+	double q = floor(value / step + 0.5);
+	return (q > QUANTIZED_MAX) ? QUANTIZED_MAX : (q < -QUANTIZED_MAX) ? -QUANTIZED_MAX : (int)q;
+}
+
+//tile_bounds: the cells [x0,x1) x [y0,y1) of tile t
+static void tile_bounds(const snapshot_codec *c, int t, int *x0, int *x1, int *y0, int *y1)
+{
+	int n = c->header.n;
+
+	*x0 = (t % c->tiles_x) * SNAPSHOT_TILE; *x1 = (*x0 + SNAPSHOT_TILE < n) ? *x0 + SNAPSHOT_TILE : n;
+	*y0 = (t / c->tiles_x) * SNAPSHOT_TILE; *y1 = (*y0 + SNAPSHOT_TILE < n) ? *y0 + SNAPSHOT_TILE : n;
+}
+
+//encode_tile: code tile t of 'field' (field f) into 'out', and keep its q as the reference. Returns the bytes used.
+static unsigned int encode_tile(snapshot_codec *c, int f, int t, const fftw_real *field, int key, unsigned char *out)
+{
+	unsigned int u[SNAPSHOT_TILE * SNAPSHOT_TILE];
+	unsigned long long sum = 0;
+	double step = 2 * c->header.tolerance[f];
+	int *reference = c->reference[f];
+	int n = c->header.n, x0, x1, y0, y1, i, j, m = 0, k = 0, previous = 0;
+	bit_writer w;
+
+	tile_bounds(c, t, &x0, &x1, &y0, &y1);
+	w.p = out + 1; w.bits = 0; w.count = 0;
+	if (step == 0)                                  //exact: the bits of the doubles, xor the prediction, without
+	{                                               //their leading zero bytes
+		double *exact = c->exact[f];
+		unsigned long long changed = 0, p = 0;
+		for (j = y0; j < y1; j++)
+			for (i = x0; i < x1; i++)
+			{
+				double value = field[i + n * j];
+				unsigned long long x, b;
+				memcpy(&x, &value, sizeof(x));
+				memcpy(&b, key ? (void*)&p : (void*)(exact + i + n * j), sizeof(b));
+				p = x;
+				exact[i + n * j] = value;
+				x ^= b;
+				changed |= x;
+				for (k = 0, b = x; b; b >>= 8)
+					k++;
+				put_bits(&w, k, 4);
+				put_bits(&w, (unsigned int)x, (k < 4 ? k : 4) * 8);
+				if (k > 4) put_bits(&w, (unsigned int)(x >> 32), (k - 4) * 8);
+			}
+		if (!changed)
+		{
+			out[0] = TILE_UNCHANGED;
+			return 1;
+		}
+		out[0] = 0;
+		if (w.count > 0)
+			*w.p++ = (unsigned char)w.bits;
+		return (unsigned int)(w.p - out);
+	}
+
+	for (j = y0; j < y1; j++)
+		for (i = x0; i < x1; i++)
+		{
+			int q = quantize(field[i + n * j], step);
+			int r = key ? q - previous : q - reference[i + n * j];
+			previous = reference[i + n * j] = q;
+			u[m] = ((unsigned int)r << 1) ^ (unsigned int)(r >> 31);   //zigzag: small magnitudes to small codes
+			sum += u[m++];
+		}
+	if (sum == 0)
+	{
+		out[0] = TILE_UNCHANGED;
+		return 1;
+	}
+	while (k < 31 && ((unsigned long long)m << (k + 1)) <= sum)        //2^k about the mean code
+		k++;
+	out[0] = (unsigned char)k;
+	for (i = 0; i < m; i++)
+		put_rice(&w, u[i], k);
+	if (w.count > 0)
+		*w.p++ = (unsigned char)w.bits;
+	return (unsigned int)(w.p - out);
+}
+
+//decode_tile: decode tile t of field f from 'data' into the reference, and into 'field' unless it is 0. Returns -1 on
+//             data that does not fit the tile.
+static int decode_tile(snapshot_codec *c, int f, int t, const unsigned char *data, unsigned int size, int key, fftw_real *field)
+{
+	double step = 2 * c->header.tolerance[f];
+	int *reference = c->reference[f];
+	int n = c->header.n, x0, x1, y0, y1, i, j, k, previous = 0;
+	bit_reader r;
+
+	tile_bounds(c, t, &x0, &x1, &y0, &y1);
+	if (size < 1 || (data[0] > 31 && data[0] != TILE_UNCHANGED)) return -1;
+	k = data[0];
+	r.p = data + 1; r.end = data + size; r.bits = 0; r.count = 0; r.past = 0;
+	if (step == 0)
+	{
+		double *exact = c->exact[f];
+		unsigned long long p = 0;
+		for (j = y0; j < y1; j++)
+			for (i = x0; i < x1; i++)
+			{
+				unsigned long long x = 0, b;
+				if (k != TILE_UNCHANGED)
+				{
+					int bytes = get_bits(&r, 4);
+					if (bytes > 8) return -1;
+					x = get_bits(&r, (bytes < 4 ? bytes : 4) * 8);
+					if (bytes > 4) x |= (unsigned long long)get_bits(&r, (bytes - 4) * 8) << 32;
+				}
+				memcpy(&b, key ? (void*)&p : (void*)(exact + i + n * j), sizeof(b));
+				p = x ^= b;
+				memcpy(exact + i + n * j, &x, sizeof(x));
+				if (field) field[i + n * j] = (fftw_real)exact[i + n * j];
+			}
+		return (8 * r.past > r.count) ? -1 : 0;
+	}
+
+	for (j = y0; j < y1; j++)
+		for (i = x0; i < x1; i++)
+		{
+			int d = 0, q;
+			if (k != TILE_UNCHANGED)
+			{
+				unsigned int u = get_rice(&r, k);
+				d = (int)(u >> 1) ^ -(int)(u & 1);
+			}
+			q = (key ? previous : reference[i + n * j]) + d;
+			previous = reference[i + n * j] = q;
+			if (field) field[i + n * j] = (fftw_real)(q * step);
+		}
+	return (8 * r.past > r.count) ? -1 : 0;         //codes were read beyond the data
+}
+
+static int codec_init(snapshot_codec *c, const snapshot_header *h, int buffers)
+{
+	int f, k, count;
+
+	memset(c, 0, sizeof(*c));
+	c->header = *h;
+	if (h->n == 0 || h->n > 65536 || h->key_interval == 0) return -1;
+	c->tiles_x = (h->n + SNAPSHOT_TILE - 1) / SNAPSHOT_TILE;
+	c->tiles = c->tiles_x * c->tiles_x;
+	count = SNAPSHOT_FIELDS * c->tiles;
+	for (f = 0; f < SNAPSHOT_FIELDS; f++)
+		if (h->tolerance[f] == 0)
+			c->exact[f] = (double*) calloc((size_t)h->n * h->n, sizeof(double));
+		else if (h->tolerance[f] > 0)
+			c->reference[f] = (int*) calloc((size_t)h->n * h->n, sizeof(int));
+	c->data = (unsigned char**) calloc(count, sizeof(unsigned char*));
+	c->sizes = (unsigned int*) calloc(count, sizeof(unsigned int));
+	if (buffers)                                    //the worst case of a tile: 68 bits per exact value
+	{
+		c->capacity = 9 * SNAPSHOT_TILE * SNAPSHOT_TILE + 16;
+		for (k = 0; k < count; k++)
+			c->data[k] = (unsigned char*) malloc(c->capacity);
+	}
+	return 0;
+}
+
+static void codec_free(snapshot_codec *c)
+{
+	int f, k;
+
+	for (f = 0; f < SNAPSHOT_FIELDS; f++)
+	{
+		free(c->reference[f]);
+		free(c->exact[f]);
+	}
+	if (c->capacity && c->data)
+		for (k = 0; k < SNAPSHOT_FIELDS * c->tiles; k++)
+			free(c->data[k]);
+	free(c->data);
+	free(c->sizes);
+	memset(c, 0, sizeof(*c));
+}
+
+//snapshot_default_tolerances: velocities and forces to 1e-5, density to 1e-4
+void snapshot_default_tolerances(double tolerance[SNAPSHOT_FIELDS])
+{
+	tolerance[SNAPSHOT_VX] = tolerance[SNAPSHOT_VY] = 1e-5;
+	tolerance[SNAPSHOT_FX] = tolerance[SNAPSHOT_FY] = 1e-5;
+	tolerance[SNAPSHOT_RHO] = 1e-4;
+}
+
+//snapshot_parse_tolerances: set the tolerances named in 'spec', e.g. "vx=1e-4,vy=1e-4,fx=-1,fy=-1,rho=0". Returns
+//                           0 on success, -1 on a name or value that is not understood.
+int snapshot_parse_tolerances(const char *spec, double tolerance[SNAPSHOT_FIELDS])
+{
+	while (*spec)
+	{
+		const char *equals = strchr(spec, '=');
+		char *end;
+		int f;
+
+		if (!equals) return -1;
+		for (f = 0; f < SNAPSHOT_FIELDS; f++)
+			if (strlen(field_names[f]) == (size_t)(equals - spec) && strncmp(spec, field_names[f], equals - spec) == 0)
+				break;
+		if (f == SNAPSHOT_FIELDS) return -1;
+		tolerance[f] = strtod(equals + 1, &end);
+		if (end == equals + 1 || (*end && *end != ',')) return -1;
+		spec = *end ? end + 1 : end;
+	}
+	return 0;
+}
+
+//snapshot_record_open: start recording n x n fields in the file 'path', with the largest error 'tolerance' per field.
+//                      Returns 0 on success, -1 on failure.
+int snapshot_record_open(snapshot_recorder *r, const char *path, int n, const double tolerance[SNAPSHOT_FIELDS])
+{
+	snapshot_header h;
+
+	memset(r, 0, sizeof(*r));
+	memset(&h, 0, sizeof(h));
+	h.magic = SNAPSHOT_MAGIC;
+	h.version = 1;
+	h.n = n;
+	h.key_interval = SNAPSHOT_KEY_INTERVAL;
+	memcpy(h.tolerance, tolerance, sizeof(h.tolerance));
+	if (codec_init(&r->codec, &h, 1) != 0) return -1;
+	r->file = fopen(path, "wb");
+	if (!r->file || fwrite(&h, sizeof(h), 1, r->file) != 1)
+	{
+		perror("snapshot");
+		snapshot_record_close(r);
+		return -1;
+	}
+	r->written = sizeof(h);
+	return 0;
+}
+
+void snapshot_record_close(snapshot_recorder *r)
+{
+	if (r->file) fclose(r->file);
+	codec_free(&r->codec);
+	r->file = 0;
+}
+
+//snapshot_record: append the fields of step 'frame'. Returns 0 on success, -1 when the file cannot be written.
+int snapshot_record(snapshot_recorder *r, int frame, double dt, const fftw_real *const fields[SNAPSHOT_FIELDS])
+{
+	snapshot_codec *c = &r->codec;
+	snapshot_frame header;
+	int key = (r->frames % c->header.key_interval) == 0, k, f, t;
+
+	if (!r->file) return -1;
+	#pragma omp parallel for schedule(dynamic)
+	for (k = 0; k < SNAPSHOT_FIELDS * c->tiles; k++)
+	{
+		int field = k / c->tiles;
+		c->sizes[k] = (c->header.tolerance[field] < 0) ? 0 : encode_tile(c, field, k % c->tiles, fields[field], key, c->data[k]);
+	}
+
+	header.magic = SNAPSHOT_FRAME_MAGIC;
+	header.frame = frame;
+	header.dt = dt;
+	header.key = key;
+	header.size = 0;
+	for (f = 0; f < SNAPSHOT_FIELDS; f++)
+		if (c->header.tolerance[f] >= 0)
+		{
+			r->raw += (double)c->header.n * c->header.n * sizeof(double);
+			header.size += c->tiles * sizeof(unsigned int);
+			for (t = 0; t < c->tiles; t++)
+				header.size += c->sizes[f * c->tiles + t];
+		}
+	if (fwrite(&header, sizeof(header), 1, r->file) != 1) return -1;
+	for (f = 0; f < SNAPSHOT_FIELDS; f++)
+		if (c->header.tolerance[f] >= 0)
+		{
+			if (fwrite(c->sizes + f * c->tiles, sizeof(unsigned int), c->tiles, r->file) != (size_t)c->tiles) return -1;
+			for (t = 0; t < c->tiles; t++)
+				if (fwrite(c->data[f * c->tiles + t], 1, c->sizes[f * c->tiles + t], r->file) != c->sizes[f * c->tiles + t])
+					return -1;
+		}
+	r->written += sizeof(header) + header.size;
+	r->frames++;
+	return 0;
+}
+
+//snapshot_reader_open: open the recording 'path' and find its frames; a frame cut off at the end (a recording that
+//                      was not closed) is left out. Returns 0 on success, -1 on failure.
+int snapshot_reader_open(snapshot_reader *r, const char *path)
+{
+	snapshot_header h;
+	snapshot_frame frame;
+	long long position, end;
+	int capacity = 0;
+
+	memset(r, 0, sizeof(*r));
+	r->current = -1;
+	r->file = fopen(path, "rb");
+	if (!r->file) return -1;
+	if (fread(&h, sizeof(h), 1, r->file) != 1 || h.magic != SNAPSHOT_MAGIC || h.version != 1
+	 || codec_init(&r->codec, &h, 0) != 0)
+	{
+		snapshot_reader_close(r);
+		return -1;
+	}
+	file_seek(r->file, 0, SEEK_END);
+	end = file_tell(r->file);
+	for (position = sizeof(h); ; position += sizeof(frame) + frame.size)
+	{
+		if (file_seek(r->file, position, SEEK_SET) != 0 || fread(&frame, sizeof(frame), 1, r->file) != 1
+		 || frame.magic != SNAPSHOT_FRAME_MAGIC || position + (long long)sizeof(frame) + frame.size > end)
+			break;
+		if (r->count == capacity)
+		{
+			capacity = capacity ? 2 * capacity : 256;
+			r->offsets = (long long*) realloc(r->offsets, capacity * sizeof(long long));
+			r->keys = (int*) realloc(r->keys, capacity * sizeof(int));
+		}
+		r->offsets[r->count] = position;
+		r->keys[r->count] = frame.key || r->count == 0;
+		r->count++;
+	}
+	return 0;
+}
+
+void snapshot_reader_close(snapshot_reader *r)
+{
+	if (r->file) fclose(r->file);
+	codec_free(&r->codec);
+	free(r->offsets);
+	free(r->keys);
+	free(r->payload);
+	memset(r, 0, sizeof(*r));
+	r->current = -1;
+}
+
+//decode_frame: decode frame 'index' into the reference, and into 'fields' (entries may be 0) unless it is 0
+static int decode_frame(snapshot_reader *r, int index, snapshot_frame *header, fftw_real *const fields[SNAPSHOT_FIELDS])
+{
+	snapshot_codec *c = &r->codec;
+	unsigned int position = 0, total;
+	int k, f, t, bad = 0;
+
+	if (file_seek(r->file, r->offsets[index], SEEK_SET) != 0 || fread(header, sizeof(*header), 1, r->file) != 1)
+		return -1;
+	if (header->size > r->capacity)
+	{
+		r->capacity = header->size;
+		r->payload = (unsigned char*) realloc(r->payload, r->capacity);
+	}
+	if (fread(r->payload, 1, header->size, r->file) != header->size)
+		return -1;
+	for (f = 0; f < SNAPSHOT_FIELDS; f++)           //find the data of every tile
+		if (c->header.tolerance[f] >= 0)
+		{
+			if (position + c->tiles * sizeof(unsigned int) > header->size) return -1;
+			memcpy(c->sizes + f * c->tiles, r->payload + position, c->tiles * sizeof(unsigned int));
+			position += c->tiles * sizeof(unsigned int);
+			for (t = 0, total = 0; t < c->tiles; t++)
+			{
+				c->data[f * c->tiles + t] = r->payload + position + total;
+				total += c->sizes[f * c->tiles + t];
+				if (total > header->size - position) return -1;
+			}
+			position += total;
+		}
+	if (position != header->size) return -1;
+
+	#pragma omp parallel for schedule(dynamic) reduction(+:bad)
+	for (k = 0; k < SNAPSHOT_FIELDS * c->tiles; k++)
+	{
+		int field = k / c->tiles;
+		if (c->header.tolerance[field] >= 0
+		 && decode_tile(c, field, k % c->tiles, c->data[k], c->sizes[k], r->keys[index], fields ? fields[field] : 0) != 0)
+			bad++;
+	}
+	return bad ? -1 : 0;
+}
+
+//snapshot_read: decode frame 'index' (0 .. count - 1) into 'header' and 'fields'; the entries of fields that are 0,
+//               and the fields that were not recorded, are left out. Returns 0 on success, -1 on a damaged frame.
+int snapshot_read(snapshot_reader *r, int index, snapshot_frame *header, fftw_real *const fields[SNAPSHOT_FIELDS])
+{
+	int start = index;
+
+	if (index < 0 || index >= r->count) return -1;
+	while (!r->keys[start])                         //decode from the key frame before, or from the frame read last
+		start--;
+	if (r->current >= start && r->current < index)
+		start = r->current + 1;
+	for (r->current = -1; start < index; start++)
+		if (decode_frame(r, start, header, 0) != 0)
+			return -1;
+	if (decode_frame(r, index, header, fields) != 0)
+		return -1;
+	r->current = index;
+	return 0;
+}
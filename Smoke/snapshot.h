@@ -0,0 +1,89 @@
+// snapshot.h: Recording the fields of the simulation in a compressed file, and reading any frame back.
+//
+//             Every field is quantized with an error bound of its own: value = 2 * tolerance * q, so a value
+//             read back is within 'tolerance' of the value recorded. A frame stores, per tile of SNAPSHOT_TILE^2
+//             cells, the differences of q to the previous frame, or on a key frame (every key_interval frames) to
+//             the previous cell of the tile; the differences are Rice coded with a parameter per tile, and an
+//             unchanged tile takes one byte. The tiles are coded in parallel. A field with tolerance 0 is stored
+//             exactly: the bits of its doubles xor those of the prediction, without their leading zero bytes. A field
+//             with a negative tolerance is not recorded.
+//
+//             File: snapshot_header, then per frame a snapshot_frame and its payload: for each recorded field the
+//             sizes of its tiles (unsigned ints) and then their data. Reading a frame decodes from the key frame
+//             before it, or from the frame read last when that lies in between.
+//--------------------------------------------------------------------------------------------------
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <rfftw.h>
+#include <stdio.h>
+
+#define SNAPSHOT_MAGIC 0x50414e53       //"SNAP"
+#define SNAPSHOT_FRAME_MAGIC 0x4d415246 //"FRAM"
+#define SNAPSHOT_TILE 64                //tiles are SNAPSHOT_TILE x SNAPSHOT_TILE cells
+#define SNAPSHOT_KEY_INTERVAL 32        //frames between key frames
+
+enum { SNAPSHOT_VX, SNAPSHOT_VY, SNAPSHOT_FX, SNAPSHOT_FY, SNAPSHOT_RHO, SNAPSHOT_FIELDS };
+
+typedef struct
+{
+	unsigned int magic;                 //SNAPSHOT_MAGIC
+	unsigned int version;               //1
+	unsigned int n;                     //the fields are n x n, value (i,j) at index i + n * j
+	unsigned int key_interval;
+	double tolerance[SNAPSHOT_FIELDS];  //largest error of each field; 0: exact, negative: not recorded
+} snapshot_header;
+
+typedef struct
+{
+	unsigned int magic;                 //SNAPSHOT_FRAME_MAGIC
+	unsigned int frame;                 //simulation step
+	double dt;
+	unsigned int key;                   //a key frame: decodes without the frames before it
+	unsigned int size;                  //bytes of payload after this header
+} snapshot_frame;
+
+typedef struct
+{
+	snapshot_header header;
+	int tiles_x, tiles;                 //tiles per row, and per field
+	int *reference[SNAPSHOT_FIELDS];    //q of the frame coded or decoded last
+	double *exact[SNAPSHOT_FIELDS];     //values of the frame coded or decoded last, of the exact fields
+	unsigned char **data;               //coded tile t of field f at data[f * tiles + t]
+	unsigned int *sizes;
+	size_t capacity;                    //bytes of each data buffer
+} snapshot_codec;
+
+typedef struct
+{
+	FILE *file;                         //0 when not recording
+	snapshot_codec codec;
+	int frames;
+	double raw, written;                //bytes of the fields as doubles, and bytes written
+} snapshot_recorder;
+
+typedef struct
+{
+	FILE *file;
+	snapshot_codec codec;
+	int count;                          //frames in the file
+	long long *offsets;                 //position of the snapshot_frame of each frame
+	int *keys;                          //the frames that are key frames
+	int current;                        //frame in the reference, or -1
+	unsigned char *payload;
+	unsigned int capacity;
+} snapshot_reader;
+
+void snapshot_default_tolerances(double tolerance[SNAPSHOT_FIELDS]);
+int  snapshot_parse_tolerances(const char *spec, double tolerance[SNAPSHOT_FIELDS]);
+
+int  snapshot_record_open(snapshot_recorder *r, const char *path, int n, const double tolerance[SNAPSHOT_FIELDS]);
+void snapshot_record_close(snapshot_recorder *r);
+int  snapshot_record(snapshot_recorder *r, int frame, double dt, const fftw_real *const fields[SNAPSHOT_FIELDS]);
+
+int  snapshot_reader_open(snapshot_reader *r, const char *path);
+void snapshot_reader_close(snapshot_reader *r);
+int  snapshot_read(snapshot_reader *r, int index, snapshot_frame *f, fftw_real *const fields[SNAPSHOT_FIELDS]);
+
+#endif
@@ -0,0 +1,148 @@
+// spectrum.c: Energy spectrum and enstrophy diagnostics (see spectrum.h).
+//
+//             With the unnormalized transforms of solve(), a mode with velocity coefficients (U,V) holds the energy
+//             (|U|^2+|V|^2) / (2 n^4) (Parseval), and the enstrophy (2 pi |k|)^2 times that for a divergence-free
+//             field. The half-complex layout only stores the modes with kx >= 0: the others are their conjugates,
+//             so the modes with 0 < kx < n/2 count twice.
+//--------------------------------------------------------------------------------------------------
+
+#include "spectrum.h"
+#include "parallel.h"
+#include <GL/glut.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+void spectrum_init(energy_spectrum *s, int n)
+{
+	int i, j, h = n / 2 + 1;
+
+	memset(s, 0, sizeof(*s));
+	s->n = n;
+	s->nbins = (int)(0.5 * sqrt(2.0) * n + 0.5) + 1;
+	s->bin = (int*) malloc(h * n * sizeof(int));
+	s->weight = (float*) malloc(h * n * sizeof(float));
+	s->energy = (double*) calloc(s->nbins, sizeof(double));
+	s->step = -1;
+	for (j = 0; j < n; j++)
+	{
+		int ky = (j <= n / 2) ? j : j - n;
+		for (i = 0; i < h; i++)
+		{
+			s->bin[i + h * j] = (int)(sqrt((double)(i * i + ky * ky)) + 0.5);
+			s->weight[i + h * j] = (i == 0 || 2 * i == n) ? 1.0f : 2.0f;
+		}
+	}
+}
+
+void spectrum_free(energy_spectrum *s)
+{
+	free(s->bin); free(s->weight);
+	free(s->local); free(s->energy);
+	memset(s, 0, sizeof(*s));
+}
+
+//spectrum_begin: Clear the bins of all threads, before solve() adds its modes
+void spectrum_begin(energy_spectrum *s)
+{
+	int nthreads = omp_get_max_threads();
+
+	if (nthreads > s->nthreads)
+	{
+		free(s->local);
+		s->local = (double*) malloc(nthreads * (s->nbins + 1) * sizeof(double));
+		s->nthreads = nthreads;
+	}
+	memset(s->local, 0, s->nthreads * (s->nbins + 1) * sizeof(double));
+}
+
+//spectrum_end: Merge the bins of all threads into E(k), the total energy and the enstrophy of simulation step 'step'
+void spectrum_end(energy_spectrum *s, int step)
+{
+	double f = 0.5 / ((double)s->n * s->n * s->n * s->n);
+	int b, t, h;
+
+	s->total_energy = s->enstrophy = 0;
+	for (b = 0; b < s->nbins; b++)
+	{
+		double e = 0;
+		for (t = 0; t < s->nthreads; t++)
+			e += spectrum_bins(s, t)[b];
+		s->energy[b] = f * e;
+		s->total_energy += s->energy[b];
+	}
+	for (t = 0; t < s->nthreads; t++)
+		s->enstrophy += spectrum_bins(s, t)[s->nbins];
+	s->enstrophy *= 4 * 3.14159265358979 * 3.14159265358979 * f;
+	s->step = step;
+
+	h = s->nhistory % SPECTRUM_HISTORY;
+	s->history[0][h] = (float)s->total_energy;
+	s->history[1][h] = (float)s->enstrophy;
+	s->nhistory++;
+}
+
+//spectrum_text: draw the string 'text' at (x,y)
+static void spectrum_text(float x, float y, const char *text)
+{
+	glRasterPos2f(x, y);
+	while (*text)
+		glutBitmapCharacter(GLUT_BITMAP_HELVETICA_10, *text++);
+}
+
+//spectrum_draw: draw the plots in the rectangle at (x,y) of w x h pixels: E(k) on log-log axes (six decades below
+//               the largest bin) at the top, and the total energy and enstrophy of the last steps, each scaled to
+//               its own maximum, at the bottom
+void spectrum_draw(const energy_spectrum *s, float x, float y, float w, float h)
+{
+	float ph = 0.6f * h;
+	double emax = 0, hmax[2] = { 0, 0 };
+	int b, c, k, count = (s->nhistory < SPECTRUM_HISTORY) ? s->nhistory : SPECTRUM_HISTORY;
+	char text[64];
+
+	if (s->step < 0) return;
+
+	glColor4f(0, 0, 0, 1);
+	glRectf(x, y, x + w, y + h);
+	glColor3f(1, 1, 1);
+	glBegin(GL_LINE_LOOP);
+	glVertex2f(x, y); glVertex2f(x + w, y); glVertex2f(x + w, y + h); glVertex2f(x, y + h);
+	glEnd();
+
+	for (b = 1; b < s->nbins; b++)
+		if (s->energy[b] > emax) emax = s->energy[b];
+	if (emax > 0)
+	{
+		double lx = log10((double)(s->nbins - 1)), ly = log10(emax);
+		glColor3f(1, 1, 0);
+		glBegin(GL_LINE_STRIP);
+		for (b = 1; b < s->nbins; b++)
+		{
+			double v = (s->energy[b] > 0) ? (log10(s->energy[b]) - ly) / 6 + 1 : 0;
+			if (v < 0) v = 0;
+			glVertex2f(x + w * (float)(log10((double)b) / lx), y + h - ph + ph * (float)v);
+		}
+		glEnd();
+	}
+
+	for (k = 0; k < count; k++)
+		for (c = 0; c < 2; c++)
+			if (s->history[c][k] > hmax[c]) hmax[c] = s->history[c][k];
+	for (c = 0; c < 2; c++)
+	{
+		if (hmax[c] <= 0) continue;
+		if (c == 0) glColor3f(0, 1, 0); else glColor3f(0, 0.6f, 1);
+		glBegin(GL_LINE_STRIP);
+		for (k = 0; k < count; k++)      //oldest first
+		{
+			int r = (s->nhistory - count + k) % SPECTRUM_HISTORY;
+			glVertex2f(x + w * k / SPECTRUM_HISTORY, y + (h - ph) * 0.8f * (float)(s->history[c][r] / hmax[c]));
+		}
+		glEnd();
+	}
+
+	glColor3f(1, 1, 1);
+	sprintf(text, "E(k)   E = %.3g   Z = %.3g", s->total_energy, s->enstrophy);
+	spectrum_text(x + 4, y + h - 12, text);
+}
@@ -0,0 +1,51 @@
+// spectrum.h: Kinetic energy spectrum E(k), total energy and enstrophy of the velocity field, reduced by solve()
+//             from the Fourier coefficients it computes anyway (see SPECTRAL_ENERGY in fluids.h), and a small
+//             live plot of them. Each thread adds its modes to its own bins; the bins are merged after the loop.
+//--------------------------------------------------------------------------------------------------
+
+#ifndef SPECTRUM_H
+#define SPECTRUM_H
+
+#include <rfftw.h>
+
+#define SPECTRUM_HISTORY 256    //number of steps of total energy and enstrophy kept for the plot
+
+typedef struct
+{
+	int n;                      //size of the grid
+	int nbins;                  //number of radial wavenumber bins: bin b holds the modes with b-0.5 <= |k| < b+0.5
+	int *bin;                   //bin of every mode of the half-complex layout of solve(), (n+2)/2 x n
+	float *weight;              //weight of every mode: 2 for the modes that stand for their conjugate as well
+	int nthreads;               //one set of bins per thread
+	double *local;              //per-thread bins: nbins energies followed by the enstrophy
+	double *energy;             //E(k) of the last step
+	double total_energy;        //1/2 <|v|^2> of the last step, the sum of E(k)
+	double enstrophy;           //1/2 <w^2> of the last step, with w the vorticity
+	int step;                   //simulation step the values were computed for, or -1
+	float history[2][SPECTRUM_HISTORY];   //total energy and enstrophy of the last steps, a ring buffer
+	int nhistory;               //number of steps in the ring buffer
+} energy_spectrum;
+
+void spectrum_init(energy_spectrum *s, int n);
+void spectrum_free(energy_spectrum *s);
+void spectrum_begin(energy_spectrum *s);
+void spectrum_end(energy_spectrum *s, int step);
+void spectrum_draw(const energy_spectrum *s, float x, float y, float w, float h);
+
+//spectrum_add: Add the mode at index 'k' of the half-complex layout, with wavenumber (kx,ky), |k|^2 = 'r' and
+//              velocity coefficients (U,V), to the bins 'bins' of the calling thread
+static __inline void spectrum_add(const energy_spectrum *s, double *bins, int k, fftw_real r,
+                                  const fftw_real U[2], const fftw_real V[2])
+{
+	double e = s->weight[k / 2] * (U[0] * U[0] + U[1] * U[1] + V[0] * V[0] + V[1] * V[1]);
+	bins[s->bin[k / 2]] += e;
+	bins[s->nbins] += r * e;
+}
+
+//spectrum_bins: The bins of thread 't', between spectrum_begin and spectrum_end
+static __inline double *spectrum_bins(const energy_spectrum *s, int t)
+{
+	return s->local + t * (s->nbins + 1);
+}
+
+#endif
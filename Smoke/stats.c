@@ -0,0 +1,102 @@
+// stats.c: Streaming statistics and automatic ranges (see stats.h).
+//--------------------------------------------------------------------------------------------------
+
+#include "stats.h"
+#include "parallel.h"
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+
+void range_init(auto_range *r, float low, float high, float smoothing)
+{
+	memset(r, 0, sizeof(*r));
+	r->low = low;
+	r->high = high;
+	r->smoothing = smoothing;
+	r->hi = 1;
+}
+
+void range_free(auto_range *r)
+{
+	free(r->local);
+	memset(r, 0, sizeof(*r));
+}
+
+//range_begin: Clear the statistics of all threads, before a pass adds its values
+void range_begin(auto_range *r)
+{
+	int nthreads = omp_get_max_threads(), t;
+
+	if (nthreads > r->nthreads)
+	{
+		free(r->local);
+		r->local = (field_stats*) malloc(nthreads * sizeof(field_stats));
+		r->nthreads = nthreads;
+	}
+	memset(r->local, 0, r->nthreads * sizeof(field_stats));
+	for (t = 0; t < r->nthreads; t++)
+	{
+		r->local[t].min = DBL_MAX;
+		r->local[t].max = -DBL_MAX;
+	}
+}
+
+//range_percentile: The value below which a fraction 'p' of the values of the last pass lies, interpolated within
+//                  the histogram bin it falls in, and clamped to the minimum and maximum of the pass. When the pass
+//                  has values outside the span of its histogram, the minimum or maximum is returned instead.
+float range_percentile(const auto_range *r, float p)
+{
+	const field_stats *s = &r->total;
+	double want = p * s->count, seen = 0, v;
+	int b;
+
+	if (s->count == 0) return 0;
+	if (r->hist_scale <= 0 || s->min < r->hist_lo || s->max > r->hist_lo + STATS_BINS / r->hist_scale)
+		return (float)((p < 0.5f) ? s->min : s->max);
+	for (b = 0; b < STATS_BINS - 1 && seen + s->hist[b] < want; b++)
+		seen += s->hist[b];
+	v = r->hist_lo + (b + (s->hist[b] ? (want - seen) / s->hist[b] : 0)) / r->hist_scale;
+	return (float)((v < s->min) ? s->min : (v > s->max) ? s->max : v);
+}
+
+//range_end: Merge the statistics of all threads, move the range towards the percentiles of this pass, and spread the
+//           histogram of the next pass over the minimum to maximum of this one, widened by a quarter on both sides
+//           so that a slowly changing field stays inside it
+void range_end(auto_range *r)
+{
+	field_stats *s = &r->total;
+	int t, b;
+
+	*s = r->local[0];
+	for (t = 1; t < r->nthreads; t++)
+	{
+		const field_stats *l = r->local + t;
+		if (l->min < s->min) s->min = l->min;
+		if (l->max > s->max) s->max = l->max;
+		s->sum += l->sum;
+		s->count += l->count;
+		for (b = 0; b < STATS_BINS; b++)
+			s->hist[b] += l->hist[b];
+	}
+	if (s->count == 0) return;
+
+	r->mean = (float)(s->sum / s->count);
+	r->p_low = range_percentile(r, r->low);
+	r->p_high = range_percentile(r, r->high);
+	if (r->valid)
+	{
+		r->lo += r->smoothing * (r->p_low - r->lo);
+		r->hi += r->smoothing * (r->p_high - r->hi);
+	}
+	else
+	{
+		r->lo = r->p_low;
+		r->hi = r->p_high;
+		r->valid = 1;
+	}
+	if (r->hi <= r->lo)                                 //a constant field: any range around it
+		r->hi = r->lo + ((r->lo > 0) ? r->lo : -r->lo) * 1e-6f + FLT_MIN * 1e6f;
+
+	r->hist_lo = (float)(s->min - 0.25 * (s->max - s->min));
+	r->hist_scale = (s->max > s->min) ? (float)(STATS_BINS / (1.5 * (s->max - s->min))) : 0;
+}
@@ -0,0 +1,59 @@
+// stats.h: Statistics of a displayed scalar (minimum, maximum, mean and a histogram for percentiles), collected
+//          while the scalar is mapped to colours or glyphs rather than in a pass of their own, and the colour range
+//          derived from them. Each thread collects into its own statistics, which are merged after the pass; the
+//          range follows the percentiles of the passes with exponential smoothing, so it adapts without flicker.
+//          The values are mapped with the range of the previous passes, and the histogram of a pass spans
+//          (a little more than) the minimum to maximum of the previous pass.
+//--------------------------------------------------------------------------------------------------
+
+#ifndef STATS_H
+#define STATS_H
+
+#define STATS_BINS 256          //number of histogram bins
+
+typedef struct
+{
+	double min, max, sum;
+	int count;
+	unsigned int hist[STATS_BINS];
+} field_stats;
+
+typedef struct
+{
+	float low, high;            //the range runs from percentile 'low' to percentile 'high' (fractions in [0,1])
+	float smoothing;            //weight of the newest pass in the range, in (0,1]
+	float lo, hi;               //the range in use: lo maps to 0 and hi to 1
+	float hist_lo, hist_scale;  //a value v falls in histogram bin (v - hist_lo) * hist_scale, clamped to the bins
+	field_stats total;          //merged statistics of the last pass
+	float mean;                 //mean of the last pass
+	float p_low, p_high;        //percentiles 'low' and 'high' of the last pass
+	int valid;                  //the range holds at least one pass
+	int nthreads;               //one set of statistics per thread
+	field_stats *local;
+} auto_range;
+
+void range_init(auto_range *r, float low, float high, float smoothing);
+void range_free(auto_range *r);
+void range_begin(auto_range *r);
+void range_end(auto_range *r);
+float range_percentile(const auto_range *r, float p);
+
+//range_stats: The statistics of thread 't', between range_begin and range_end
+static __inline field_stats *range_stats(auto_range *r, int t)
+{
+	return r->local + t;
+}
+
+//range_add: Add 'value' to the statistics 's' of the calling thread
+static __inline void range_add(const auto_range *r, field_stats *s, float value)
+{
+	int b = (int)((value - r->hist_lo) * r->hist_scale);
+
+	if (value < s->min) s->min = value;
+	if (value > s->max) s->max = value;
+	s->sum += value;
+	s->count++;
+	s->hist[(b < 0) ? 0 : (b >= STATS_BINS) ? STATS_BINS - 1 : b]++;
+}
+
+#endif
@@ -0,0 +1,52 @@
+// stream_frames.h: Protocol of the frame server (see server.h) on its UNIX domain socket.
+//
+//                  Clients send text commands, one per line:
+//                    subscribe <fields> <decimation> <encoding> [every]
+//                          fields: any of vx, vy, rho, separated by commas; decimation: the fields are sent as
+//                          averages over blocks of decimation x decimation cells; encoding: f32, u16, u8, or u16d
+//                          or u8d for quantized values sent as differences to the previous frame; every: send every
+//                          'every'-th simulation step (1 by default)
+//                    unsubscribe
+//                    force <x> <y> <fx> <fy>       add the force (fx,fy) at domain position (x,y) in [0,1)^2, and
+//                                                  new matter there, as a drag of the mouse does
+//                    set dt <value> | set visc <value>
+//                    pause | resume
+//                    key <c>                       the key c, as in the window
+//
+//                  The server sends, for every subscribed step, one message per field: a stream_message followed
+//                  by 'size' bytes of payload. The values of a field are dim x dim, value (i,j) at index i + dim * j.
+//                    STREAM_F32: the values as floats.
+//                    STREAM_U16, STREAM_U8: values q, with value = offset + q * scale.
+//                    with STREAM_DELTA: the differences of q to q of the previous message of that field, modulo
+//                          2^16 or 2^8, as bytes in which a zero byte is followed by a count byte: that many zero
+//                          bytes. A message without STREAM_DELTA is a key frame that restarts the differences; the
+//                          server sends one when it drops messages of a client that does not keep up, when the
+//                          values leave the range of the last key frame, and every STREAM_KEY_INTERVAL messages.
+//--------------------------------------------------------------------------------------------------
+
+#ifndef STREAM_FRAMES_H
+#define STREAM_FRAMES_H
+
+#define STREAM_PATH "/tmp/smoke.sock"   //default path of the socket
+#define STREAM_MAGIC 0x4d525453         //"STRM"
+#define STREAM_KEY_INTERVAL 32          //messages between key frames of a delta-encoded field
+
+enum { STREAM_VX, STREAM_VY, STREAM_RHO, STREAM_FIELDS };
+
+#define STREAM_F32 0
+#define STREAM_U16 1
+#define STREAM_U8 2
+#define STREAM_DELTA 0x10               //flag on STREAM_U16 or STREAM_U8
+
+typedef struct
+{
+	unsigned int magic;             //STREAM_MAGIC
+	unsigned int frame;             //simulation step
+	unsigned short field;           //STREAM_VX, STREAM_VY or STREAM_RHO
+	unsigned short encoding;        //STREAM_F32, STREAM_U16 or STREAM_U8, possibly with STREAM_DELTA
+	unsigned int dim;               //the field is dim x dim values
+	float offset, scale;            //value = offset + q * scale, for the quantized encodings
+	unsigned int size;              //bytes of payload after this header
+} stream_message;                   //28 bytes
+
+#endif
@@ -0,0 +1,543 @@
+// tracer.c: Streamline and particle tracing in batches (see tracer.h).
+//
+//           Positions are in the grid coordinates of the solver: grid point (i,j) is at (i,j), and a velocity v
+//           moves a point by n*v cells per unit of time, as in the backtrace of solve(). The field is sampled
+//           with the same periodic bilinear interpolation as the solver.
+//           Pathlines and streaklines are traced through the frames of a velocity history instead, interpolated
+//           in time between the frames: the step from frame a+1 to frame a samples the field at ages between them.
+//--------------------------------------------------------------------------------------------------
+
+#include "tracer.h"
+#include "fluids.h"
+#include <GL/glut.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+//trace_field: the field a trace samples: the current field (vx,vy), or the step ending at frame 'age' of 'history'
+typedef struct
+{
+	int n;
+	const fftw_real *vx, *vy;
+	const velocity_history *history;
+	int age;
+} trace_field;
+
+//trace_sample: bilinear, periodic samples (u,v) of the field at the 'count' (at most TRACE_BATCH) points (x,y) +
+//              a * (du,dv), or at (x,y) when du is NULL, at 'stage' (0 to 1) of the time step. The current field does
+//              not depend on the stage. Its sampling loop has no branches and no integer division, so that the compiler
+//              vectorizes it (emulating the gathers of the four corners where the instruction set has none): the cell
+//              is found with a truncation corrected to the floor, and wrapped with a multiply by 1/n plus a conditional
+//              add or subtract of n. This gives the samples of wrap() in solve().
+static void trace_sample(const trace_field *f, float stage, int count, const float *x, const float *y,
+                         float a, const float *du, const float *dv, float *u, float *v)
+{
+	int n = f->n, l;
+	float rn = 1.0f / n, ax[TRACE_BATCH], ay[TRACE_BATCH];
+	const fftw_real *vx = f->vx, *vy = f->vy;
+	const float *px = x, *py = y;
+
+	if (du)
+	{
+		for (l = 0; l < count; l++)
+		{
+			ax[l] = x[l] + a * du[l];
+			ay[l] = y[l] + a * dv[l];
+		}
+		px = ax; py = ay;
+	}
+	if (f->history)
+	{
+		for (l = 0; l < count; l++)
+			history_velocity_at(f->history, f->age + 1 - stage, px[l], py[l], u + l, v + l);
+		return;
+	}
+	for (l = 0; l < count; l++)
+	{
+		int i = (int)px[l], j = (int)py[l], i0, i1, j0, j1;
+		fftw_real s, t;
+
+		i -= px[l] < (float)i;                  //the floor of the coordinates
+		j -= py[l] < (float)j;
+		s = (fftw_real)px[l] - i;
+		t = (fftw_real)py[l] - j;
+		i0 = i - n * (int)((float)i * rn);      //within one period of [0,n), then into it
+		j0 = j - n * (int)((float)j * rn);
+		i0 += (i0 < 0) ? n : 0;
+		j0 += (j0 < 0) ? n : 0;
+		i0 -= (i0 >= n) ? n : 0;
+		j0 -= (j0 >= n) ? n : 0;
+		i1 = (i0 + 1 < n) ? i0 + 1 : 0;
+		j1 = (j0 + 1 < n) ? j0 + 1 : 0;
+		u[l] = (float)((1-s)*((1-t)*vx[i0+n*j0]+t*vx[i0+n*j1])+s*((1-t)*vx[i1+n*j0]+t*vx[i1+n*j1]));
+		v[l] = (float)((1-s)*((1-t)*vy[i0+n*j0]+t*vy[i0+n*j1])+s*((1-t)*vy[i1+n*j0]+t*vy[i1+n*j1]));
+	}
+}
+
+//trace_direction: turn the velocities (u,v) into unit directions; points where the flow stands still get
+//                 a zero direction and stay where they are
+static void trace_direction(int count, float *u, float *v)
+{
+	int l;
+	for (l = 0; l < count; l++)
+	{
+		float len = (float)sqrt(u[l] * u[l] + v[l] * v[l]);
+		float f = (len > 1e-12f) ? 1.0f / len : 0.0f;
+		u[l] *= f;
+		v[l] *= f;
+	}
+}
+
+//trace_step: advance the 'count' points (x,y) by one step of size h, with RK2 or RK4. If 'unit' is set, the
+//            velocity is normalized at every stage (streamlines: constant step length in space); otherwise h is a
+//            time step times n (particles), or a time step for a field from the history (which is in cells per
+//            unit of time already). The speed at the start point is returned in 'speed'. The stages alternate
+//            between (ku,kv) and (mu,mv): each is sampled at (x,y) plus a multiple of the other.
+static void trace_step(const tracer *t, const trace_field *f, int count,
+                       float *x, float *y, float h, int unit, float *speed)
+{
+	float ku[TRACE_BATCH], kv[TRACE_BATCH];
+	float mu[TRACE_BATCH], mv[TRACE_BATCH];
+	float su[TRACE_BATCH], sv[TRACE_BATCH];
+	int l;
+
+	trace_sample(f, 0, count, x, y, 0, 0, 0, ku, kv);
+	for (l = 0; l < count; l++)
+		speed[l] = (float)sqrt(ku[l] * ku[l] + kv[l] * kv[l]);
+	if (unit) trace_direction(count, ku, kv);
+
+	if (t->order == 4)
+	{
+		trace_sample(f, 0.5f, count, x, y, 0.5f * h, ku, kv, mu, mv);
+		if (unit) trace_direction(count, mu, mv);
+		for (l = 0; l < count; l++)
+		{
+			su[l] = ku[l] + 2 * mu[l]; sv[l] = kv[l] + 2 * mv[l];
+		}
+		trace_sample(f, 0.5f, count, x, y, 0.5f * h, mu, mv, ku, kv);
+		if (unit) trace_direction(count, ku, kv);
+		for (l = 0; l < count; l++)
+		{
+			su[l] += 2 * ku[l];        sv[l] += 2 * kv[l];
+		}
+		trace_sample(f, 1, count, x, y, h, ku, kv, mu, mv);
+		if (unit) trace_direction(count, mu, mv);
+		for (l = 0; l < count; l++)
+		{
+			x[l] += h / 6 * (su[l] + mu[l]);
+			y[l] += h / 6 * (sv[l] + mv[l]);
+		}
+	}
+	else
+	{
+		trace_sample(f, 0.5f, count, x, y, 0.5f * h, ku, kv, mu, mv);
+		if (unit) trace_direction(count, mu, mv);
+		for (l = 0; l < count; l++)
+		{
+			x[l] += h * mu[l];
+			y[l] += h * mv[l];
+		}
+	}
+}
+
+//trace_color: colour of a vertex moving at 'speed', on the rainbow scale of [0,max_speed]
+static void trace_color(unsigned char *rgba, float speed, float max_speed)
+{
+	float R, G, B;
+	rainbow((max_speed > 0) ? speed / max_speed : 0, &R, &G, &B);
+	rgba[0] = (unsigned char)(255 * R);
+	rgba[1] = (unsigned char)(255 * G);
+	rgba[2] = (unsigned char)(255 * B);
+	rgba[3] = 255;
+}
+
+//trace_hash: pseudo-random number in [0,1) for particle 'i' in its generation 'g'; no state, so threads
+//            can reseed particles independently
+static float trace_hash(unsigned int i, unsigned int g)
+{
+	unsigned int h = i * 2654435761u ^ (g + 0x9e3779b9u) * 2246822519u;
+	h ^= h >> 15; h *= 2246822519u; h ^= h >> 13; h *= 3266489917u; h ^= h >> 16;
+	return (h >> 8) * (1.0f / 16777216.0f);
+}
+
+//tracer_seed: position of seed 's' of a seeds_x x seeds_y grid of seeds spread over the drawn domain [0,n-1]^2
+static void tracer_seed(int n, int s, int seeds_x, int seeds_y, float *x, float *y)
+{
+	*x = (s % seeds_x + 0.5f) * (n - 1) / seeds_x;
+	*y = (s / seeds_x + 0.5f) * (n - 1) / seeds_y;
+}
+
+void tracer_init(tracer *t, int seeds_x, int seeds_y, int steps, int particles)
+{
+	int i;
+
+	memset(t, 0, sizeof(*t));
+	t->order = 2;
+	t->seeds_x = seeds_x;
+	t->seeds_y = seeds_y;
+	t->steps = steps;
+	t->step = 0.5f;
+	t->lines = (trace_vertex*) malloc(seeds_x * seeds_y * (steps + 1) * sizeof(trace_vertex));
+	t->line_length = (int*) calloc(seeds_x * seeds_y, sizeof(int));
+
+	t->lifetime = 4.0f;
+	t->particles.capacity = particles;
+	t->particles.x = (float*) malloc(particles * sizeof(float));
+	t->particles.y = (float*) malloc(particles * sizeof(float));
+	t->particles.age = (float*) malloc(particles * sizeof(float));
+	t->particles.generation = (int*) calloc(particles, sizeof(int));
+	t->points = (trace_vertex*) calloc(particles, sizeof(trace_vertex));
+	for (i = 0; i < particles; i++)             //start with ages spread over the lifetime, so reseeding is spread over time
+	{
+		t->particles.x[i] = -1;
+		t->particles.age[i] = t->lifetime * trace_hash(i, 0xffffffffu);
+	}
+}
+
+//tracer_init_time_lines: set up pathlines over the last 'length' steps and streaklines of 'length' particles,
+//                        from a seeds_x x seeds_y grid of seeds
+void tracer_init_time_lines(tracer *t, int seeds_x, int seeds_y, int length)
+{
+	int nseeds = seeds_x * seeds_y;
+
+	t->time_seeds_x = seeds_x;
+	t->time_seeds_y = seeds_y;
+	t->length = length;
+	t->paths = (trace_vertex*) malloc(nseeds * (length + 1) * sizeof(trace_vertex));
+	t->path_length = (int*) calloc(nseeds, sizeof(int));
+	t->streak_x = (float*) calloc(nseeds * length, sizeof(float));
+	t->streak_y = (float*) calloc(nseeds * length, sizeof(float));
+	t->streaks = (trace_vertex*) malloc(nseeds * length * sizeof(trace_vertex));
+	t->streak_length = (int*) calloc(nseeds, sizeof(int));
+}
+
+void tracer_free(tracer *t)
+{
+	free(t->lines);
+	free(t->line_length);
+	free(t->particles.x);
+	free(t->particles.y);
+	free(t->particles.age);
+	free(t->particles.generation);
+	free(t->points);
+	free(t->paths);
+	free(t->path_length);
+	free(t->streak_x);
+	free(t->streak_y);
+	free(t->streaks);
+	free(t->streak_length);
+	memset(t, 0, sizeof(*t));
+}
+
+//tracer_streamlines: trace a streamline from every seed, forward along the velocity, until it has 'steps' steps,
+//                    leaves the drawn domain [0,n-1]^2 or reaches a point where the flow stands still
+void tracer_streamlines(tracer *t, int n, const fftw_real *vx, const fftw_real *vy)
+{
+	int nseeds = t->seeds_x * t->seeds_y;
+	int nbatches = (nseeds + TRACE_BATCH - 1) / TRACE_BATCH;
+	float max_speed = 0;
+	trace_field f = { n, vx, vy, 0, 0 };
+	int b;
+
+#pragma omp parallel
+	{
+		float local_max = 0;
+
+#pragma omp for schedule(dynamic)
+		for (b = 0; b < nbatches; b++)
+		{
+			float x[TRACE_BATCH], y[TRACE_BATCH], speed[TRACE_BATCH];
+			int alive[TRACE_BATCH];
+			int first = b * TRACE_BATCH;
+			int count = (nseeds - first < TRACE_BATCH) ? nseeds - first : TRACE_BATCH;
+			int l, k, nalive = count;
+
+			for (l = 0; l < count; l++)
+			{
+				tracer_seed(n, first + l, t->seeds_x, t->seeds_y, x + l, y + l);
+				alive[l] = 1;
+				t->line_length[first + l] = 0;
+			}
+
+			for (k = 0; k <= t->steps && nalive > 0; k++)
+			{
+				float ox[TRACE_BATCH], oy[TRACE_BATCH];
+
+				memcpy(ox, x, count * sizeof(float));
+				memcpy(oy, y, count * sizeof(float));
+				trace_step(t, &f, count, x, y, t->step, 1, speed);
+
+				for (l = 0; l < count; l++)
+				{
+					trace_vertex *v;
+					if (!alive[l]) continue;
+					v = t->lines + (first + l) * (t->steps + 1) + k;
+					v->x = ox[l];
+					v->y = oy[l];
+					trace_color(v->rgba, speed[l], t->line_max_speed);
+					t->line_length[first + l] = k + 1;
+					if (speed[l] > local_max) local_max = speed[l];
+					if (speed[l] < 1e-12f || x[l] < 0 || x[l] > n - 1 || y[l] < 0 || y[l] > n - 1)
+					{
+						alive[l] = 0;
+						nalive--;
+					}
+				}
+			}
+		}
+#pragma omp critical
+		if (local_max > max_speed) max_speed = local_max;
+	}
+	t->line_max_speed = max_speed;
+}
+
+//tracer_advect_particles: move every particle along the flow over a time 'dt'; particles older than the
+//                         lifetime are reseeded at a random point of the domain
+void tracer_advect_particles(tracer *t, int n, const fftw_real *vx, const fftw_real *vy, float dt)
+{
+	particle_pool *p = &t->particles;
+	int nbatches = (p->capacity + TRACE_BATCH - 1) / TRACE_BATCH;
+	float max_speed = 0;
+	trace_field f = { n, vx, vy, 0, 0 };
+	int b;
+
+#pragma omp parallel
+	{
+		float local_max = 0;
+
+#pragma omp for schedule(dynamic)
+		for (b = 0; b < nbatches; b++)
+		{
+			float speed[TRACE_BATCH];
+			int first = b * TRACE_BATCH;
+			int count = (p->capacity - first < TRACE_BATCH) ? p->capacity - first : TRACE_BATCH;
+			float *x = p->x + first, *y = p->y + first;
+			int l;
+
+			for (l = 0; l < count; l++)
+			{
+				int i = first + l;
+				p->age[i] += dt;
+				if (p->age[i] >= t->lifetime || x[l] < 0)
+				{
+					p->generation[i]++;
+					x[l] = (n - 1) * trace_hash(i, 2 * p->generation[i]);
+					y[l] = (n - 1) * trace_hash(i, 2 * p->generation[i] + 1);
+					p->age[i] = 0;
+				}
+			}
+
+			trace_step(t, &f, count, x, y, dt * n, 0, speed);
+
+			for (l = 0; l < count; l++)
+			{
+				trace_vertex *v = t->points + first + l;
+				x[l] = (float)fmod(x[l] + n, n);    //the domain is periodic
+				y[l] = (float)fmod(y[l] + n, n);
+				v->x = x[l];
+				v->y = y[l];
+				trace_color(v->rgba, speed[l], t->particle_max_speed);
+				if (speed[l] > local_max) local_max = speed[l];
+			}
+		}
+#pragma omp critical
+		if (local_max > max_speed) max_speed = local_max;
+	}
+	t->particle_max_speed = max_speed;
+}
+
+//tracer_pathlines: trace a pathline from every seed through the frames of 'h', from the oldest of the last
+//                  'length' steps to the newest, until it leaves the drawn domain [0,n-1]^2
+void tracer_pathlines(tracer *t, const velocity_history *h)
+{
+	int n = h->n, nseeds = t->time_seeds_x * t->time_seeds_y;
+	int nbatches = (nseeds + TRACE_BATCH - 1) / TRACE_BATCH;
+	int steps = (h->count - 1 < t->length) ? h->count - 1 : t->length;
+	float max_speed = 0;
+	int b;
+
+#pragma omp parallel
+	{
+		float local_max = 0;
+
+#pragma omp for schedule(dynamic)
+		for (b = 0; b < nbatches; b++)
+		{
+			float x[TRACE_BATCH], y[TRACE_BATCH], speed[TRACE_BATCH];
+			int alive[TRACE_BATCH];
+			int first = b * TRACE_BATCH;
+			int count = (nseeds - first < TRACE_BATCH) ? nseeds - first : TRACE_BATCH;
+			int l, k, nalive = count;
+			trace_field f = { n, 0, 0, h, 0 };
+
+			for (l = 0; l < count; l++)
+			{
+				tracer_seed(n, first + l, t->time_seeds_x, t->time_seeds_y, x + l, y + l);
+				alive[l] = 1;
+				t->path_length[first + l] = 0;
+			}
+
+			for (k = 0; k <= steps && nalive > 0; k++)
+			{
+				float ox[TRACE_BATCH], oy[TRACE_BATCH];
+
+				memcpy(ox, x, count * sizeof(float));
+				memcpy(oy, y, count * sizeof(float));
+				if (k < steps)                          //the step from frame steps-k to frame steps-k-1
+				{
+					f.age = steps - k - 1;
+					trace_step(t, &f, count, x, y, h->dt[history_slot(h, f.age)], 0, speed);
+				}
+				else                                    //the newest frame: only its speed
+				{
+					float u[TRACE_BATCH], v[TRACE_BATCH];
+					f.age = 0;
+					trace_sample(&f, 1, count, x, y, 0, 0, 0, u, v);
+					for (l = 0; l < count; l++)
+						speed[l] = (float)sqrt(u[l] * u[l] + v[l] * v[l]);
+				}
+
+				for (l = 0; l < count; l++)
+				{
+					trace_vertex *v;
+					if (!alive[l]) continue;
+					v = t->paths + (first + l) * (t->length + 1) + k;
+					v->x = ox[l];
+					v->y = oy[l];
+					trace_color(v->rgba, speed[l], t->path_max_speed);
+					t->path_length[first + l] = k + 1;
+					if (speed[l] > local_max) local_max = speed[l];
+					if (x[l] < 0 || x[l] > n - 1 || y[l] < 0 || y[l] > n - 1)
+					{
+						alive[l] = 0;
+						nalive--;
+					}
+				}
+			}
+		}
+#pragma omp critical
+		if (local_max > max_speed) max_speed = local_max;
+	}
+	t->path_max_speed = max_speed;
+}
+
+//tracer_advect_streaks: bring the streaklines up to date with the frames pushed to 'h' since the last call: for every
+//                       new frame, move the emitted particles over its step and emit a new particle at every seed.
+//                       After a gap longer than the history, the streaklines start again.
+void tracer_advect_streaks(tracer *t, const velocity_history *h)
+{
+	int n = h->n, nseeds = t->time_seeds_x * t->time_seeds_y, total = nseeds * t->length;
+	int frames = h->pushed - t->streak_frame, age, b, s;
+
+	if (frames == 0 || h->count == 0) return;
+	if (t->streak_frame == 0 || frames < 0 || frames > h->count)
+	{
+		t->emitted = 0;
+		frames = 1;
+	}
+
+	for (age = frames - 1; age >= 0; age--)
+	{
+		if (t->emitted > 0)
+		{
+			//only the first 'active' slots of every seed hold particles; once all do, they are one contiguous span
+			int active = (t->emitted < t->length) ? t->emitted : t->length;
+			int segments = (active == t->length) ? 1 : nseeds, span = (active == t->length) ? total : active;
+			int chunks = (span + TRACE_BATCH - 1) / TRACE_BATCH, nbatches = segments * chunks;
+
+#pragma omp parallel for schedule(dynamic)
+			for (b = 0; b < nbatches; b++)
+			{
+				float speed[TRACE_BATCH];
+				int c = (b % chunks) * TRACE_BATCH, first = (b / chunks) * t->length + c;
+				int count = (span - c < TRACE_BATCH) ? span - c : TRACE_BATCH;
+				trace_field f = { n, 0, 0, h, 0 };
+
+				f.age = age;
+				trace_step(t, &f, count, t->streak_x + first, t->streak_y + first,
+				           h->dt[history_slot(h, age)], 0, speed);
+			}
+		}
+		for (s = 0; s < nseeds; s++)            //emit, replacing the oldest particle of every seed
+		{
+			int p = s * t->length + t->emitted % t->length;
+			tracer_seed(n, s, t->time_seeds_x, t->time_seeds_y, t->streak_x + p, t->streak_y + p);
+		}
+		t->emitted++;
+	}
+	t->streak_frame = h->pushed;
+
+#pragma omp parallel for
+	for (s = 0; s < nseeds; s++)                //the streaklines, newest particle first, up to the domain border
+	{
+		int count = (t->emitted < t->length) ? t->emitted : t->length, c;
+		trace_vertex *v = t->streaks + s * t->length;
+
+		for (c = 0; c < count; c++)
+		{
+			int p = s * t->length + (t->emitted - 1 - c) % t->length;
+			float x = t->streak_x[p], y = t->streak_y[p];
+			if (x < 0 || x > n - 1 || y < 0 || y > n - 1) break;
+			v[c].x = x;
+			v[c].y = y;
+			trace_color(v[c].rgba, (float)(t->length - c), (float)t->length);
+		}
+		t->streak_length[s] = c;
+	}
+}
+
+//trace_draw_lines: draw 'nlines' line strips, strip s with length[s] vertices from vertex s*stride of 'v', with grid
+//                  point (i,j) at window position (wn+i*wn, hn+j*hn) like the smoke
+static void trace_draw_lines(const trace_vertex *v, const int *length, int nlines, int stride, float wn, float hn)
+{
+	int s;
+
+	glPushMatrix();
+	glTranslatef(wn, hn, 0);
+	glScalef(wn, hn, 1);
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_COLOR_ARRAY);
+	glVertexPointer(2, GL_FLOAT, sizeof(trace_vertex), &v[0].x);
+	glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(trace_vertex), v[0].rgba);
+	for (s = 0; s < nlines; s++)
+		if (length[s] > 1)
+			glDrawArrays(GL_LINE_STRIP, s * stride, length[s]);
+	glDisableClientState(GL_COLOR_ARRAY);
+	glDisableClientState(GL_VERTEX_ARRAY);
+	glPopMatrix();
+}
+
+//tracer_draw_streamlines: draw the streamlines of the last trace
+void tracer_draw_streamlines(const tracer *t, float wn, float hn)
+{
+	trace_draw_lines(t->lines, t->line_length, t->seeds_x * t->seeds_y, t->steps + 1, wn, hn);
+}
+
+//tracer_draw_pathlines: draw the pathlines of the last trace
+void tracer_draw_pathlines(const tracer *t, float wn, float hn)
+{
+	trace_draw_lines(t->paths, t->path_length, t->time_seeds_x * t->time_seeds_y, t->length + 1, wn, hn);
+}
+
+//tracer_draw_streaklines: draw the streaklines as they were after the last update
+void tracer_draw_streaklines(const tracer *t, float wn, float hn)
+{
+	trace_draw_lines(t->streaks, t->streak_length, t->time_seeds_x * t->time_seeds_y, t->length, wn, hn);
+}
+
+//tracer_draw_particles: draw the particles at their current positions
+void tracer_draw_particles(const tracer *t, float wn, float hn)
+{
+	glPushMatrix();
+	glTranslatef(wn, hn, 0);
+	glScalef(wn, hn, 1);
+	glPointSize(2);
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_COLOR_ARRAY);
+	glVertexPointer(2, GL_FLOAT, sizeof(trace_vertex), &t->points[0].x);
+	glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(trace_vertex), t->points[0].rgba);
+	glDrawArrays(GL_POINTS, 0, t->particles.capacity);
+	glDisableClientState(GL_COLOR_ARRAY);
+	glDisableClientState(GL_VERTEX_ARRAY);
+	glPopMatrix();
+}
@@ -0,0 +1,73 @@
+// tracer.h: Streamlines and advected particles over the velocity field (vx,vy).
+//           Seeds and particles are traced in batches of TRACE_BATCH, one batch per thread at a time, with the
+//           state of a batch held as arrays (structure of arrays) so that every integration stage samples the
+//           field for the whole batch in one loop. All buffers are allocated by the init functions; tracing a frame
+//           allocates nothing and writes its geometry straight into the vertex arrays that are drawn.
+//           Pathlines and streaklines follow the unsteady flow through the frames of a velocity history. The
+//           streaklines are kept up to date incrementally: every step, the particles already emitted move one
+//           step and every seed emits one new particle.
+//--------------------------------------------------------------------------------------------------
+
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <rfftw.h>
+#include "history.h"
+
+#define TRACE_BATCH 64          //seeds or particles traced together, in lock step
+
+typedef struct
+{
+	float x, y;                 //position, in grid coordinates
+	unsigned char rgba[4];      //colour (by speed)
+} trace_vertex;
+
+typedef struct
+{
+	int capacity;               //number of particles
+	float *x, *y;               //positions, in grid coordinates
+	float *age;                 //time since the particle was (re)seeded
+	int *generation;            //number of times the particle was reseeded, to pick its next seed point
+} particle_pool;
+
+typedef struct
+{
+	int order;                  //integration order: 2 (midpoint rule) or 4 (classic Runge-Kutta)
+
+	int seeds_x, seeds_y;       //streamlines are seeded on a regular seeds_x x seeds_y grid
+	int steps;                  //integration steps per streamline
+	float step;                 //length of an integration step along a streamline, in cells
+	trace_vertex *lines;        //steps + 1 vertices per seed
+	int *line_length;           //number of vertices of each streamline
+	float line_max_speed;       //largest speed met by the last trace, for the colour scale
+
+	particle_pool particles;
+	float lifetime;             //particles are reseeded after this much time
+	trace_vertex *points;       //current particle positions
+	float particle_max_speed;   //largest particle speed in the last step, for the colour scale
+
+	int time_seeds_x, time_seeds_y;   //pathlines and streaklines are seeded on a regular grid of this size
+	int length;                 //pathlines span the last 'length' steps; streaklines hold 'length' particles
+	trace_vertex *paths;        //length + 1 vertices per seed, oldest first
+	int *path_length;           //number of vertices of each pathline
+	float path_max_speed;       //largest speed met by the last pathlines, for the colour scale
+	float *streak_x, *streak_y; //ring buffer of 'length' particle positions per seed, in emission order
+	int emitted;                //particles emitted per seed so far
+	int streak_frame;           //number of history frames the streaklines were advanced through
+	trace_vertex *streaks;      //length vertices per seed, newest particle first, coloured by age
+	int *streak_length;         //number of vertices of each streakline
+} tracer;
+
+void tracer_init(tracer *t, int seeds_x, int seeds_y, int steps, int particles);
+void tracer_init_time_lines(tracer *t, int seeds_x, int seeds_y, int length);
+void tracer_free(tracer *t);
+void tracer_streamlines(tracer *t, int n, const fftw_real *vx, const fftw_real *vy);
+void tracer_advect_particles(tracer *t, int n, const fftw_real *vx, const fftw_real *vy, float dt);
+void tracer_draw_streamlines(const tracer *t, float wn, float hn);
+void tracer_draw_particles(const tracer *t, float wn, float hn);
+void tracer_pathlines(tracer *t, const velocity_history *h);
+void tracer_advect_streaks(tracer *t, const velocity_history *h);
+void tracer_draw_pathlines(const tracer *t, float wn, float hn);
+void tracer_draw_streaklines(const tracer *t, float wn, float hn);
+
+#endif
@@ -0,0 +1,297 @@
+// video.c: Uncompressed video output (see video.h).
+//--------------------------------------------------------------------------------------------------
+
+#include "video.h"
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#define popen _popen
+#define pclose _pclose
+#define writer_lock(v)   EnterCriticalSection(&(v)->lock)
+#define writer_unlock(v) LeaveCriticalSection(&(v)->lock)
+#define writer_wait(v)   SleepConditionVariableCS(&(v)->wake, &(v)->lock, INFINITE)
+#define writer_wake(v)   WakeAllConditionVariable(&(v)->wake)
+#else
+#include <signal.h>
+#define writer_lock(v)   pthread_mutex_lock(&(v)->lock)
+#define writer_unlock(v) pthread_mutex_unlock(&(v)->lock)
+#define writer_wait(v)   pthread_cond_wait(&(v)->wake, &(v)->lock)
+#define writer_wake(v)   pthread_cond_broadcast(&(v)->wake)
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VIDEO_SSE2
+#include <emmintrin.h>
+#endif
+
+//BT.601 with the studio range, in 8-bit fixed point: Y = (66 R + 129 G + 25 B + 4224) >> 8, and U and V likewise
+#define Y_BIAS (16 * 256 + 128)
+#define C_BIAS (128 * 256 + 128)
+
+static __inline unsigned char luma(const unsigned char *p)
+{
+	return (unsigned char)((66 * p[0] + 129 * p[1] + 25 * p[2] + Y_BIAS) >> 8);
+}
+
+#define average(a, b) (((a) + (b) + 1) >> 1)    //rounds as _mm_avg_epu8
+
+//chroma: U and V of the 2 x 2 pixels at 'p' (row above) and 'q' (row below)
+static __inline void chroma(const unsigned char *p, const unsigned char *q, unsigned char *u, unsigned char *v)
+{
+	int c[3], k;
+
+	for (k = 0; k < 3; k++)
+		c[k] = average(average(p[k], q[k]), average(p[4 + k], q[4 + k]));
+	*u = (unsigned char)((-38 * c[0] - 74 * c[1] + 112 * c[2] + C_BIAS) >> 8);
+	*v = (unsigned char)((112 * c[0] - 94 * c[1] - 18 * c[2] + C_BIAS) >> 8);
+}
+
+#ifdef VIDEO_SSE2
+//dot4: c0 R + c1 G + c2 B of 4 RGBX pixels, as 4 32-bit integers; 'coefficients' holds c0 c1 c2 0 twice
+static __inline __m128i dot4(__m128i pixels, __m128i coefficients)
+{
+	__m128i zero = _mm_setzero_si128();
+	__m128i lo = _mm_madd_epi16(_mm_unpacklo_epi8(pixels, zero), coefficients);   //c0 R + c1 G, c2 B per pixel
+	__m128i hi = _mm_madd_epi16(_mm_unpackhi_epi8(pixels, zero), coefficients);
+
+	lo = _mm_add_epi32(lo, _mm_srli_epi64(lo, 32));
+	hi = _mm_add_epi32(hi, _mm_srli_epi64(hi, 32));
+	return _mm_unpacklo_epi64(_mm_shuffle_epi32(lo, _MM_SHUFFLE(3, 3, 2, 0)), _mm_shuffle_epi32(hi, _MM_SHUFFLE(3, 3, 2, 0)));
+}
+
+//pack16: the 16 values of a..d (each 4 32-bit integers, plus 'bias', over 256) as bytes
+static __inline __m128i pack16(__m128i a, __m128i b, __m128i c, __m128i d, __m128i bias)
+{
+	a = _mm_srai_epi32(_mm_add_epi32(a, bias), 8);
+	b = _mm_srai_epi32(_mm_add_epi32(b, bias), 8);
+	c = _mm_srai_epi32(_mm_add_epi32(c, bias), 8);
+	d = _mm_srai_epi32(_mm_add_epi32(d, bias), 8);
+	return _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+}
+
+//block_average: the averages of the 2 x 2 blocks of the 8 pixels at 'p' and the 8 below them at 'q', as 4 pixels
+static __inline __m128i block_average(const unsigned char *p, const unsigned char *q)
+{
+	__m128i a = _mm_avg_epu8(_mm_loadu_si128((const __m128i*)p), _mm_loadu_si128((const __m128i*)q));
+	__m128i b = _mm_avg_epu8(_mm_loadu_si128((const __m128i*)(p + 16)), _mm_loadu_si128((const __m128i*)(q + 16)));
+
+	a = _mm_shuffle_epi32(_mm_avg_epu8(a, _mm_srli_si128(a, 4)), _MM_SHUFFLE(3, 1, 2, 0));
+	b = _mm_shuffle_epi32(_mm_avg_epu8(b, _mm_srli_si128(b, 4)), _MM_SHUFFLE(3, 1, 2, 0));
+	return _mm_unpacklo_epi64(a, b);
+}
+#endif
+
+//video_rgbx_to_yuv420: convert the width x height RGBX image (width and height even) to the planes y (width x height)
+//                      and u and v (width/2 x height/2)
+void video_rgbx_to_yuv420(const unsigned char *rgbx, int width, int height, unsigned char *y, unsigned char *u, unsigned char *v)
+{
+	int i, j;
+
+	for (j = 0; j < height; j += 2)
+	{
+		const unsigned char *p = rgbx + 4 * (size_t)width * j, *q = p + 4 * width;
+		unsigned char *y0 = y + (size_t)width * j, *y1 = y0 + width;
+		unsigned char *uj = u + (size_t)(width / 2) * (j / 2), *vj = v + (size_t)(width / 2) * (j / 2);
+
+		i = 0;
+#ifdef VIDEO_SSE2
+		{
+			const __m128i cy = _mm_setr_epi16(66, 129, 25, 0, 66, 129, 25, 0);
+			const __m128i cu = _mm_setr_epi16(-38, -74, 112, 0, -38, -74, 112, 0);
+			const __m128i cv = _mm_setr_epi16(112, -94, -18, 0, 112, -94, -18, 0);
+			const __m128i ybias = _mm_set1_epi32(Y_BIAS), cbias = _mm_set1_epi32(C_BIAS);
+
+			for (; i + 16 <= width; i += 16)
+			{
+				const unsigned char *a = p + 4 * i, *b = q + 4 * i;
+				__m128i c0, c1, c2, c3;
+
+				_mm_storeu_si128((__m128i*)(y0 + i), pack16(dot4(_mm_loadu_si128((const __m128i*)a), cy),
+				        dot4(_mm_loadu_si128((const __m128i*)(a + 16)), cy), dot4(_mm_loadu_si128((const __m128i*)(a + 32)), cy),
+				        dot4(_mm_loadu_si128((const __m128i*)(a + 48)), cy), ybias));
+				_mm_storeu_si128((__m128i*)(y1 + i), pack16(dot4(_mm_loadu_si128((const __m128i*)b), cy),
+				        dot4(_mm_loadu_si128((const __m128i*)(b + 16)), cy), dot4(_mm_loadu_si128((const __m128i*)(b + 32)), cy),
+				        dot4(_mm_loadu_si128((const __m128i*)(b + 48)), cy), ybias));
+				c0 = block_average(a, b);               //the 8 blocks of these 16 x 2 pixels
+				c1 = block_average(a + 32, b + 32);
+				_mm_storel_epi64((__m128i*)(uj + i / 2), pack16(dot4(c0, cu), dot4(c1, cu), dot4(c0, cu), dot4(c1, cu), cbias));
+				c2 = dot4(c0, cv);
+				c3 = dot4(c1, cv);
+				_mm_storel_epi64((__m128i*)(vj + i / 2), pack16(c2, c3, c2, c3, cbias));
+			}
+		}
+#endif
+		for (; i < width; i += 2)
+		{
+			y0[i] = luma(p + 4 * i); y0[i + 1] = luma(p + 4 * i + 4);
+			y1[i] = luma(q + 4 * i); y1[i + 1] = luma(q + 4 * i + 4);
+			chroma(p + 4 * i, q + 4 * i, uj + i / 2, vj + i / 2);
+		}
+	}
+}
+
+//write_frame: convert the RGBX 'frame' to the output format and write it
+static int write_frame(video_output *v, const unsigned char *frame)
+{
+	size_t pixels = (size_t)v->width * v->height, size;
+	unsigned char *out = v->converted;
+
+	if (v->format == VIDEO_Y4M)
+	{
+		video_rgbx_to_yuv420(frame, v->width, v->height, out, out + pixels, out + pixels + pixels / 4);
+		size = pixels + pixels / 2;
+		if (fputs("FRAME\n", v->out) == EOF) return -1;
+	}
+	else
+	{
+		size_t k;
+		for (k = 0; k < pixels; k++)
+		{
+			out[3 * k] = frame[4 * k]; out[3 * k + 1] = frame[4 * k + 1]; out[3 * k + 2] = frame[4 * k + 2];
+		}
+		size = 3 * pixels;
+	}
+	return fwrite(out, 1, size, v->out) == size ? 0 : -1;
+}
+
+//writer_main: the writer thread: writes the queued frames in order, until video_close
+#ifdef _WIN32
+static DWORD WINAPI writer_main(LPVOID argument)
+#else
+static void *writer_main(void *argument)
+#endif
+{
+	video_output *v = (video_output*) argument;
+
+	writer_lock(v);
+	for (;;)
+	{
+		int result = -1;
+
+		while (!v->count && !v->quit)
+			writer_wait(v);
+		if (!v->count)
+			break;
+		writer_unlock(v);
+		if (!v->failed)                             //after a failed write (a closed pipe) the frames are dropped
+			result = write_frame(v, v->frames[v->head]);
+		writer_lock(v);
+		if (result == 0) v->written++; else v->failed++;
+		v->head = (v->head + 1) % VIDEO_QUEUE;
+		v->count--;
+		writer_wake(v);
+	}
+	writer_unlock(v);
+	return 0;
+}
+
+//video_open: start streaming width x height frames (rounded down to even sizes) at 'fps' frames per second to
+//            'path': a file, or "|command". Returns 0 on success, -1 on failure.
+int video_open(video_output *v, const char *path, int format, int width, int height, int fps)
+{
+	int k;
+
+	memset(v, 0, sizeof(*v));
+	v->format = format;
+	v->width = width & ~1;
+	v->height = height & ~1;
+	v->fps = fps;
+	if (v->width < 2 || v->height < 2) return -1;
+	if (path[0] == '|')
+	{
+#ifndef _WIN32
+		signal(SIGPIPE, SIG_IGN);                   //a command that quits fails the writes instead
+#endif
+		v->out = popen(path + 1, "w");
+		v->pipe = 1;
+	}
+	else
+		v->out = fopen(path, "wb");
+	if (!v->out)
+	{
+		perror("video");
+		return -1;
+	}
+	if (format == VIDEO_Y4M)
+		fprintf(v->out, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n", v->width, v->height, fps);
+	for (k = 0; k < VIDEO_QUEUE; k++)
+		v->frames[k] = (unsigned char*) malloc(4 * (size_t)v->width * v->height);
+	v->converted = (unsigned char*) malloc(3 * (size_t)v->width * v->height);
+
+#ifdef _WIN32
+	InitializeCriticalSection(&v->lock);
+	InitializeConditionVariable(&v->wake);
+	v->thread = CreateThread(NULL, 0, writer_main, v, 0, NULL);
+	v->running = v->thread != NULL;
+#else
+	pthread_mutex_init(&v->lock, NULL);
+	pthread_cond_init(&v->wake, NULL);
+	v->running = pthread_create(&v->thread, NULL, writer_main, v) == 0;
+#endif
+	if (!v->running)
+	{
+		video_close(v);
+		return -1;
+	}
+	return 0;
+}
+
+//video_close: write the frames still queued, and close the output
+void video_close(video_output *v)
+{
+	int k;
+
+	if (!v->out) return;
+	if (v->running)
+	{
+		writer_lock(v);
+		v->quit = 1;
+		writer_wake(v);
+		writer_unlock(v);
+#ifdef _WIN32
+		WaitForSingleObject(v->thread, INFINITE);
+		CloseHandle(v->thread);
+#else
+		pthread_join(v->thread, NULL);
+#endif
+	}
+#ifdef _WIN32
+	DeleteCriticalSection(&v->lock);
+#else
+	pthread_mutex_destroy(&v->lock);
+	pthread_cond_destroy(&v->wake);
+#endif
+	if (v->pipe) pclose(v->out);
+	else fclose(v->out);
+	for (k = 0; k < VIDEO_QUEUE; k++)
+		free(v->frames[k]);
+	free(v->converted);
+	memset(v, 0, sizeof(*v));
+}
+
+//video_frame: a free RGBX frame to render the next frame into, waiting for the writer when the queue is full
+unsigned char *video_frame(video_output *v)
+{
+	unsigned char *frame;
+
+	writer_lock(v);
+	if (v->count == VIDEO_QUEUE)
+		v->stalls++;
+	while (v->count == VIDEO_QUEUE)
+		writer_wait(v);
+	frame = v->frames[(v->head + v->count) % VIDEO_QUEUE];   //the writer does not touch the frames after its own
+	v->rendering = 1;
+	writer_unlock(v);
+	return frame;
+}
+
+//video_submit: queue the frame rendered into the frame of video_frame
+void video_submit(video_output *v)
+{
+	writer_lock(v);
+	if (v->rendering)
+		v->count++;
+	v->rendering = 0;
+	writer_wake(v);
+	writer_unlock(v);
+}
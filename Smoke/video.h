@@ -0,0 +1,54 @@
+// video.h: Streaming rendered frames as uncompressed video, to a file (or named pipe) or to the standard input of a
+//          command ("|ffmpeg -i - movie.mp4"): YUV4MPEG2 (4:2:0, BT.601) or raw 24-bit RGB.
+//
+//          The frames are RGBX, 4 bytes per pixel, top row first. video_frame hands out a free frame of the queue
+//          to render into and video_submit queues it; a writer thread converts the queued frames (RGB to YUV with
+//          SSE2 where available) and writes them. When all VIDEO_QUEUE frames are queued, video_frame waits for
+//          the writer: a slow disk or encoder slows the simulation down instead of using more memory.
+//--------------------------------------------------------------------------------------------------
+
+#ifndef VIDEO_H
+#define VIDEO_H
+
+#include <stdio.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#define VIDEO_Y4M 0
+#define VIDEO_RGB 1
+#define VIDEO_QUEUE 4               //frames rendered but not yet written, at most
+
+typedef struct
+{
+	FILE *out;
+	int pipe;                       //'out' was opened with popen
+	int format, width, height, fps;
+	unsigned char *frames[VIDEO_QUEUE];
+	int head, count;                //queued frames, from frame 'head' on
+	int rendering;                  //a frame was handed out by video_frame and not yet submitted
+	unsigned char *converted;       //the frame in the output format, for the writer
+	int running, quit;
+	int written, failed;
+	int stalls;                     //frames for which the renderer waited for the writer
+#ifdef _WIN32
+	HANDLE thread;
+	CRITICAL_SECTION lock;
+	CONDITION_VARIABLE wake;
+#else
+	pthread_t thread;
+	pthread_mutex_t lock;
+	pthread_cond_t wake;
+#endif
+} video_output;
+
+int  video_open(video_output *v, const char *path, int format, int width, int height, int fps);
+void video_close(video_output *v);
+unsigned char *video_frame(video_output *v);
+void video_submit(video_output *v);
+
+void video_rgbx_to_yuv420(const unsigned char *rgbx, int width, int height, unsigned char *y, unsigned char *u, unsigned char *v);
+
+#endif
@@ -0,0 +1,253 @@
+// vtk_export.c: Time series of VTK image data (see vtk_export.h).
+//--------------------------------------------------------------------------------------------------
+
+#include "vtk_export.h"
+#include "parallel.h"
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#define writer_lock(e)   EnterCriticalSection(&(e)->lock)
+#define writer_unlock(e) LeaveCriticalSection(&(e)->lock)
+#define writer_wait(e)   SleepConditionVariableCS(&(e)->wake, &(e)->lock, INFINITE)
+#define writer_wake(e)   WakeAllConditionVariable(&(e)->wake)
+#else
+#define writer_lock(e)   pthread_mutex_lock(&(e)->lock)
+#define writer_unlock(e) pthread_mutex_unlock(&(e)->lock)
+#define writer_wait(e)   pthread_cond_wait(&(e)->wake, &(e)->lock)
+#define writer_wake(e)   pthread_cond_broadcast(&(e)->wake)
+#endif
+
+static const char *array_names[VTK_ARRAYS] = { "density", "velocity", "force" };
+static const int array_components[VTK_ARRAYS] = { 1, 3, 3 };
+
+static const char *byte_order(void)
+{
+	unsigned int one = 1;
+	return *(unsigned char*)&one ? "LittleEndian" : "BigEndian";
+}
+
+//write_step: write the file of slot 's' and add it to the index
+static int write_step(vtk_export *e, const vtk_slot *s)
+{
+	char path[sizeof(e->prefix) + 16];
+	unsigned long long offset = 0;
+	FILE *file;
+	int a, ok, n = e->n;
+
+	sprintf(path, "%s_%06d.vti", e->prefix, s->frame);
+	file = fopen(path, "wb");
+	if (!file) return -1;
+	fprintf(file, "<?xml version=\"1.0\"?>\n"
+	              "<VTKFile type=\"ImageData\" version=\"1.0\" byte_order=\"%s\" header_type=\"UInt64\">\n"
+	              "  <ImageData WholeExtent=\"0 %d 0 %d 0 0\" Origin=\"0 0 0\" Spacing=\"%.17g %.17g 1\">\n"
+	              "    <FieldData>\n"
+	              "      <DataArray type=\"Float64\" Name=\"TIME\" NumberOfTuples=\"1\" format=\"ascii\">%.17g</DataArray>\n"
+	              "    </FieldData>\n"
+	              "    <Piece Extent=\"0 %d 0 %d 0 0\">\n"
+	              "      <PointData>\n",
+	        byte_order(), n - 1, n - 1, 1.0 / n, 1.0 / n, s->time, n - 1, n - 1);
+	for (a = 0; a < VTK_ARRAYS; a++)
+		if (e->fields & (1 << a))
+		{
+			fprintf(file, "        <DataArray type=\"Float32\" Name=\"%s\" NumberOfComponents=\"%d\" format=\"appended\" offset=\"%llu\"/>\n",
+			        array_names[a], array_components[a], offset);
+			offset += 8 + 4ull * n * n * array_components[a];
+		}
+	fprintf(file, "      </PointData>\n"
+	              "    </Piece>\n"
+	              "  </ImageData>\n"
+	              "  <AppendedData encoding=\"raw\">\n   _");
+	ok = fwrite(s->data, 1, e->size, file) == e->size;
+	fprintf(file, "\n  </AppendedData>\n</VTKFile>\n");
+	ok = (fclose(file) == 0) && ok;
+	if (!ok) return -1;
+
+	fseek(e->index, e->index_end, SEEK_SET);        //the index stays a complete collection
+	fprintf(e->index, "    <DataSet timestep=\"%.17g\" part=\"0\" file=\"%s_%06d.vti\"/>\n", s->time, e->name, s->frame);
+	e->index_end = ftell(e->index);
+	fprintf(e->index, "  </Collection>\n</VTKFile>\n");
+	fflush(e->index);
+	return 0;
+}
+
+//writer_main: the writer thread: writes the slots handed to it in order, until vtk_export_close
+#ifdef _WIN32
+static DWORD WINAPI writer_main(LPVOID argument)
+#else
+static void *writer_main(void *argument)
+#endif
+{
+	vtk_export *e = (vtk_export*) argument;
+
+	writer_lock(e);
+	for (;;)
+	{
+		int result;
+
+		while (!e->count && !e->quit)
+			writer_wait(e);
+		if (!e->count)
+			break;
+		writer_unlock(e);
+		result = write_step(e, e->slots + e->head);
+		writer_lock(e);
+		if (result == 0) e->written++; else e->failed++;
+		e->head = (e->head + 1) % VTK_SLOTS;
+		e->count--;
+		writer_wake(e);
+	}
+	writer_unlock(e);
+	return 0;
+}
+
+//vtk_export_open: export the 'fields' (VTK_DENSITY, VTK_VELOCITY, VTK_FORCE) of the n x n grid every 'every'
+//                 steps, to <prefix>_<step>.vti and <prefix>.pvd. Returns 0 on success, -1 on failure.
+int vtk_export_open(vtk_export *e, const char *prefix, int n, int every, int fields)
+{
+	char path[sizeof(e->prefix) + 8];
+	const char *slash;
+	int a, k;
+
+	memset(e, 0, sizeof(*e));
+	strncpy(e->prefix, prefix, sizeof(e->prefix) - 1);
+	slash = strrchr(e->prefix, '/');
+#ifdef _WIN32
+	if (strrchr(e->prefix, '\\') > slash) slash = strrchr(e->prefix, '\\');
+#endif
+	e->name = slash ? slash + 1 : e->prefix;
+	e->n = n;
+	e->every = (every > 0) ? every : 1;
+	e->fields = fields;
+	for (a = 0; a < VTK_ARRAYS; a++)
+		if (fields & (1 << a))
+			e->size += 8 + 4 * (size_t)n * n * array_components[a];
+
+	sprintf(path, "%s.pvd", e->prefix);
+	e->index = fopen(path, "wb");
+	if (!e->index)
+	{
+		perror("vtk_export");
+		return -1;
+	}
+	fprintf(e->index, "<?xml version=\"1.0\"?>\n<VTKFile type=\"Collection\" version=\"0.1\" byte_order=\"%s\">\n"
+	                  "  <Collection>\n", byte_order());
+	e->index_end = ftell(e->index);
+	fprintf(e->index, "  </Collection>\n</VTKFile>\n");
+	fflush(e->index);
+	for (k = 0; k < VTK_SLOTS; k++)
+		e->slots[k].data = (unsigned char*) malloc(e->size);
+
+#ifdef _WIN32
+	InitializeCriticalSection(&e->lock);
+	InitializeConditionVariable(&e->wake);
+	e->thread = CreateThread(NULL, 0, writer_main, e, 0, NULL);
+	e->running = e->thread != NULL;
+#else
+	pthread_mutex_init(&e->lock, NULL);
+	pthread_cond_init(&e->wake, NULL);
+	e->running = pthread_create(&e->thread, NULL, writer_main, e) == 0;
+#endif
+	if (!e->running)
+	{
+		vtk_export_close(e);
+		return -1;
+	}
+	return 0;
+}
+
+//vtk_export_close: write the steps still pending, and stop
+void vtk_export_close(vtk_export *e)
+{
+	int k;
+
+	if (e->running)
+	{
+		writer_lock(e);
+		e->quit = 1;
+		writer_wake(e);
+		writer_unlock(e);
+#ifdef _WIN32
+		WaitForSingleObject(e->thread, INFINITE);
+		CloseHandle(e->thread);
+#else
+		pthread_join(e->thread, NULL);
+#endif
+	}
+	if (e->index)
+	{
+#ifdef _WIN32
+		DeleteCriticalSection(&e->lock);
+#else
+		pthread_mutex_destroy(&e->lock);
+		pthread_cond_destroy(&e->wake);
+#endif
+		fclose(e->index);
+	}
+	for (k = 0; k < VTK_SLOTS; k++)
+		free(e->slots[k].data);
+	memset(e, 0, sizeof(*e));
+}
+
+//put_array: write the byte count of an array of 'values' floats, and return where its floats go
+static float *put_array(unsigned char **p, size_t values)
+{
+	unsigned long long bytes = 4 * (unsigned long long)values;
+	float *out = (float*)(*p + 8);
+
+	memcpy(*p, &bytes, 8);
+	*p += 8 + bytes;
+	return out;
+}
+
+//vtk_export_step: account for a step of 'dt', and export the fields of step 'frame' when it is one to export
+void vtk_export_step(vtk_export *e, int frame, double dt, const fftw_real *vx, const fftw_real *vy,
+                     const fftw_real *fx, const fftw_real *fy, const fftw_real *rho)
+{
+	vtk_slot *s;
+	unsigned char *p;
+	int i, count = e->n * e->n;
+
+	e->time += dt;
+	if (!e->running || frame % e->every) return;
+	writer_lock(e);
+	if (e->count == VTK_SLOTS)
+		e->stalls++;
+	while (e->count == VTK_SLOTS)
+		writer_wait(e);
+	s = e->slots + (e->head + e->count) % VTK_SLOTS;     //the writer does not touch the slots after its own
+	writer_unlock(e);
+
+	s->frame = frame;
+	s->time = e->time;
+	p = s->data;
+	if (e->fields & VTK_DENSITY)
+	{
+		float *out = put_array(&p, count);
+		#pragma omp parallel for
+		for (i = 0; i < count; i++)
+			out[i] = (float)rho[i];
+	}
+	if (e->fields & VTK_VELOCITY)
+	{
+		float *out = put_array(&p, 3 * (size_t)count);
+		#pragma omp parallel for
+		for (i = 0; i < count; i++)
+		{
+			out[3 * i] = (float)vx[i]; out[3 * i + 1] = (float)vy[i]; out[3 * i + 2] = 0;
+		}
+	}
+	if (e->fields & VTK_FORCE)
+	{
+		float *out = put_array(&p, 3 * (size_t)count);
+		#pragma omp parallel for
+		for (i = 0; i < count; i++)
+		{
+			out[3 * i] = (float)fx[i]; out[3 * i + 1] = (float)fy[i]; out[3 * i + 2] = 0;
+		}
+	}
+
+	writer_lock(e);
+	e->count++;
+	writer_wake(e);
+	writer_unlock(e);
+}
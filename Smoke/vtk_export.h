@@ -0,0 +1,67 @@
+// vtk_export.h: Exporting the fields as a time series of VTK image data: <prefix>_<step>.vti files, with the values
+//               appended as raw binary, and the index <prefix>.pvd, which lists the files written so far and is a
+//               complete collection after every file.
+//
+//               vtk_export_step converts the exported fields of every 'every'-th step straight from the simulation
+//               buffers into a slot of the writer (in parallel), in the byte layout of the appended data of the
+//               file, and hands the slot to the writer thread, which writes the XML and the appended data with a
+//               single write. With VTK_SLOTS slots the solver runs on while the files of the last steps are written; it
+//               waits only when all slots are still being written.
+//--------------------------------------------------------------------------------------------------
+
+#ifndef VTK_EXPORT_H
+#define VTK_EXPORT_H
+
+#include <rfftw.h>
+#include <stdio.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#define VTK_SLOTS 3                 //exported steps converted but not yet written, at most
+
+#define VTK_DENSITY  1              //fields to export: rho, as "density"
+#define VTK_VELOCITY 2              //(vx,vy,0), as "velocity"
+#define VTK_FORCE    4              //(fx,fy,0), as "force"
+#define VTK_ARRAYS   3
+
+typedef struct
+{
+	unsigned char *data;            //the appended data of the file: per array a 64-bit byte count and the floats
+	int frame;
+	double time;
+} vtk_slot;
+
+typedef struct
+{
+	char prefix[240];
+	const char *name;               //prefix without its directory, for the entries of the index
+	int n, every, fields;
+	double time;                    //simulated time since the export started: the sum of the time steps
+	FILE *index;
+	long index_end;                 //position of the closing tags of the index
+	vtk_slot slots[VTK_SLOTS];
+	int head, count;                //slots handed to the writer, from slot 'head' on
+	int running, quit;
+	size_t size;                    //bytes of the appended data
+	int written, failed;
+	int stalls;                     //exported steps for which the solver waited for a free slot
+#ifdef _WIN32
+	HANDLE thread;
+	CRITICAL_SECTION lock;
+	CONDITION_VARIABLE wake;
+#else
+	pthread_t thread;
+	pthread_mutex_t lock;
+	pthread_cond_t wake;
+#endif
+} vtk_export;
+
+int  vtk_export_open(vtk_export *e, const char *prefix, int n, int every, int fields);
+void vtk_export_close(vtk_export *e);
+void vtk_export_step(vtk_export *e, int frame, double dt, const fftw_real *vx, const fftw_real *vy,
+                     const fftw_real *fx, const fftw_real *fy, const fftw_real *rho);
+
+#endif